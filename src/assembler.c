@@ -21,16 +21,69 @@
 */
 
 #include <stdlib.h>
+#include <stdarg.h>
 #include <string.h>
+#include <errno.h>
 #include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <sys/param.h>
+#include <sys/stat.h>
 
 #include "assembler.h"
+#include "macro.h"
+#include "datapool.h"
+#include "diag.h"
+#include "symindex.h"
+#include "bytes.h"
 
 /* Tunables */
 #define BUFF_SIZE   256
 #define SYMBOL_TABLE_INIT_SIZE  16  /* symbols */
 #define SEGMENT_INIT_SIZE       256 /* bytes */
+#define SEGMENT_HOLE_MIN        4096    /* bytes, shorter holes are stored */
+#define EXTENTS_INIT_SIZE       4   /* stored runs */
+#define STATEMENT_TABLE_INIT_SIZE   64  /* statements */
+#define RELOC_TABLE_INIT_SIZE   16  /* relocations */
+#define STATEMENT_TEXT_INIT_SIZE    4096    /* bytes */
+#define NESTING_MAX             32  /* includes and macro expansions */
+#define RELAX_GROWTH            8   /* bytes a relaxed beq adds */
+
+/* Line being assembled, for diagnostics */
+typedef struct {
+    const char *file;   /* NULL for unnamed input */
+    size_t line;
+    const char *bol;    /* line text */
+    const char *eol;    /* its '\n', the text may hold NULs */
+    const char *stmt;   /* statement, after any labels */
+    int passn;
+    diag_list_t *diags;
+} srcloc_t;
+
+/* Record a diagnostic at pos with its string arguments, only in the pass
+    that checks for it so each is reported once */
+void
+diagnose(const srcloc_t *loc, const char *pos, diag_code_t code, ...) {
+    int pass = diag_pass(code);
+    if (pass >= 0 && pass != loc->passn) return;
+
+    const char *args[DIAG_ARGS_MAX];
+    va_list ap;
+    va_start(ap, code);
+    for (int i = 0; i < diag_nargs(code); i++)
+        args[i] = va_arg(ap, const char*);
+    va_end(ap);
+
+    /* No line, at the end of a file */
+    if (!loc->bol) {
+        diag_add(loc->diags, code, loc->file, 0, 0, NULL, 0, args);
+        return;
+    }
+
+    if (!pos || pos < loc->bol || pos > loc->eol) pos = loc->stmt;
+    diag_add(loc->diags, code, loc->file, loc->line, pos - loc->bol + 1,
+        loc->bol, loc->eol - loc->bol, args);
+}
 
 const char *
 strip(const char *str) {
@@ -65,28 +118,64 @@ copy_keyword(const char *src, char *dst, size_t sz) {
     return src;
 }
 
-const char *
-get_numeric_operand(const char *str, int *p) {
+/* Number at str, or 0 and str itself if there is none */
+static const char *
+scan_number(const char *str, unsigned long long *p) {
     char buff[BUFF_SIZE];
+    const char *start = str;
     int i = 0;
-    int v = 0;
     while (isxdigit(*str) || *str == 'x' || *str == 'b') {
-        if (i >= BUFF_SIZE) break;
+        if (i >= BUFF_SIZE - 1) break;
         buff[i] = *str;
         str++;
         i++;
     }
     buff[i] = '\0';
-    if (buff[1] == 'b') {
-        /* hex */
-        *p = strtol(buff + 2, NULL, 2);
+    char *end;
+    const char *digits = buff;
+    if (buff[0] && buff[1] == 'b') {
+        /* binary */
+        digits = buff + 2;
+        *p = strtoull(digits, &end, 2);
     } else {
         /* hex (0x), oct (0) or dec */
-        *p = strtol(buff, NULL, 0);
+        *p = strtoull(buff, &end, 0);
+    }
+    if (end == digits || *end) {
+        *p = 0;
+        return start;
     }
     return str;
 }
 
+const char *
+get_numeric_operand(const char *str, int *p) {
+    unsigned long long v;
+    str = scan_number(str, &v);
+    *p = v;
+    return str;
+}
+
+/* Number at oper, diagnosed if there is none */
+const char *
+parse_number(const char *oper, int *v, const srcloc_t *loc) {
+    const char *end = get_numeric_operand(oper, v);
+    if (end == oper)
+        diagnose(loc, oper, D_EXPECTED_NUMBER);
+    return end;
+}
+
+/* Size or offset at oper, not limited to int, diagnosed if there is none */
+static const char *
+parse_size(const char *oper, size_t *v, const srcloc_t *loc) {
+    unsigned long long n;
+    const char *end = scan_number(oper, &n);
+    if (end == oper)
+        diagnose(loc, oper, D_EXPECTED_NUMBER);
+    *v = n > SIZE_MAX ? SIZE_MAX : n;
+    return end;
+}
+
 /* Symbol table helpers */
 symbol_table_t *
 symbol_table_new() {
@@ -110,26 +199,214 @@ void
 symbol_table_push(symbol_table_t *st, symbol_t sym) {
     /* Grow table by double */
     if (st->size == st->capacity) {
-        st->table = realloc(st->table, 2*st->capacity);
         st->capacity *= 2;
+        st->table = realloc(st->table, st->capacity * sizeof(symbol_t));
     }
     /* Insert at end */
     st->table[st->size++] = sym;
 }
 
-addr_t
-symbol_table_lookup(symbol_table_t *st, const char *label) {
+symbol_t *
+symbol_table_find(symbol_table_t *st, const char *label) {
     for (int i = 0; i < st->size; i++)
         if (strcmp(st->table[i].label, label) == 0)
-            return st->table[i].address;
-    return 0; /* on not found */
+            return &st->table[i];
+    return NULL;
+}
+
+/* Label in either segment */
+symbol_t *
+segments_find_symbol(segment_t *segs, const char *label) {
+    symbol_t *sym = symbol_table_find(segs[SEG_DATA].symbols, label);
+    return sym ? sym : symbol_table_find(segs[SEG_TEXT].symbols, label);
+}
+
+/* Relocation table helpers */
+reloc_table_t *
+reloc_table_new() {
+    reloc_table_t *rt = malloc(sizeof(reloc_table_t));
+    rt->table = malloc(RELOC_TABLE_INIT_SIZE * sizeof(reloc_t));
+    rt->size = 0;
+    rt->capacity = RELOC_TABLE_INIT_SIZE;
+    return rt;
+}
+
+void
+reloc_table_destroy(reloc_table_t *rt) {
+    for (size_t i = 0; i < rt->size; i++)
+        free(rt->table[i].label);
+    free(rt->table);
+    rt->capacity = rt->size = 0;
+    free(rt);
+}
+
+void
+reloc_table_push(reloc_table_t *rt, addr_t offset, reloc_type_t type,
+    const char *label)
+{
+    /* Grow table by double */
+    if (rt->size == rt->capacity) {
+        rt->capacity *= 2;
+        rt->table = realloc(rt->table, rt->capacity * sizeof(reloc_t));
+    }
+    reloc_t *r = &rt->table[rt->size++];
+    r->offset = offset;
+    r->type = type;
+    r->label = strdup(label);
+}
+
+/* Statement table helpers */
+statement_table_t *
+statement_table_new() {
+    statement_table_t *st = malloc(sizeof(statement_table_t));
+    st->table = malloc(STATEMENT_TABLE_INIT_SIZE * sizeof(statement_t));
+    st->size = 0;
+    st->capacity = STATEMENT_TABLE_INIT_SIZE;
+    st->text = malloc(STATEMENT_TEXT_INIT_SIZE);
+    st->textlen = 0;
+    st->textcap = STATEMENT_TEXT_INIT_SIZE;
+    st->files = NULL;
+    st->nfiles = 0;
+    return st;
+}
+
+void
+statement_table_destroy(statement_table_t *st) {
+    free(st->table);
+    free(st->text);
+    for (size_t i = 0; i < st->nfiles; i++)
+        free(st->files[i]);
+    free(st->files);
+    st->capacity = st->size = 0;
+    free(st);
+}
+
+/* Index of a source file name, added on first use */
+uint32_t
+statement_table_file(statement_table_t *st, const char *name) {
+    if (!name) name = "";
+    for (size_t i = 0; i < st->nfiles; i++)
+        if (strcmp(st->files[i], name) == 0)
+            return i;
+    st->files = realloc(st->files, (st->nfiles + 1) * sizeof(char*));
+    st->files[st->nfiles] = strdup(name);
+    return st->nfiles++;
+}
+
+/* Room for one more statement of len source bytes, -1 if out of memory */
+int
+statement_table_reserve(statement_table_t *st, size_t len) {
+    /* Grow table by double */
+    if (st->size == st->capacity) {
+        statement_t *table = realloc(st->table,
+            2 * st->capacity * sizeof(statement_t));
+        if (!table) return -1;
+        st->table = table;
+        st->capacity *= 2;
+    }
+
+    size_t cap = st->textcap;
+    while (st->textlen + len > cap) cap *= 2;
+    if (cap != st->textcap) {
+        char *text = realloc(st->text, cap);
+        if (!text) return -1;
+        st->text = text;
+        st->textcap = cap;
+    }
+    return 0;
+}
+
+/* Into the room made by statement_table_reserve() */
+void
+statement_table_push(statement_table_t *st, uint32_t file, size_t line,
+    segid_t seg, addr_t addr, size_t size, const char *src, const char *eol)
+{
+    /* Source line without trailing blanks, copied since includes and
+        expansions do not outlive the pass */
+    while (eol > src && isspace(eol[-1])) eol--;
+    size_t len = eol - src;
+    memcpy(st->text + st->textlen, src, len);
+
+    statement_t *s = &st->table[st->size++];
+    s->file = file;
+    s->line = line;
+    s->seg = seg;
+    s->address = addr;
+    s->size = size;
+    s->srcoff = st->textlen;
+    s->srclen = len;
+    st->textlen += len;
 }
 
 void
 segment_destroy(segment_t *seg) {
-    free(seg->data);
-    seg->size = seg->capacity = 0;
+    for (size_t i = 0; i < seg->nextents; i++)
+        free(seg->extents[i].data);
+    free(seg->extents);
+    seg->extents = NULL;
+    seg->size = seg->nextents = seg->extcap = 0;
     symbol_table_destroy(seg->symbols);
+    reloc_table_destroy(seg->relocs);
+}
+
+/* Last extent starting at or before off, or -1 */
+static long
+extent_find(const segment_t *seg, size_t off) {
+    size_t lo = 0, hi = seg->nextents;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (seg->extents[mid].off <= off) lo = mid + 1;
+        else hi = mid;
+    }
+    return (long)lo - 1;
+}
+
+const uint8_t *
+segment_span(const segment_t *seg, size_t off, size_t *n) {
+    long i = extent_find(seg, off);
+    size_t room = off < seg->size ? seg->size - off : 0;
+    if (i >= 0 && off - seg->extents[i].off < seg->extents[i].len) {
+        const extent_t *x = &seg->extents[i];
+        *n = MIN(x->len - (off - x->off), room);
+        return x->data + (off - x->off);
+    }
+    size_t next = (size_t)(i + 1) < seg->nextents
+        ? seg->extents[i + 1].off : seg->size;
+    *n = MIN(next > off ? next - off : 0, room);
+    return NULL;
+}
+
+void
+segment_read(const segment_t *seg, size_t off, uint8_t *buf, size_t n) {
+    while (n > 0) {
+        size_t k;
+        const uint8_t *p = segment_span(seg, off, &k);
+        if (k == 0) {
+            memset(buf, 0, n); /* past the end */
+            return;
+        }
+        if (k > n) k = n;
+        if (p) memcpy(buf, p, k);
+        else memset(buf, 0, k);
+        buf += k;
+        off += k;
+        n -= k;
+    }
+}
+
+uint8_t *
+segment_whole(segment_t *seg) {
+    extent_t *x = malloc(sizeof(extent_t));
+    uint8_t *data = calloc(seg->size ? seg->size : 1, 1);
+    if (!x || !data) {
+        free(x);
+        free(data);
+        return NULL;
+    }
+    *x = (extent_t){ 0, seg->size, seg->size, data };
+    seg->extents = x;
+    seg->nextents = seg->extcap = 1;
+    return data;
 }
 
 int
@@ -148,8 +425,8 @@ count_data_operands(const char *oper) {
 }
 
 addr_t
-next_data_addr(const char *dir, const char *oper, addr_t curr_addr, int line,
-    FILE *errf)
+next_data_addr(const char *dir, const char *oper, addr_t curr_addr,
+    const srcloc_t *loc)
 {
     int p1;
 
@@ -161,30 +438,32 @@ next_data_addr(const char *dir, const char *oper, addr_t curr_addr, int line,
         curr_addr += 4 * count_data_operands(oper);
     } else if (strcmp(dir, "ascii") == 0) {
         if (*oper != '\"') {
-            fprintf(errf, "%d: warning: expected string literal\n",
-                line);
+            diagnose(loc, oper, D_EXPECTED_STRING);
             return curr_addr;
         }
         oper++; /* skip " */
-        while (*oper != '\"') {
+        while (oper < loc->eol && *oper != '\"') {
             curr_addr++;
             oper++;
         }
+        if (oper == loc->eol)
+            diagnose(loc, oper, D_EXPECTED_QUOTE);
     } else if (strcmp(dir, "asciiz") == 0) {
         if (*oper != '\"') {
-            fprintf(errf, "%d: warning: expected string literal\n",
-                line);
+            diagnose(loc, oper, D_EXPECTED_STRING);
             return curr_addr;
         }
         oper++; /* skip " */
-        while (*oper != '\"') {
+        while (oper < loc->eol && *oper != '\"') {
             curr_addr++;
             oper++;
         }
+        if (oper == loc->eol)
+            diagnose(loc, oper, D_EXPECTED_QUOTE);
 
         curr_addr++; /* NUL terminator */
     } else if (strcmp(dir, "align") == 0) {
-        get_numeric_operand(oper, &p1);
+        parse_number(oper, &p1, loc);
         switch (p1) {
             case 1: {
                 if (curr_addr % 2)
@@ -196,28 +475,33 @@ next_data_addr(const char *dir, const char *oper, addr_t curr_addr, int line,
                     curr_addr += 4 - r;
             } break;
             default: {
-                fprintf(errf, "%d: warning: unknown alignment\n",
-                    line);
+                diagnose(loc, oper, D_UNKNOWN_ALIGNMENT);
             }
         }
     } else if (strcmp(dir, "space") == 0) {
-        get_numeric_operand(oper, &p1);
-        curr_addr += p1;
+        size_t n = 0;
+        parse_size(oper, &n, loc);
+        if (n > (addr_t)-1 - curr_addr) {
+            diagnose(loc, oper, D_ADDRESS_RANGE, ".space");
+            return curr_addr;
+        }
+        curr_addr += n;
     } else {
         /* Unknown directive */
-        fprintf(errf, "%d: warning: unknown data directive %s\n",
-            line, dir);
+        diagnose(loc, loc->stmt, D_UNKNOWN_DIRECTIVE, dir);
     }
 
     return curr_addr;
 }
 
 const char *
-write_data_bytes(const char *oper, int8_t *ptr, FILE *verf) {
+write_data_bytes(const char *oper, int8_t *ptr, const srcloc_t *loc,
+    FILE *verf)
+{
     int v, i = 0;
     while (isprint(*oper)) {
         oper = strip(oper);
-        oper = get_numeric_operand(oper, &v);
+        oper = parse_number(oper, &v, loc);
         *ptr = v;
         fprintf(verf, "%d", *ptr);
         ptr++;
@@ -233,14 +517,16 @@ write_data_bytes(const char *oper, int8_t *ptr, FILE *verf) {
 }
 
 const char *
-write_data_halfs(const char *oper, int16_t *ptr, FILE *verf) {
+write_data_halfs(const char *oper, uint8_t *ptr, const byteorder_t *bo,
+    const srcloc_t *loc, FILE *verf)
+{
     int v, i = 0;
     while (isprint(*oper)) {
         oper = strip(oper);
-        oper = get_numeric_operand(oper, &v);
-        *ptr = v;
-        fprintf(verf, "%d", *ptr);
-        ptr++;
+        oper = parse_number(oper, &v, loc);
+        bo->put16(ptr, v);
+        fprintf(verf, "%d", (int16_t)v);
+        ptr += 2;
         i++;
         /* skip , */
         oper = strip(oper);
@@ -253,14 +539,16 @@ write_data_halfs(const char *oper, int16_t *ptr, FILE *verf) {
 }
 
 const char *
-write_data_words(const char *oper, int32_t *ptr, FILE *verf) {
+write_data_words(const char *oper, uint8_t *ptr, const byteorder_t *bo,
+    const srcloc_t *loc, FILE *verf)
+{
     int v, i = 0;
     while (isprint(*oper)) {
         oper = strip(oper);
-        oper = get_numeric_operand(oper, &v);
-        *ptr = v;
-        fprintf(verf, "%d", *ptr);
-        ptr++;
+        oper = parse_number(oper, &v, loc);
+        bo->put32(ptr, v);
+        fprintf(verf, "%d", v);
+        ptr += 4;
         i++;
         /* skip , */
         oper = strip(oper);
@@ -272,29 +560,27 @@ write_data_words(const char *oper, int32_t *ptr, FILE *verf) {
     return oper;
 }
 
+/* Data directive into its reserved bytes at ptr */
 void
-write_data(uint8_t *segdata, const char *dir, const char *oper, addr_t addr,
-int line, FILE *verf, FILE *errf)
+write_data(uint8_t *ptr, const char *dir, const char *oper,
+    const byteorder_t *bo, const srcloc_t *loc, FILE *verf)
 {
-    addr -= DATA_ORG;
-
     if (strcmp(dir, "byte") == 0) {
-        write_data_bytes(oper, segdata + addr, verf);
+        write_data_bytes(oper, (int8_t*)ptr, loc, verf);
     } else if (strcmp(dir, "half") == 0) {
-        write_data_halfs(oper, (int16_t*)&segdata[addr], verf);
+        write_data_halfs(oper, ptr, bo, loc, verf);
     } else if (strcmp(dir, "word") == 0) {
-        write_data_words(oper, (int32_t*)&segdata[addr], verf);
+        write_data_words(oper, ptr, bo, loc, verf);
     } else if (strcmp(dir, "ascii") == 0) {
         if (*oper != '\"') {
             return;
         }
         oper++; /* skip " */
         fprintf(verf, "\"");
-        while (*oper != '\"') {
-            segdata[addr] = *oper;
+        while (oper < loc->eol && *oper != '\"') {
+            *ptr++ = *oper;
             fprintf(verf, "%c", *oper);
             oper++;
-            addr++;
         }
         fprintf(verf, "\"");
     } else if (strcmp(dir, "asciiz") == 0) {
@@ -303,16 +589,14 @@ int line, FILE *verf, FILE *errf)
         }
         oper++; /* skip " */
         fprintf(verf, "\"");
-        while (*oper != '\"') {
-            segdata[addr] = *oper;
+        while (oper < loc->eol && *oper != '\"') {
+            *ptr++ = *oper;
             fprintf(verf, "%c", *oper);
             oper++;
-            addr++;
         }
         fprintf(verf, "\"");
 
-        addr++; /* NUL terminator */
-        segdata[addr] = '\0';
+        *ptr = '\0'; /* NUL terminator */
     }
 
     return;
@@ -350,10 +634,10 @@ encode_j(uint8_t op, addr_t addr) {
 }
 
 const char *
-skip_operand_separator(const char *oper, int line, FILE *verf, FILE *errf) {
+skip_operand_separator(const char *oper, const srcloc_t *loc, FILE *verf) {
     oper = strip(oper);
     if (*oper != ',') {
-        fprintf(errf, "%d: warning: expected ,\n", line);
+        diagnose(loc, oper, D_EXPECTED_COMMA);
         return oper;
     }
     oper++;
@@ -362,9 +646,11 @@ skip_operand_separator(const char *oper, int line, FILE *verf, FILE *errf) {
 }
 
 const char *
-get_register_operand(const char *oper, reg_t *r, int line, FILE *errf) {
+get_register_operand(const char *oper, reg_t *r, const srcloc_t *loc) {
+    const char *start = oper;
     if (*oper != '$') {
-        fprintf(errf, "%d: warning: expected register\n", line);
+        diagnose(loc, oper, D_EXPECTED_REGISTER);
+        *r = 0;
         return oper;
     }
     oper++; /* skip $ */
@@ -411,26 +697,29 @@ get_register_operand(const char *oper, reg_t *r, int line, FILE *errf) {
     } else unknown = 1;
 
     if (unknown) {
-        fprintf(errf, "%d: warning: unknown register\n", line);
+        char name[BUFF_SIZE];
+        size_t n = MIN((size_t)(oper + 1 - start), (size_t)BUFF_SIZE - 1);
+        memcpy(name, start, n);
+        name[n] = '\0';
+        diagnose(loc, start, D_UNKNOWN_REGISTER, name);
         *r = 0;
     }
-    return oper + 1; /* all register pseudo numer < 10 */
+    /* Lettered names end at the letters, the others in one digit */
+    return strlen(buff) == 1 ? oper + 1 : oper;
 }
 
 const char *
-parse_reg_operands(const char *oper, int n, reg_t *regs, int line, FILE *verf,
-    FILE *errf)
+parse_reg_operands(const char *oper, int n, reg_t *regs, const srcloc_t *loc,
+    FILE *verf)
 {
     /* max 3 regs */
     for (int i = 0; i < n; i++) {
         oper = strip(oper);
-        oper = get_register_operand(oper, regs, line, errf);
+        oper = get_register_operand(oper, regs, loc);
         fprintf(verf, "$%d", *regs);
         oper = strip(oper);
         if (i < n - 1) {
-            if (*oper != ',')
-                fprintf(errf, "%d: warning: expected ,\n", line);
-            oper = skip_operand_separator(oper, line, verf, errf);
+            oper = skip_operand_separator(oper, loc, verf);
             regs++;
         }
     }
@@ -438,41 +727,84 @@ parse_reg_operands(const char *oper, int n, reg_t *regs, int line, FILE *verf,
 }
 
 const char *
-parse_immediate_operand(const char *oper, uint16_t *imm, int line, FILE *verf,
-    FILE *errf)
+parse_immediate_operand(const char *oper, uint16_t *imm, const srcloc_t *loc,
+    FILE *verf)
 {
     int t;
-    oper = get_numeric_operand(oper, &t);
+    oper = parse_number(oper, &t, loc);
     *imm = t;
     fprintf(verf, "%d", *imm);
     return oper;
 }
 
+/* %hi(label) or %lo(label), halves of a label address */
+const char *
+parse_hilo_operand(const char *oper, segment_t *segs, uint16_t *imm,
+    reloc_type_t *type, char *label, const asm_options_t *opts,
+    const srcloc_t *loc, FILE *verf)
+{
+    oper++; /* skip % */
+    if (strncmp(oper, "hi(", 3) == 0) *type = RELOC_HI16;
+    else if (strncmp(oper, "lo(", 3) == 0) *type = RELOC_LO16;
+    else {
+        diagnose(loc, oper, D_EXPECTED_HILO);
+        *type = RELOC_LO16;
+        *imm = 0;
+        label[0] = '\0';
+        return oper;
+    }
+    oper = strip(oper + 3);
+
+    const char *start = oper;
+    int i = 0;
+    while (islabelchar(*oper) && i < BUFF_SIZE - 1)
+        label[i++] = *oper++;
+    label[i] = '\0';
+
+    oper = strip(oper);
+    if (*oper != ')')
+        diagnose(loc, oper, D_EXPECTED_RPAREN);
+    else oper++;
+
+    symbol_t *sym = segments_find_symbol(segs, label);
+    addr_t addr = sym ? sym->address : 0;
+    if (!sym && !opts->relocatable) /* else imported */
+        diagnose(loc, start, D_UNDEFINED_LABEL, label);
+    *imm = *type == RELOC_HI16 ? addr >> 16 : addr & 0xffff;
+
+    fprintf(verf, "%%%s(0x%.8x)", *type == RELOC_HI16 ? "hi" : "lo", addr);
+    return strip(oper);
+}
+
 const char *
 parse_base_displacement_operand(const char *oper, uint16_t *imm, reg_t *base,
-    int line, FILE *verf, FILE *errf)
+    const srcloc_t *loc, FILE *verf)
 {
     /* get displacement */
     int dis;
+    const char *start = oper;
     oper = get_numeric_operand(oper, &dis);
+    if (oper == start && *oper != '(') /* else 0($b) written ($b) */
+        diagnose(loc, oper, D_EXPECTED_NUMBER);
     *imm = dis;
 
     oper = strip(oper);
     
     if (*oper != '(') {
-        fprintf(errf, "%d: warning: expected (\n", line);
+        diagnose(loc, oper, D_EXPECTED_LPAREN);
+        *base = 0;
         return oper;
     }
     oper++; /* skip ( */
     oper = strip(oper);
 
     /* get base register */
-    oper = get_register_operand(oper, base, line, errf);
+    oper = get_register_operand(oper, base, loc);
 
     oper = strip(oper);
     if (*oper != ')')
-        fprintf(errf, "%d: warning: expected )\n", line);
-    oper++;
+        diagnose(loc, oper, D_EXPECTED_RPAREN);
+    else oper++;
     oper = strip(oper);
 
     fprintf(verf, "%d($%d)", *imm, *base);
@@ -481,17 +813,20 @@ parse_base_displacement_operand(const char *oper, uint16_t *imm, reg_t *base,
 
 const char *
 parse_label_operand(const char *oper, symbol_table_t *st, addr_t *addr,
-    int line, FILE *verf, FILE *errf)
+    char *label, const asm_options_t *opts, const srcloc_t *loc, FILE *verf)
 {
-    char buff[BUFF_SIZE];
+    const char *start = oper;
     int i = 0;
-    while (islabelchar(*oper) && i < BUFF_SIZE) {
-        buff[i] = *oper;
+    while (islabelchar(*oper) && i < BUFF_SIZE - 1) {
+        label[i] = *oper;
         i++;
         oper++;
     }
-    buff[i] = '\0';
-    *addr = symbol_table_lookup(st, buff);
+    label[i] = '\0';
+    symbol_t *sym = symbol_table_find(st, label);
+    *addr = sym ? sym->address : 0;
+    if (!sym && !opts->relocatable) /* else imported */
+        diagnose(loc, start, D_UNDEFINED_LABEL, label);
 
     fprintf(verf, "0x%.8x", *addr);
     return strip(oper);
@@ -503,254 +838,1145 @@ calculate_relative_jump(addr_t from, addr_t to) {
     return (to - from - 4) / 4;
 }
 
+/* j keeps the upper 4 bits of the address after it */
+int
+jump_in_region(addr_t from, addr_t to) {
+    return ((from + 4) & 0xf0000000) == (to & 0xf0000000);
+}
+
+/* Instruction at addr into its reserved bytes at code */
 void
-encode_instruction(segment_t *segs, addr_t addr, const char *ins,
-    const char *oper,  int line, FILE *verf, FILE *errf)
+encode_instruction(segment_t *segs, uint8_t *code, addr_t addr,
+    const char *ins, const char *oper, const asm_options_t *opts, int relax,
+    const byteorder_t *bo, const srcloc_t *loc, FILE *verf)
 {
-
-    uint8_t *segdata = segs[SEG_TEXT].data;
-
     addr -= TEXT_ORG;
+    word_t w = 0; /* encoded instruction */
     reg_t regs[3]; /* register operands */
     uint16_t imm; /* immediate data */
     addr_t label_addr; /* jump addr */
+    char label[BUFF_SIZE]; /* referenced label, for relocations */
+    int has_reloc = 0;
+    reloc_type_t reloc;
+    const char *target = NULL; /* label operand, for diagnostics */
 
     /* ALU instructions, R format
         fields: $a, $b, $c => rd, rs, rt */
     if (strcmp(ins, "and") == 0) {
-        parse_reg_operands(oper, 3, regs, line, verf, errf);
-        *(word_t*)&segdata[addr] = encode_r(0, regs[1], regs[2], regs[0], 0,
-            0b100100);
+        parse_reg_operands(oper, 3, regs, loc, verf);
+        w = encode_r(0, regs[1], regs[2], regs[0], 0, 0b100100);
     } else if (strcmp(ins, "or") == 0) {
-        parse_reg_operands(oper, 3, regs, line, verf, errf);
-        *(word_t*)&segdata[addr] = encode_r(0, regs[1], regs[2], regs[0], 0,
-            0b100101);
+        parse_reg_operands(oper, 3, regs, loc, verf);
+        w = encode_r(0, regs[1], regs[2], regs[0], 0, 0b100101);
     } else if (strcmp(ins, "add") == 0) {
-        parse_reg_operands(oper, 3, regs, line, verf, errf);
-        *(word_t*)&segdata[addr] = encode_r(0, regs[1], regs[2], regs[0], 0,
-            0b100000);
+        parse_reg_operands(oper, 3, regs, loc, verf);
+        w = encode_r(0, regs[1], regs[2], regs[0], 0, 0b100000);
     } else if (strcmp(ins, "sub") == 0) {
-        parse_reg_operands(oper, 3, regs, line, verf, errf);
-        *(word_t*)&segdata[addr] = encode_r(0, regs[1], regs[2], regs[0], 0,
-            0b100010);
+        parse_reg_operands(oper, 3, regs, loc, verf);
+        w = encode_r(0, regs[1], regs[2], regs[0], 0, 0b100010);
     } else if (strcmp(ins, "slt") == 0) {
-        parse_reg_operands(oper, 3, regs, line, verf, errf);
-        *(word_t*)&segdata[addr] = encode_r(0, regs[1], regs[2], regs[0], 0,
-            0b101010);
+        parse_reg_operands(oper, 3, regs, loc, verf);
+        w = encode_r(0, regs[1], regs[2], regs[0], 0, 0b101010);
     }
     /* ALU immediate instructions, I format
         fields: $a, $b, imm */
     else if (strcmp(ins, "ori") == 0) {
-        oper = parse_reg_operands(oper, 2, regs, line, verf, errf);
-        oper = skip_operand_separator(oper, line, verf, errf);
-        oper = parse_immediate_operand(oper, &imm, line, verf, errf);
-        *(word_t*)&segdata[addr] = encode_i(0b001101, regs[1], regs[0], imm);
+        oper = parse_reg_operands(oper, 2, regs, loc, verf);
+        oper = skip_operand_separator(oper, loc, verf);
+        if (*oper == '%') {
+            oper = parse_hilo_operand(oper, segs, &imm, &reloc, label, opts,
+                loc, verf);
+            has_reloc = 1;
+        } else
+            oper = parse_immediate_operand(oper, &imm, loc, verf);
+        w = encode_i(0b001101, regs[1], regs[0], imm);
     }
     /* Memory instructions, I format */
     else if (strcmp(ins, "lw") == 0) {
         /* $a, off($b) => rt, imm(rs) */
-        oper = parse_reg_operands(oper, 1, regs, line, verf, errf);
-        oper = skip_operand_separator(oper, line, verf, errf);
-        oper = parse_base_displacement_operand(oper, &imm, regs + 1, line,
-            verf, errf);
-        *(word_t*)&segdata[addr] = encode_i(0b100011, regs[0], regs[1], imm);
+        oper = parse_reg_operands(oper, 1, regs, loc, verf);
+        oper = skip_operand_separator(oper, loc, verf);
+        oper = parse_base_displacement_operand(oper, &imm, regs + 1, loc,
+            verf);
+        w = encode_i(0b100011, regs[0], regs[1], imm);
     }
     else if (strcmp(ins, "sw") == 0) {
         /* $a, off($b) => rs, imm(rt) */
-        oper = parse_reg_operands(oper, 1, regs, line, verf, errf);
-        oper = skip_operand_separator(oper, line, verf, errf);
-        oper = parse_base_displacement_operand(oper, &imm, regs + 1, line,
-            verf, errf);
-        *(word_t*)&segdata[addr] = encode_i(0b101011, regs[1], regs[0], imm);
+        oper = parse_reg_operands(oper, 1, regs, loc, verf);
+        oper = skip_operand_separator(oper, loc, verf);
+        oper = parse_base_displacement_operand(oper, &imm, regs + 1, loc,
+            verf);
+        w = encode_i(0b101011, regs[1], regs[0], imm);
     }
     /* Immediate constant 
         $a, val => rt, val */
     else if (strcmp(ins, "lui") == 0) {
-        oper = parse_reg_operands(oper, 1, regs, line, verf, errf);
-        oper = skip_operand_separator(oper, line, verf, errf);
-        oper = parse_immediate_operand(oper, &imm, line, verf, errf);
-        *(word_t*)&segdata[addr] = encode_i(0b001111, 0, regs[0], imm);
+        oper = parse_reg_operands(oper, 1, regs, loc, verf);
+        oper = skip_operand_separator(oper, loc, verf);
+        if (*oper == '%') {
+            oper = parse_hilo_operand(oper, segs, &imm, &reloc, label, opts,
+                loc, verf);
+            has_reloc = 1;
+        } else
+            oper = parse_immediate_operand(oper, &imm, loc, verf);
+        w = encode_i(0b001111, 0, regs[0], imm);
     }
     /* Conditional jump
         $a, $b, label => rs, rt, (label) */
     else if (strcmp(ins, "beq") == 0) {
-        oper = parse_reg_operands(oper, 2, regs, line, verf, errf);
-        oper = skip_operand_separator(oper, line, verf, errf);
+        oper = parse_reg_operands(oper, 2, regs, loc, verf);
+        oper = skip_operand_separator(oper, loc, verf);
+        target = oper;
         oper = parse_label_operand(oper, segs[SEG_TEXT].symbols, &label_addr,
-            line, verf, errf);
-        *(word_t*)&segdata[addr] = encode_i(0b000100, regs[0], regs[1],
-            calculate_relative_jump(addr + TEXT_ORG, label_addr));
+            label, opts, loc, verf);
+        if (relax) {
+            /* Out of reach, taken over the next beq to a j:
+                beq $a, $b, +1; beq $zero, $zero, +1; j label */
+            bo->put32(code, encode_i(0b000100, regs[0], regs[1], 1));
+            bo->put32(code + 4, encode_i(0b000100, 0, 0, 1));
+            code += 8;
+            addr += 8;
+            w = encode_j(0b000010, label_addr);
+            reloc = RELOC_J26;
+            fprintf(verf, " (relaxed)");
+        } else {
+            w = encode_i(0b000100, regs[0], regs[1],
+                calculate_relative_jump(addr + TEXT_ORG, label_addr));
+            reloc = RELOC_PC16;
+        }
+        has_reloc = 1;
     }
     /* Unconditional jump 
         label => addr */
     else if (strcmp(ins, "j") == 0) {
+        target = oper;
         oper = parse_label_operand(oper, segs[SEG_TEXT].symbols, &label_addr,
-            line, verf, errf);
-        *(word_t*)&segdata[addr] = encode_j(0b000010, label_addr);
+            label, opts, loc, verf);
+        w = encode_j(0b000010, label_addr);
+        reloc = RELOC_J26;
+        has_reloc = 1;
     }
     else {
-        fprintf(errf, "%d:  ^^ warning: unknown instruction\n", line);
+        diagnose(loc, loc->stmt, D_UNKNOWN_INSTRUCTION, ins);
     }   
+    bo->put32(code, w);
+
+    /* The linker checks the jumps it resolves */
+    if (has_reloc && reloc == RELOC_J26 && !opts->relocatable
+        && !jump_in_region(addr + TEXT_ORG, label_addr))
+    {
+        diagnose(loc, target, D_JUMP_REGION, label);
+    }
+
+    /* Leave label references to the linker */
+    if (has_reloc && opts->relocatable)
+        reloc_table_push(segs[SEG_TEXT].relocs, addr, reloc, label);
+}
+
+void
+mark_global(segment_t *segs, const char *oper, const asm_options_t *opts,
+    const srcloc_t *loc, FILE *verf)
+{
+    const char *start = oper;
+    char label[BUFF_SIZE];
+    int i = 0;
+    while (islabelchar(*oper) && i < BUFF_SIZE - 1)
+        label[i++] = *oper++;
+    label[i] = '\0';
+    fprintf(verf, "%s", label);
+
+    symbol_t *sym = segments_find_symbol(segs, label);
+    if (sym)
+        sym->global = 1;
+    else if (!opts->relocatable) /* else imported */
+        diagnose(loc, start, D_UNDEFINED_GLOBAL, label);
 }
 
 
+/* Source being assembled, a file or a macro expansion */
+typedef struct {
+    const char *name;       /* file, includes are relative to it */
+    const char *data;       /* every line '\n' terminated */
+    size_t len;
+    const uint32_t *lines;  /* line offsets */
+    size_t nlines;
+    size_t line;            /* invocation line of an expansion, else 0 */
+} source_t;
+
+/* --merge-strings run: the data from a label up to the next label or
+    segment directive, merged as a whole */
+typedef struct {
+    size_t labels;          /* right before it, 0 if no run is open */
+    size_t item;            /* index into merged */
+    addr_t addr;
+    int mergeable;          /* only .asciiz, .byte, .half and .word */
+    int strings;            /* only .asciiz, so its tails match too */
+    size_t align;           /* largest of its items */
+    uint8_t *data;          /* contents, in the first pass */
+    size_t len;
+    size_t cap;
+} datarun_t;
+
+/* beq in .text, laid out by the first pass */
+typedef struct {
+    addr_t address;
+    char *label;            /* target, until resolved */
+    long sym;               /* target in the .text symbols, or -1 */
+    uint8_t relaxed;        /* into beq, beq and j */
+    uint8_t grow;           /* relaxed in the current round */
+} branch_t;
+
+typedef struct {
+    int passn;
+    segment_t *segs;
+    const asm_options_t *opts;
+    statement_table_t *stmts;
+    filecache_t *cache;
+    macro_table_t *macros;
+    macro_t *defining;      /* .macro body being read */
+    segid_t curr_seg;
+    addr_t curr_addr[2];
+    int depth;              /* of includes and expansions */
+    uint32_t file;          /* current, in the statement table */
+    datapool_t *pool;       /* for --merge-strings, else NULL */
+    uint8_t *merged;        /* by run, from the first pass */
+    size_t nitems;
+    size_t itemcap;
+    size_t pending;         /* data labels not followed by data yet */
+    datarun_t run;
+    branch_t *branches;     /* by beq, from the first pass */
+    size_t nbranches;
+    size_t branchcap;
+    size_t relaxed;
+    symindex_t *index;      /* built after the first pass, may be NULL */
+    size_t committed;       /* bytes, against opts->max_memory */
+    const byteorder_t *order; /* of opts->endian */
+    diag_list_t *diags;
+    FILE *verf;
+} pass_state_t;
+
+/* Account for n more bytes before allocating them, failing when that goes
+    over the memory budget */
 int
-pass(int passn, const char *input, size_t ilen, segment_t *segs, FILE *verf,
-    FILE *errf)
+commit_memory(pass_state_t *ps, size_t n, const srcloc_t *loc) {
+    size_t max = ps->opts->max_memory;
+    if (max && (n > max || ps->committed > max - n)) {
+        char need[24], limit[24];
+        snprintf(need, sizeof(need), "%zu", n);
+        snprintf(limit, sizeof(limit), "%zu", max);
+        diagnose(loc, NULL, D_MEMORY_LIMIT, need, limit);
+        return -1;
+    }
+    ps->committed += n;
+    return 0;
+}
+
+/* An allocation of n bytes failed */
+void
+out_of_memory(const srcloc_t *loc, size_t n) {
+    char need[24];
+    snprintf(need, sizeof(need), "%zu", n);
+    diagnose(loc, NULL, D_OUT_OF_MEMORY, need);
+}
+
+/* Back bytes [off, off + len) of a segment, returning where they are
+    stored. A write near the end of a stored run extends it geometrically,
+    one further away starts a new run, so holes like .space take no memory
+    wherever they are */
+uint8_t *
+segment_reserve(pass_state_t *ps, segment_t *seg, size_t off, size_t len,
+    const srcloc_t *loc)
 {
-    /* Deserialization vars */
-    const char *t = NULL;
-    size_t line = 1;
+    static uint8_t none; /* nothing to store, but not a failure */
+    if (len == 0) return &none;
+
+    size_t end = off + len;
+    long i = extent_find(seg, off);
+    extent_t *x = i >= 0 ? &seg->extents[i] : NULL;
+    if (x && end <= x->off + x->len)
+        return x->data + (off - x->off);
+
+    if (!x || off - x->off > x->len + SEGMENT_HOLE_MIN) {
+        /* New run after x */
+        if (seg->nextents == seg->extcap) {
+            size_t cap = seg->extcap ? 2 * seg->extcap : EXTENTS_INIT_SIZE;
+            size_t more = (cap - seg->extcap) * sizeof(extent_t);
+            if (commit_memory(ps, more, loc) < 0)
+                return NULL;
+            extent_t *xs = realloc(seg->extents, cap * sizeof(extent_t));
+            if (!xs) {
+                ps->committed -= more;
+                out_of_memory(loc, more);
+                return NULL;
+            }
+            seg->extents = xs;
+            seg->extcap = cap;
+        }
+        i++;
+        memmove(&seg->extents[i + 1], &seg->extents[i],
+            (seg->nextents - i) * sizeof(extent_t));
+        seg->extents[i] = (extent_t){ off, 0, 0, NULL };
+        seg->nextents++;
+        x = &seg->extents[i];
+    }
+
+    /* Runs the grown one reaches are absorbed */
+    size_t need = end - x->off, absorb = 0;
+    while (i + 1 + absorb < seg->nextents
+        && seg->extents[i + 1 + absorb].off < end)
+    {
+        const extent_t *y = &seg->extents[i + 1 + absorb++];
+        need = MAX(need, y->off + y->len - x->off);
+    }
+
+    if (need > x->cap) {
+        /* Not past the segment end or the next run */
+        size_t limit = i + 1 + absorb < seg->nextents
+            ? seg->extents[i + 1 + absorb].off : MAX(seg->size, x->off);
+        size_t cap = x->cap ? x->cap : SEGMENT_INIT_SIZE;
+        while (cap < need) cap *= 2;
+        if (cap > limit - x->off) cap = MAX(limit - x->off, need);
+
+        if (commit_memory(ps, cap - x->cap, loc) < 0)
+            return NULL;
+        uint8_t *data = realloc(x->data, cap);
+        if (!data) {
+            ps->committed -= cap - x->cap;
+            out_of_memory(loc, cap - x->cap);
+            return NULL;
+        }
+        x->data = data;
+        x->cap = cap;
+    }
+
+    memset(x->data + x->len, 0, need - x->len);
+    for (size_t k = 1; k <= absorb; k++) {
+        extent_t *y = &seg->extents[i + k];
+        memcpy(x->data + (y->off - x->off), y->data, y->len);
+        free(y->data);
+        ps->committed -= y->cap;
+    }
+    memmove(&seg->extents[i + 1], &seg->extents[i + 1 + absorb],
+        (seg->nextents - i - 1 - absorb) * sizeof(extent_t));
+    seg->nextents -= absorb;
+    x->len = need;
+    return x->data + (off - x->off);
+}
+
+int pass_source(pass_state_t *ps, const source_t *src);
+
+/* name, relative to the directory of the including file */
+char *
+include_path(const char *from, const char *name, size_t len) {
+    const char *slash = from ? strrchr(from, '/') : NULL;
+    size_t dl = slash && *name != '/' ? slash - from + 1 : 0;
+    char *path = malloc(dl + len + 1);
+    memcpy(path, from, dl);
+    memcpy(path + dl, name, len);
+    path[dl + len] = '\0';
+    return path;
+}
+
+/* Quoted file name operand, resolved against the including file */
+char *
+parse_path_operand(pass_state_t *ps, const source_t *src, const char **oper,
+    const srcloc_t *loc)
+{
+    const char *p = *oper;
+    if (*p != '\"') {
+        diagnose(loc, p, D_EXPECTED_STRING);
+        return NULL;
+    }
+    const char *name = ++p; /* skip " */
+    while (*p != '\"' && *p != '\n') p++;
+    if (*p != '\"')
+        diagnose(loc, p, D_EXPECTED_QUOTE);
+
+    char *path = include_path(src->name, name, p - name);
+    fprintf(ps->verf, "\"%s\"", path);
+    *oper = strip(*p == '\"' ? p + 1 : p);
+    return path;
+}
+
+cached_file_t *
+get_file(pass_state_t *ps, const char *path, const srcloc_t *loc) {
+    cached_file_t *cf = filecache_get(ps->cache, path);
+    if (!cf)
+        diagnose(loc, NULL, D_CANNOT_READ, path, strerror(errno));
+    return cf;
+}
+
+int
+include_file(pass_state_t *ps, const source_t *src, const char *oper,
+    const srcloc_t *loc)
+{
+    char *path = parse_path_operand(ps, src, &oper, loc);
+    if (!path) return 0;
+    fprintf(ps->verf, "\n");
+
+    cached_file_t *cf = get_file(ps, path, loc);
+    free(path);
+    if (!cf) return -1;
+
+    source_t inc = { cf->path, cf->data, cf->len, cf->lines, cf->nlines,
+        0 };
+    return pass_source(ps, &inc);
+}
+
+/* .incbin "file"[, offset[, length]], sized by the first pass and read
+    straight into the segment by the second, never through the source cache */
+int
+include_binary(pass_state_t *ps, const source_t *src, const char *oper,
+    const srcloc_t *loc)
+{
+    char *path = parse_path_operand(ps, src, &oper, loc);
+    if (!path) return 0;
+
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        int err = errno;
+        if (fd >= 0) close(fd);
+        filecache_note(ps->cache, path, NULL);
+        diagnose(loc, NULL, D_CANNOT_READ, path, strerror(err));
+        free(path);
+        return -1;
+    }
+    filecache_note(ps->cache, path, &st);
+
+    size_t size = st.st_size, off = 0, len = SIZE_MAX;
+    if (*oper == ',') {
+        oper = strip(parse_size(strip(oper + 1), &off, loc));
+        if (*oper == ',')
+            parse_size(strip(oper + 1), &len, loc);
+    }
+    if (off <= size && len == SIZE_MAX) len = size - off;
+    /* Within the file, and within the address space after curr_addr */
+    if (off > size || len > size - off
+        || len > (addr_t)-1 - ps->curr_addr[SEG_DATA])
+    {
+        diagnose(loc, oper, D_INCBIN_RANGE, path);
+        goto fail;
+    }
+    fprintf(ps->verf, ", %zu, %zu", off, len);
+
+    segment_t *seg = &ps->segs[SEG_DATA];
+    if (ps->passn == 1) {
+        size_t at = ps->curr_addr[SEG_DATA] - seg->org;
+        uint8_t *to = segment_reserve(ps, seg, at, len, loc);
+        if (!to) goto fail;
+        for (size_t got = 0; got < len; ) {
+            ssize_t r = pread(fd, to + got, len - got,
+                off + got);
+            if (r < 0 && errno == EINTR) continue;
+            if (r <= 0) {
+                diagnose(loc, NULL, D_CANNOT_READ, path,
+                    strerror(r == 0 ? EIO : errno));
+                goto fail;
+            }
+            got += r;
+        }
+    }
+    ps->curr_addr[SEG_DATA] += len;
+    close(fd);
+    free(path);
+    return 0;
+
+fail:
+    close(fd);
+    free(path);
+    return -1;
+}
+
+/* Macro named by the len characters at name, however long the name is */
+static macro_t *
+find_macro(pass_state_t *ps, const char *name, size_t len) {
+    char *key = strndup(name, len);
+    if (!key) return NULL;
+    macro_t *m = macro_table_find(ps->macros, key);
+    free(key);
+    return m;
+}
+
+int
+expand_macro(pass_state_t *ps, const source_t *src, const macro_t *m,
+    const char *oper, const srcloc_t *loc)
+{
+    const char *args[MACRO_PARAMS_MAX];
+    size_t arglens[MACRO_PARAMS_MAX];
+    int n = 0;
+
+    /* Comma separated arguments, blanks around them dropped */
+    while (*oper != '\n') {
+        const char *a = oper, *e;
+        while (*oper != ',' && *oper != '\n') oper++;
+        for (e = oper; e > a && isblank(e[-1]); e--);
+        if (n < m->nparams) {
+            args[n] = a;
+            arglens[n] = e - a;
+        }
+        n++;
+        if (*oper == ',') oper = strip(oper + 1);
+    }
+    if (n > m->nparams)
+        diagnose(loc, NULL, D_TOO_MANY_ARGUMENTS, m->name);
+    for (int i = n; i < m->nparams; i++) {
+        args[i] = "";
+        arglens[i] = 0;
+    }
+    fprintf(ps->verf, "%zu: macro: %s\n", loc->line, m->name);
+
+    size_t len, need = macro_expanded_len(m, arglens);
+    if (commit_memory(ps, need, loc) < 0)
+        return -1;
+    char *text = macro_expand(m, args, arglens, &len);
+    uint32_t *lines;
+    size_t nlines = split_lines(text, len, &lines);
+
+    source_t exp = { src->name, text, len, lines, nlines, loc->line };
+    int r = pass_source(ps, &exp);
+
+    free(lines);
+    free(text);
+    ps->committed -= need;
+    return r;
+}
+
+/* --merge-strings: open a run at the first data after labels, -1 if out
+    of memory */
+int
+run_open(pass_state_t *ps, const srcloc_t *loc) {
+    datarun_t *r = &ps->run;
+    size_t item = ps->nitems++;
+    if (ps->passn == 0) {
+        if (item == ps->itemcap) {
+            size_t cap = ps->itemcap ? 2 * ps->itemcap : 64;
+            if (commit_memory(ps, cap - ps->itemcap, loc) < 0)
+                return -1;
+            uint8_t *merged = realloc(ps->merged, cap);
+            if (!merged) {
+                ps->committed -= cap - ps->itemcap;
+                out_of_memory(loc, cap - ps->itemcap);
+                return -1;
+            }
+            ps->merged = merged;
+            ps->itemcap = cap;
+        }
+        ps->merged[item] = 0;
+    }
+
+    r->labels = ps->pending;
+    r->item = item;
+    r->addr = ps->curr_addr[SEG_DATA];
+    r->mergeable = r->strings = 1;
+    r->align = 1;
+    r->len = 0;
+    ps->pending = 0;
+    return 0;
+}
+
+/* First pass: contents of a data directive in the open run, as the second
+    pass will write them. -1 if out of memory */
+int
+run_add(pass_state_t *ps, const char *dir, const char *oper, addr_t addr,
+    addr_t next, const srcloc_t *loc)
+{
+    datarun_t *r = &ps->run;
+    size_t align;
+    if (strcmp(dir, "asciiz") == 0 || strcmp(dir, "byte") == 0) align = 1;
+    else if (strcmp(dir, "half") == 0) align = 2;
+    else if (strcmp(dir, "word") == 0) align = 4;
+    else r->mergeable = 0;
+    if (!r->mergeable) return 0;
+
+    size_t end = next - r->addr;
+    if (end > r->cap) {
+        size_t cap = r->cap ? r->cap : 64;
+        while (cap < end) cap *= 2;
+        if (commit_memory(ps, cap - r->cap, loc) < 0)
+            return -1;
+        uint8_t *data = realloc(r->data, cap);
+        if (!data) {
+            ps->committed -= cap - r->cap;
+            out_of_memory(loc, cap - r->cap);
+            return -1;
+        }
+        r->data = data;
+        r->cap = cap;
+    }
+    memset(r->data + r->len, 0, end - r->len);
+    write_data(r->data + (addr - r->addr), dir, oper, ps->order, loc,
+        ps->verf);
+    r->len = end;
+    r->strings &= dir[0] == 'a';
+    r->align = MAX(r->align, align);
+    return 0;
+}
+
+/* Close the open run, at a label, a segment directive or the end of the
+    pass. In the first pass, a run whose contents were laid out before
+    gives its room back and its labels move to the copy. -1 if there is no
+    memory to pool it */
+int
+run_close(pass_state_t *ps, const srcloc_t *loc) {
+    datarun_t *r = &ps->run;
+    if (!r->labels) return 0;
+
+    addr_t found;
+    symbol_table_t *st = ps->segs[SEG_DATA].symbols;
+    if (ps->passn == 0 && r->mergeable && r->len && datapool_find(ps->pool,
+        r->data, r->len, r->addr, r->align, &found))
+    {
+        for (size_t i = st->size - r->labels; i < st->size; i++) {
+            fprintf(ps->verf, "  -> label %s merged: 0x%.8x\n",
+                st->table[i].label, found);
+            st->table[i].address = found;
+        }
+        ps->curr_addr[SEG_DATA] = r->addr;
+        ps->merged[r->item] = 1;
+    } else if (ps->passn == 0 && r->mergeable && r->len) {
+        size_t more = datapool_growth(ps->pool, r->len, r->strings);
+        r->labels = 0;
+        if (commit_memory(ps, more, loc) < 0)
+            return -1;
+        if (datapool_add(ps->pool, r->data, r->len, r->addr, r->strings)
+            < 0)
+        {
+            ps->committed -= more;
+            out_of_memory(loc, more);
+            return -1;
+        }
+    }
+    r->labels = 0;
+    return 0;
+}
+
+/* First pass: remember a beq and its target label, its third operand */
+int
+add_branch(pass_state_t *ps, const char *oper, const srcloc_t *loc) {
+    for (int commas = 0; *oper != '\n' && commas < 2; oper++)
+        if (*oper == ',') commas++;
+    oper = strip(oper);
+    size_t ll = label_len(oper);
+
+    if (commit_memory(ps, ll + 1, loc) < 0)
+        return -1;
+    if (ps->nbranches == ps->branchcap) {
+        size_t cap = ps->branchcap ? 2 * ps->branchcap : 64;
+        size_t more = (cap - ps->branchcap) * sizeof(branch_t);
+        if (commit_memory(ps, more, loc) < 0)
+            return -1;
+        branch_t *branches = realloc(ps->branches, cap * sizeof(branch_t));
+        if (!branches) {
+            ps->committed -= more;
+            out_of_memory(loc, more);
+            return -1;
+        }
+        ps->branches = branches;
+        ps->branchcap = cap;
+    }
+    ps->branches[ps->nbranches++] = (branch_t){ ps->curr_addr[SEG_TEXT],
+        strndup(oper, ll), -1, 0, 0 };
+    return 0;
+}
+
+/* Relax every beq whose target is beyond its 16 bit offset into
+    beq rs, rt, +1; beq $zero, $zero, +1; j target. That moves the code
+    after it, which may put other targets out of reach, so repeat until no
+    more are relaxed. Relaxed beq only grow, so this ends */
+void
+relax_branches(pass_state_t *ps) {
+    symbol_table_t *st = ps->segs[SEG_TEXT].symbols;
+
+    for (size_t i = 0; i < ps->nbranches; i++) {
+        symbol_t *sym = symbol_table_find(st, ps->branches[i].label);
+        ps->branches[i].sym = sym ? sym - st->table : -1;
+        free(ps->branches[i].label); /* only needed to find it */
+        ps->branches[i].label = NULL;
+    }
+
+    size_t added;
+    do {
+        added = 0;
+        for (size_t i = 0; i < ps->nbranches; i++) {
+            branch_t *b = &ps->branches[i];
+            if (b->relaxed || b->sym < 0) continue;
+            int64_t off = ((int64_t)st->table[b->sym].address
+                - b->address - 4) / 4;
+            if (off < INT16_MIN || off > INT16_MAX)
+                b->relaxed = b->grow = 1, added++;
+        }
+
+        /* Labels are in address order, move those past each new one */
+        addr_t grown = 0;
+        size_t j = 0;
+        for (size_t i = 0; i < ps->nbranches; i++) {
+            branch_t *b = &ps->branches[i];
+            while (j < st->size && st->table[j].address <= b->address)
+                st->table[j++].address += grown;
+            b->address += grown;
+            if (b->grow) {
+                fprintf(ps->verf, "relaxed beq to %s at 0x%.8x\n",
+                    st->table[b->sym].label, b->address);
+                grown += RELAX_GROWTH;
+                b->grow = 0;
+            }
+        }
+        while (j < st->size)
+            st->table[j++].address += grown;
+        ps->curr_addr[SEG_TEXT] += grown;
+        ps->relaxed += added;
+    } while (added);
+}
+
+int
+assemble_line(pass_state_t *ps, const source_t *src, const char *bol,
+    const char *eol, int line)
+{
+    segment_t *segs = ps->segs;
+    const asm_options_t *opts = ps->opts;
+    statement_table_t *stmts = ps->passn == 1 ? ps->stmts : NULL;
+    FILE *verf = ps->verf;
     char buff[BUFF_SIZE];
-    size_t len = 0;
 
-    /* First pass state */
-    segid_t curr_seg = SEG_TEXT; /* .text by default */
-    addr_t curr_addr[2] = { DATA_ORG, TEXT_ORG };
-    
-    const char *end = input + ilen;
-    while (input < end) {
+    const char *input = strip(bol);
+    srcloc_t loc = { src->name, line, bol, eol, input, ps->passn,
+        ps->diags };
+
+    /* Its statement, if listed */
+    if (stmts && commit_memory(ps, sizeof(statement_t) + (eol - bol), &loc)
+        < 0)
+    {
+        return -1;
+    }
+    if (stmts && statement_table_reserve(stmts, eol - bol) < 0) {
+        out_of_memory(&loc, sizeof(statement_t) + (eol - bol));
+        return -1;
+    }
+
+    if (ps->defining) {
+        /* Macro body, kept from the first pass */
+        if (strncmp(input, ".endm", 5) == 0 && !islabelchar(input[5])) {
+            if (ps->passn == 0)
+                macro_finish(ps->defining);
+            ps->defining = NULL;
+            fprintf(verf, "%d: directive: .endm\n", line);
+        } else if (ps->passn == 0) {
+            if (commit_memory(ps, eol - bol + 1, &loc) < 0)
+                return -1;
+            macro_add_line(ps->defining, bol, eol);
+        }
+        if (stmts)
+            statement_table_push(stmts, ps->file, line, ps->curr_seg,
+                ps->curr_addr[ps->curr_seg], 0, bol, eol);
+        return 0;
+    }
+
+    if (*input == '\n') {
+        fprintf(verf, "%d: Empty line\n", line);
+        return 0;
+    }
+    if (*input == '#' || *input == ';') {
+        /* Comment */
+        return 0;
+    }
+
+    /* Labels, any number of them */
+    size_t ll;
+    while ((ll = label_len(input)) > 0 && input[ll] == ':') {
+        if (ps->pool && ps->curr_seg == SEG_DATA) {
+            /* Ends the run before, labels the next data */
+            if (run_close(ps, &loc) < 0)
+                return -1;
+            ps->pending++;
+        }
+        if (ps->passn == 0) {
+            /* Symbol calculation first pass only */
+            if (commit_memory(ps, sizeof(symbol_t) + ll + 1, &loc) < 0)
+                return -1;
+            symbol_t sym;
+            sym.label = strndup(input, ll);
+            sym.address = ps->curr_addr[ps->curr_seg];
+            sym.global = 0;
+            symbol_table_push(segs[ps->curr_seg].symbols, sym);
+            fprintf(verf, "%d:  -> label %s: 0x%.8x\n", line, sym.label,
+                sym.address);
+        }
+        input = strip(input + ll + 1);
+    }
+    loc.stmt = input;
+
+    segid_t stmt_seg = ps->curr_seg;
+    addr_t stmt_addr = ps->curr_addr[ps->curr_seg];
+
+    if (*input == '\n' || *input == '#' || *input == ';') {
+        /* Label only */
+        if (stmts)
+            statement_table_push(stmts, ps->file, line, stmt_seg, stmt_addr,
+                0, bol, eol);
+        return 0;
+    }
+
+    if (*input == '.') {
+        /* Directive */
+        input++; /* skip period */
+        /* Get directive */
+        input = copy_keyword(input, buff, BUFF_SIZE);
         input = strip(input);
-        if (*input == '\n') {
-            fprintf(verf, "%d: Empty line\n", line);
-            input++;
-            line++;
-        }
-        else if (*input == '#' || *input == ';') {
-            /* Comment */
-            input = strchr(input, '\n') + 1;
-            line++;
-        }
-        else {
-            /* Label or instruction or both */
-            size_t ll = label_len(input);
-            if (input[ll] == ':') {
-                /* Label */
-                input = strip(input + ll + 1);
-
-                if (passn == 0) {
-                    /* Symbol calculation first pass only */
-                    symbol_t sym;
-                    sym.label = strndup(input, ll);
-                    sym.address = curr_addr[curr_seg];
-                    symbol_table_push(segs[curr_seg].symbols, sym);
-                    fprintf(verf, "%d:  -> label %s: 0x%.8x\n", line, sym.label,
-                        sym.address);
+        fprintf(verf, "%d: directive: .%s ", line, buff);
+
+        /* Source directives, listed before what they bring in */
+        if (strcmp(buff, "include") == 0) {
+            if (stmts)
+                statement_table_push(stmts, ps->file, line, stmt_seg,
+                    stmt_addr, 0, bol, eol);
+            if (ps->depth == NESTING_MAX) {
+                diagnose(&loc, NULL, D_INCLUDE_DEPTH);
+                return -1;
+            }
+            return include_file(ps, src, input, &loc);
+        } else if (strcmp(buff, "macro") == 0) {
+            size_t nl = label_len(input);
+            memcpy(buff, input, MIN(nl, BUFF_SIZE - 1));
+            buff[MIN(nl, BUFF_SIZE - 1)] = '\0';
+            fprintf(verf, "%s\n", buff);
+
+            macro_t *m;
+            if (ps->passn == 0) {
+                m = macro_table_define(ps->macros, input, eol);
+                if (!m) {
+                    if (nl) diagnose(&loc, input, D_MACRO_REDEFINED, buff);
+                    else diagnose(&loc, input, D_MACRO_NAME);
+                    return -1;
                 }
+            } else {
+                m = find_macro(ps, input, nl);
+                if (!m) return -1;
+            }
+            m->seen_pass = ps->passn;
+            ps->defining = m;
 
-                if (*input == '\n') {
-                    /* End of line */
-                    line++;
-                    input++;
+            if (stmts)
+                statement_table_push(stmts, ps->file, line, stmt_seg,
+                    stmt_addr, 0, bol, eol);
+            return 0;
+        }
+
+        /* Segment directives */
+        if (ps->pool && (strcmp(buff, "data") == 0
+            || strcmp(buff, "text") == 0))
+        {
+            if (run_close(ps, &loc) < 0)
+                return -1;
+            ps->pending = 0;
+        }
+        if (strcmp(buff, "data") == 0) {
+            stmt_seg = ps->curr_seg = SEG_DATA;
+            stmt_addr = ps->curr_addr[ps->curr_seg];
+        } else if (strcmp(buff, "text") == 0) {
+            stmt_seg = ps->curr_seg = SEG_TEXT;
+            stmt_addr = ps->curr_addr[ps->curr_seg];
+        } else if (strcmp(buff, "globl") == 0) {
+            /* Symbols exist from the second pass on */
+            if (ps->passn == 1)
+                mark_global(segs, input, opts, &loc, verf);
+        } else if (strcmp(buff, "extern") == 0) {
+            /* Undefined labels are imported anyway */
+        } else if (strcmp(buff, "endm") == 0) {
+            diagnose(&loc, NULL, D_ENDM_OUTSIDE);
+        } else {
+            /* Data directives, the first after labels opens a run */
+            if (ps->curr_seg == SEG_DATA && ps->pool && ps->pending
+                && run_open(ps, &loc) < 0)
+            {
+                return -1;
+            }
+            datarun_t *run = ps->curr_seg == SEG_DATA && ps->run.labels
+                ? &ps->run : NULL;
+
+            if (run && ps->passn == 1 && ps->merged[run->item]) {
+                /* Shares contents laid out before */
+            } else if (ps->curr_seg == SEG_DATA
+                && strcmp(buff, "incbin") == 0)
+            {
+                if (run) run->mergeable = 0;
+                if (include_binary(ps, src, input, &loc) < 0)
+                    return -1;
+            } else if (ps->curr_seg == SEG_DATA) {
+                addr_t addr = ps->curr_addr[SEG_DATA];
+                addr_t next = next_data_addr(buff, input, addr, &loc);
+
+                if (run && ps->passn == 0
+                    && run_add(ps, buff, input, addr, next, &loc) < 0)
+                {
+                    return -1;
+                }
+
+                /* .space and .align leave zeros, nothing to back */
+                segment_t *seg = &segs[SEG_DATA];
+                if (ps->passn == 1 && strcmp(buff, "space") != 0
+                    && strcmp(buff, "align") != 0)
+                {
+                    uint8_t *to = segment_reserve(ps, seg, addr - seg->org,
+                        next - addr, &loc);
+                    if (!to) return -1;
+                    write_data(to, buff, input, ps->order, &loc, verf);
                 }
-                /* Else, fall to instruction on next iteration */
+                ps->curr_addr[SEG_DATA] = next;
             }
             else {
-                /* Instruction */
-                t = strchr(input, '\n') + 1;
-
-                if (t == (const char*)0x1) /* EOF */
-                    break;
-                
-                if (*input == '.') {
-                    /* Directive */
-                    input++; /* skip period */
-                    /* Get directive */
-                    input = copy_keyword(input, buff, BUFF_SIZE);
-                    input = strip(input);
-                    fprintf(verf, "%d: directive: .%s ", line, buff);
-
-                    /* Segment directives */
-                    if (strcmp(buff, "data") == 0) {
-                        curr_seg = SEG_DATA;
-                    } else if (strcmp(buff, "text") == 0) {
-                        curr_seg = SEG_TEXT;
-                    } else {
-                        /* Data directives */
-                        if (curr_seg == SEG_DATA) {
-                            if (passn == 1)
-                                write_data(segs[0].data, buff, input,
-                                    curr_addr[SEG_DATA], line, verf, errf);
-                            
-                            curr_addr[SEG_DATA] = next_data_addr(buff, input,
-                                curr_addr[SEG_DATA], line, errf);
-                        }
-                        else {
-                            fprintf(errf, "%d: warning: data directive in text "
-                                "segment\n", line, buff);
-                        }
-                    }
-
-                    fprintf(verf, "\n");
-                } else {
-                    /* Instruction */
-                    input = copy_keyword(input, buff, BUFF_SIZE);
-                    fprintf(verf, "%d: instruction: %s ", line, buff);
-                    input = strip(input);
-                    
-                    if (passn == 0) {
-                        if (curr_seg != SEG_TEXT) 
-                            fprintf(errf, "%d: warning: instruction outside "
-                                "text segment\n", line);
-                        else
-                            /* MIPS instructions are 4 bytes */
-                            curr_addr[SEG_TEXT] += 4;  
-                    } else {
-                        encode_instruction(segs,
-                            curr_addr[SEG_TEXT], buff, input, line, verf, errf);
-                        if (curr_seg == SEG_TEXT) curr_addr[SEG_TEXT] += 4;;
-                    }
-                
-                    fprintf(verf, "\n");
+                diagnose(&loc, NULL, D_DATA_IN_TEXT);
+            }
+        }
+
+        fprintf(verf, "\n");
+    } else {
+        /* Macro, once its definition has been met in this pass */
+        size_t nl = label_len(input);
+        if (nl) {
+            macro_t *m = find_macro(ps, input, nl);
+            if (m && m->seen_pass == ps->passn) {
+                if (stmts)
+                    statement_table_push(stmts, ps->file, line, stmt_seg,
+                        stmt_addr, 0, bol, eol);
+                if (ps->depth == NESTING_MAX) {
+                    diagnose(&loc, NULL, D_MACRO_DEPTH);
+                    return -1;
                 }
+                return expand_macro(ps, src, m, strip(input + nl), &loc);
+            }
+        }
+
+        /* Instruction */
+        input = copy_keyword(input, buff, BUFF_SIZE);
+        fprintf(verf, "%d: instruction: %s ", line, buff);
+        input = strip(input);
 
-                input = t;
-                line++;
+        if (ps->passn == 0) {
+            if (ps->curr_seg != SEG_TEXT) {
+                diagnose(&loc, NULL, D_INSTRUCTION_OUTSIDE_TEXT);
+            } else {
+                /* Relaxed beq grow once every target is known */
+                if (strcmp(buff, "beq") == 0 && add_branch(ps, input, &loc) < 0)
+                    return -1;
+                /* MIPS instructions are 4 bytes */
+                ps->curr_addr[SEG_TEXT] += 4;
+            }
+        } else {
+            if (ps->curr_seg == SEG_TEXT) {
+                int relax = strcmp(buff, "beq") == 0
+                    && ps->branches[ps->nbranches++].relaxed;
+                size_t len = relax ? 4 + RELAX_GROWTH : 4;
+                segment_t *seg = &segs[SEG_TEXT];
+                uint8_t *to = segment_reserve(ps, seg,
+                    ps->curr_addr[SEG_TEXT] - seg->org, len, &loc);
+                if (!to) return -1;
+                encode_instruction(segs, to, ps->curr_addr[SEG_TEXT], buff,
+                    input, opts, relax, ps->order, &loc, verf);
+                ps->curr_addr[SEG_TEXT] += len;
             }
         }
+
+        fprintf(verf, "\n");
+    }
+
+    if (stmts)
+        statement_table_push(stmts, ps->file, line, stmt_seg, stmt_addr,
+            ps->curr_addr[stmt_seg] - stmt_addr, bol, eol);
+
+    return 0;
+}
+
+int
+pass_source(pass_state_t *ps, const source_t *src) {
+    int r = 0;
+    uint32_t file = ps->file;
+    if (ps->passn == 1 && ps->stmts && !src->line)
+        ps->file = statement_table_file(ps->stmts, src->name);
+    ps->depth++;
+    for (size_t i = 0; i < src->nlines && r == 0; i++) {
+        /* Line ends from the index, a NUL in the text is no end */
+        size_t next = i + 1 < src->nlines ? src->lines[i + 1] : src->len;
+        r = assemble_line(ps, src, src->data + src->lines[i],
+            src->data + next - 1, src->line ? src->line : i + 1);
+        if (diag_limit_reached(ps->diags)) r = -1; /* give up early */
     }
+    ps->depth--;
+    ps->file = file;
+    return r;
+}
 
-    if (passn == 0) {
-        /* Calculate segment size and allocate segments at first pass */
-        segs[0].size = curr_addr[0] - DATA_ORG;
-        segs[0].data = malloc(segs[0].size);
-        memset(segs[0].data, 0, segs[0].size);
-        segs[1].size = curr_addr[1] - TEXT_ORG;
-        segs[1].data = malloc(segs[1].size);
-        memset(segs[1].data, 0, segs[1].size);
+int
+pass(pass_state_t *ps, const source_t *src) {
+    /* First pass state */
+    ps->curr_seg = SEG_TEXT; /* .text by default */
+    ps->curr_addr[SEG_DATA] = ps->segs[SEG_DATA].org;
+    ps->curr_addr[SEG_TEXT] = ps->segs[SEG_TEXT].org;
+    ps->defining = NULL;
+    ps->depth = 0;
+    ps->nitems = 0;
+    ps->pending = 0;
+    ps->run.labels = 0;
+    ps->nbranches = 0;
+
+    if (pass_source(ps, src) < 0)
+        return -1;
+    srcloc_t end = { src->name, 0, NULL, NULL, NULL, ps->passn, ps->diags };
+    if (ps->pool && run_close(ps, &end) < 0)
+        return -1;
+
+    if (ps->defining) {
+        const char *args[] = { ps->defining->name };
+        diag_add(ps->diags, D_MACRO_UNTERMINATED, src->name, 0, 0, NULL, 0,
+            args);
+        return -1;
+    }
+
+    if (ps->passn == 0) {
+        relax_branches(ps);
+
+        /* Segment sizes from the first pass, their data is allocated as
+            the second one writes it */
+        segment_t *segs = ps->segs;
+        for (segid_t i = SEG_DATA; i <= SEG_TEXT; i++)
+            segs[i].size = ps->curr_addr[i] - segs[i].org;
+
+        /* Labels have their final addresses */
+        if (ps->index)
+            symindex_build(ps->index, segs);
     }
 
     return 0;
 }
 
 int
-assemble(const char *input, size_t ilen, segment_t **output, FILE *verf,
-    FILE *errf)
+assemble(const char *input, size_t ilen, const asm_options_t *opts,
+    segment_t **output, statement_table_t **stmts, symindex_t *index,
+    diag_list_t *diags, FILE *verf)
 {
     /* Init segments */
     segment_t *segs = malloc(2 * sizeof(segment_t));
     for (segid_t i = SEG_DATA; i < SEG_TEXT + 1; i++) {
         segs[i].id = i;
-        segs[i].data = NULL;
+        segs[i].org = i == SEG_DATA ? DATA_ORG : TEXT_ORG;
         segs[i].size = 0;
-        segs[i].capacity = 0;
+        segs[i].extents = NULL;
+        segs[i].nextents = segs[i].extcap = 0;
         segs[i].symbols = symbol_table_new();
+        segs[i].relocs = reloc_table_new();
+    }
+
+    if (stmts) *stmts = statement_table_new();
+    if (index) *index = (symindex_t){ 0 };
+
+    /* Every line must end in a newline */
+    char *copy = NULL;
+    if (ilen > 0 && input[ilen - 1] != '\n') {
+        copy = malloc(ilen + 2);
+        memcpy(copy, input, ilen);
+        copy[ilen++] = '\n';
+        copy[ilen] = '\0';
+        input = copy;
     }
 
+    /* Included files, private unless the caller keeps them across runs */
+    filecache_t owncache;
+    filecache_t *cache = opts->cache;
+    if (!cache) {
+        filecache_init(&owncache);
+        cache = &owncache;
+    }
+
+    /* Lines of the input, split already if it came from the cache */
+    source_t src = { opts->filename, input, ilen, NULL, 0, 0 };
+    uint32_t *lines = NULL;
+    cached_file_t *cf = opts->cache && opts->filename
+        ? filecache_get(opts->cache, opts->filename) : NULL;
+    if (cf && cf->data == input) {
+        src.lines = cf->lines;
+        src.nlines = cf->nlines;
+    } else {
+        src.nlines = split_lines(input, ilen, &lines);
+        src.lines = lines;
+    }
+
+    /* Diagnostics, kept only for the error count if unwanted */
+    diag_list_t owndiags;
+    if (!diags) {
+        diag_list_init(&owndiags, 0);
+        diags = &owndiags;
+    }
+
+    macro_table_t macros;
+    macro_table_init(&macros);
+
+    datapool_t pool;
+    if (opts->merge_strings)
+        datapool_init(&pool);
+
+    pass_state_t ps = { 0, segs, opts, stmts ? *stmts : NULL, cache, &macros,
+        NULL, SEG_TEXT, { 0, 0 }, 0, 0, opts->merge_strings ? &pool : NULL,
+        NULL, 0, 0, 0, { 0 }, NULL, 0, 0, 0, index, 0,
+        byteorder(opts->endian == ENDIAN_BIG), diags, verf };
+
     /* Two passes */
-    for (int i = 0; i < 2; i++) {
+    int err = 0;
+    for (int i = 0; i < 2 && err == 0; i++) {
         if (i == 0)
             fprintf(verf, "=== FIRST PASS ===\n");
         else
             fprintf(verf, "=== SECOND PASS ===\n");
-        
-        int err = pass(i, input, ilen, segs, verf, errf);
-        if (err < 0) {
-            return err;
-        }
-            
+
+        ps.passn = i;
+        err = pass(&ps, &src);
+
         fprintf(verf, "\n");
     }
+    /* Errors that did not stop a pass still leave no usable output */
+    if (diags->errors) err = -1;
+
+    if (opts->merge_strings) {
+        if (err == 0) {
+            char merged[24], saved[24];
+            snprintf(merged, sizeof(merged), "%zu", pool.merged);
+            snprintf(saved, sizeof(saved), "%zu", pool.saved);
+            const char *args[] = { merged, saved };
+            diag_add(diags, D_MERGED_DATA, NULL, 0, 0, NULL, 0, args);
+        }
+        datapool_destroy(&pool);
+    }
+    if (err == 0 && ps.relaxed) {
+        char relaxed[24], added[24];
+        snprintf(relaxed, sizeof(relaxed), "%zu", ps.relaxed);
+        snprintf(added, sizeof(added), "%zu", ps.relaxed * RELAX_GROWTH);
+        const char *args[] = { relaxed, added };
+        diag_add(diags, D_RELAXED_BRANCHES, NULL, 0, 0, NULL, 0, args);
+    }
+    free(ps.merged);
+    free(ps.run.data);
+    for (size_t i = 0; i < ps.nbranches; i++)
+        free(ps.branches[i].label); /* left if the first pass failed */
+    free(ps.branches);
+    macro_table_destroy(&macros);
+    if (cache == &owncache)
+        filecache_destroy(&owncache);
+    if (diags == &owndiags)
+        diag_list_destroy(&owndiags);
+    free(lines);
+    free(copy);
+
+    if (err < 0) {
+        segment_destroy(&segs[SEG_DATA]);
+        segment_destroy(&segs[SEG_TEXT]);
+        free(segs);
+        if (stmts) {
+            statement_table_destroy(*stmts);
+            *stmts = NULL;
+        }
+        if (index)
+            symindex_destroy(index);
+        return err;
+    }
 
     *output = segs;
 
@@ -24,6 +24,9 @@
 #include <stdio.h>
 #include <stdint.h>
 
+#include "filecache.h"
+#include "diag.h"
+
 /* Macros */
 
 #define DATA_ORG    0x10010000
@@ -37,9 +40,12 @@ typedef uint8_t reg_t;
 
 typedef enum { SEG_DATA, SEG_TEXT } segid_t;
 
+typedef enum { ENDIAN_LITTLE, ENDIAN_BIG } endian_t;
+
 typedef struct {
     addr_t address;
     char *label;
+    int global;         /* exported with .globl */
 } symbol_t;
 
 typedef struct {
@@ -48,19 +54,111 @@ typedef struct {
     size_t capacity;
 } symbol_table_t;
 
+/* Label reference left for the linker, see doc/OBJECT.md */
+typedef enum {
+    RELOC_PC16,         /* beq offset */
+    RELOC_J26,          /* j target */
+    RELOC_HI16,         /* lui %hi() */
+    RELOC_LO16          /* ori %lo() */
+} reloc_type_t;
+
 typedef struct {
-    segid_t id;
-    uint8_t *data;
+    addr_t offset;      /* of the instruction, from the segment origin */
+    reloc_type_t type;
+    char *label;
+} reloc_t;
+
+typedef struct {
+    reloc_t *table;
     size_t size;
     size_t capacity;
+} reloc_table_t;
+
+/* Stored run of segment bytes */
+typedef struct {
+    size_t off;         /* from the segment origin */
+    size_t len;
+    size_t cap;         /* bytes allocated */
+    uint8_t *data;
+} extent_t;
+
+typedef struct {
+    segid_t id;
+    addr_t org;
+    size_t size;
+    extent_t *extents;  /* by offset, the holes between them are zero */
+    size_t nextents;
+    size_t extcap;
     symbol_table_t *symbols;
+    reloc_table_t *relocs;
 } segment_t;
 
+typedef struct {
+    int relocatable;    /* record label references as relocations */
+    const char *filename; /* of the input, includes are relative to it */
+    filecache_t *cache; /* included files, kept across runs, may be NULL */
+    int merge_strings;  /* share contents of identical labelled data */
+    size_t max_memory;  /* bytes for segments, symbols, statements,
+                            macros, branches and merged data, 0 for no
+                            limit */
+    endian_t endian;    /* byte order of halves and words in the segments */
+} asm_options_t;
+
+/* Assembled source line, for listings */
+typedef struct {
+    uint32_t file;      /* index into the table files */
+    size_t line;
+    segid_t seg;
+    addr_t address;
+    size_t size;        /* bytes emitted */
+    size_t srcoff;      /* source line, in the table text */
+    size_t srclen;
+} statement_t;
+
+typedef struct {
+    statement_t *table;
+    size_t size;
+    size_t capacity;
+    char *text;         /* copies of the source lines */
+    size_t textlen;
+    size_t textcap;
+    char **files;       /* source file names */
+    size_t nfiles;
+} statement_table_t;
+
+/* Symbols by address, see symindex.h */
+typedef struct symindex symindex_t;
+
 /* Routines */
 
+symbol_table_t *symbol_table_new();
+void symbol_table_destroy(symbol_table_t *st);
+void symbol_table_push(symbol_table_t *st, symbol_t sym);
+symbol_t *symbol_table_find(symbol_table_t *st, const char *label);
+
+reloc_table_t *reloc_table_new();
+void reloc_table_destroy(reloc_table_t *rt);
+void reloc_table_push(reloc_table_t *rt, addr_t offset, reloc_type_t type,
+    const char *label);
+
 void segment_destroy(segment_t *seg);
 
-int assemble(const char *input, size_t ilen, segment_t **output, FILE *verf,
-    FILE *errf);
+/* Bytes at off: the stored ones, with their number in n, or NULL with the
+    number of zeros up to the next stored byte or the end in n */
+const uint8_t *segment_span(const segment_t *seg, size_t off, size_t *n);
+
+/* Copy n bytes from off into buf, holes as zeros */
+void segment_read(const segment_t *seg, size_t off, uint8_t *buf, size_t n);
+
+/* Store the whole size as one zeroed run, as a linker fills it. Returns it,
+    or NULL if out of memory */
+uint8_t *segment_whole(segment_t *seg);
+void statement_table_destroy(statement_table_t *st);
+
+/* Diagnostics go to diags, which may be NULL, fails if any is an error.
+    If index is not NULL it gets the symbols by address */
+int assemble(const char *input, size_t ilen, const asm_options_t *opts,
+    segment_t **output, statement_table_t **stmts, symindex_t *index,
+    diag_list_t *diags, FILE *verf);
 
 #endif /* _ASSEMBLER_H */
\ No newline at end of file
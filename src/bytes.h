@@ -0,0 +1,94 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _BYTES_H
+#define _BYTES_H
+
+#include <stdint.h>
+
+/* Byte order independent loads and stores, safe on unaligned pointers */
+
+static inline void
+put_u16le(uint8_t *p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static inline void
+put_u32le(uint8_t *p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+static inline uint16_t
+get_u16le(const uint8_t *p) {
+    return p[0] | p[1] << 8;
+}
+
+static inline uint32_t
+get_u32le(const uint8_t *p) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline void
+put_u16be(uint8_t *p, uint16_t v) {
+    p[0] = v >> 8;
+    p[1] = v;
+}
+
+static inline void
+put_u32be(uint8_t *p, uint32_t v) {
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static inline uint16_t
+get_u16be(const uint8_t *p) {
+    return p[0] << 8 | p[1];
+}
+
+static inline uint32_t
+get_u32be(const uint8_t *p) {
+    return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+/* Loads and stores of one byte order, picked once per run so loops over
+    many values call them without testing the order each time */
+typedef struct {
+    void (*put16)(uint8_t *p, uint16_t v);
+    void (*put32)(uint8_t *p, uint32_t v);
+    uint16_t (*get16)(const uint8_t *p);
+    uint32_t (*get32)(const uint8_t *p);
+} byteorder_t;
+
+static inline const byteorder_t *
+byteorder(int big) {
+    static const byteorder_t le = { put_u16le, put_u32le, get_u16le,
+        get_u32le };
+    static const byteorder_t be = { put_u16be, put_u32be, get_u16be,
+        get_u32be };
+    return big ? &be : &le;
+}
+
+#endif /* _BYTES_H */
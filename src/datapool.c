@@ -0,0 +1,159 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    datapool.c: Pool of data contents, for merging identical items
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "datapool.h"
+
+/* Tunables */
+#define DATAPOOL_INIT_SIZE  64      /* entries */
+#define DATAPOOL_BYTES_INIT 1024    /* bytes */
+
+/* FNV-1a over the bytes from last to first, so the hashes of every
+    suffix come out of a single sweep */
+#define HASH_INIT   2166136261u
+#define HASH_STEP(h, b) (((h) ^ (b)) * 16777619u)
+
+/* Empty, allocated by the first add so that is accounted for too */
+void
+datapool_init(datapool_t *dp) {
+    dp->bytes = NULL;
+    dp->len = 0;
+    dp->cap = 0;
+    dp->table = NULL;
+    dp->size = 0;
+    dp->capacity = 0;
+    dp->merged = dp->saved = 0;
+}
+
+void
+datapool_destroy(datapool_t *dp) {
+    free(dp->bytes);
+    free(dp->table);
+    dp->bytes = NULL;
+    dp->table = NULL;
+    dp->size = dp->capacity = 0;
+}
+
+static datapool_entry_t *
+datapool_slot(datapool_entry_t *table, size_t capacity, const uint8_t *bytes,
+    const uint8_t *data, size_t len, uint32_t h)
+{
+    size_t i = h & (capacity - 1);
+    while (table[i].len
+        && (table[i].hash != h || table[i].len != len
+            || memcmp(bytes + table[i].off, data, len) != 0))
+    {
+        i = (i + 1) & (capacity - 1);
+    }
+    return &table[i];
+}
+
+int
+datapool_find(datapool_t *dp, const uint8_t *data, size_t len, addr_t addr,
+    size_t align, addr_t *found)
+{
+    if (!dp->size) return 0;
+
+    uint32_t h = HASH_INIT;
+    for (size_t i = len; i > 0; i--)
+        h = HASH_STEP(h, data[i - 1]);
+
+    datapool_entry_t *e = datapool_slot(dp->table, dp->capacity, dp->bytes,
+        data, len, h);
+    if (!e->len || (e->addr - addr) % align != 0)
+        return 0;
+
+    *found = e->addr;
+    dp->merged++;
+    dp->saved += len;
+    return 1;
+}
+
+/* Sizes the pool grows to for n more bytes and entries */
+static void
+datapool_sizes(const datapool_t *dp, size_t n, size_t entries, size_t *cap,
+    size_t *ncap)
+{
+    *cap = dp->cap ? dp->cap : DATAPOOL_BYTES_INIT;
+    while (dp->len + n > *cap) *cap *= 2;
+
+    /* Keep load under 1/2 */
+    *ncap = dp->capacity ? dp->capacity : DATAPOOL_INIT_SIZE;
+    while (2 * (dp->size + entries) > *ncap) *ncap *= 2;
+}
+
+size_t
+datapool_growth(const datapool_t *dp, size_t len, int suffixes) {
+    size_t cap, ncap;
+    datapool_sizes(dp, len, suffixes ? len : 1, &cap, &ncap);
+    return cap - dp->cap + (ncap - dp->capacity) * sizeof(datapool_entry_t);
+}
+
+int
+datapool_add(datapool_t *dp, const uint8_t *data, size_t len, addr_t addr,
+    int suffixes)
+{
+    if (len == 0) return 0;
+
+    size_t cap, ncap;
+    datapool_sizes(dp, len, suffixes ? len : 1, &cap, &ncap);
+    if (cap != dp->cap) {
+        uint8_t *bytes = realloc(dp->bytes, cap);
+        if (!bytes) return -1;
+        dp->bytes = bytes;
+        dp->cap = cap;
+    }
+    if (ncap != dp->capacity) {
+        datapool_entry_t *nt = calloc(ncap, sizeof(datapool_entry_t));
+        if (!nt) return -1;
+        for (size_t i = 0; i < dp->capacity; i++) {
+            datapool_entry_t *e = &dp->table[i];
+            if (e->len)
+                *datapool_slot(nt, ncap, dp->bytes, dp->bytes + e->off,
+                    e->len, e->hash) = *e;
+        }
+        free(dp->table);
+        dp->table = nt;
+        dp->capacity = ncap;
+    }
+
+    uint32_t off = dp->len;
+    memcpy(dp->bytes + off, data, len);
+    dp->len += len;
+
+    /* Longest last, so the hash of each suffix builds on the shorter */
+    uint32_t h = HASH_INIT;
+    for (size_t i = len; i > 0; i--) {
+        h = HASH_STEP(h, data[i - 1]);
+        if (!suffixes && i > 1) continue;
+
+        size_t sl = len - (i - 1);
+        datapool_entry_t *e = datapool_slot(dp->table, dp->capacity,
+            dp->bytes, data + i - 1, sl, h);
+        if (e->len) continue; /* already there, earlier copy wins */
+        *e = (datapool_entry_t){ off + i - 1, sl, h, addr + i - 1 };
+        dp->size++;
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _DATAPOOL_H
+#define _DATAPOOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "assembler.h"
+
+/* Types */
+
+typedef struct {
+    uint32_t off;       /* contents, in the pool bytes */
+    uint32_t len;       /* 0 for free slots */
+    uint32_t hash;
+    addr_t addr;
+} datapool_entry_t;
+
+/* Contents of laid out data items by hash, for --merge-strings */
+typedef struct {
+    uint8_t *bytes;     /* copies of the items */
+    size_t len;
+    size_t cap;
+    datapool_entry_t *table;
+    size_t size;
+    size_t capacity;    /* power of 2 */
+    size_t merged;      /* items */
+    size_t saved;       /* bytes */
+} datapool_t;
+
+/* Routines */
+
+void datapool_init(datapool_t *dp);
+void datapool_destroy(datapool_t *dp);
+
+/* Address of identical contents laid out before, at the same alignment
+    as addr. 1 if found, 0 otherwise */
+int datapool_find(datapool_t *dp, const uint8_t *data, size_t len,
+    addr_t addr, size_t align, addr_t *found);
+
+/* Bytes datapool_add() would allocate for an item of len */
+size_t datapool_growth(const datapool_t *dp, size_t len, int suffixes);
+
+/* Add an item at addr, and every suffix of it too for strings. 0, or -1
+    if out of memory, leaving the pool as it was */
+int datapool_add(datapool_t *dp, const uint8_t *data, size_t len,
+    addr_t addr, int suffixes);
+
+#endif /* _DATAPOOL_H */
@@ -0,0 +1,322 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    diag.c: Diagnostics, collected and formatted on output
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "diag.h"
+
+/* Tunables */
+#define DIAG_LIST_INIT_SIZE 16      /* diagnostics */
+#define DIAG_POOL_INIT_SIZE 1024    /* bytes */
+
+typedef struct {
+    diag_severity_t severity;
+    int pass;           /* that checks for it, -1 for any */
+    int nargs;
+    const char *name;
+    const char *msg;    /* %s for each argument */
+} diag_info_t;
+
+static const diag_info_t diag_info[D_CODES] = {
+    [D_EXPECTED_STRING] = { DIAG_WARNING, 0, 0, "expected-string",
+        "expected string literal" },
+    [D_EXPECTED_QUOTE] = { DIAG_WARNING, 0, 0, "expected-quote",
+        "expected \"" },
+    [D_UNKNOWN_ALIGNMENT] = { DIAG_WARNING, 0, 0, "unknown-alignment",
+        "unknown alignment" },
+    [D_UNKNOWN_DIRECTIVE] = { DIAG_WARNING, 0, 1, "unknown-directive",
+        "unknown data directive .%s" },
+    [D_EXPECTED_COMMA] = { DIAG_WARNING, 1, 0, "expected-comma",
+        "expected ," },
+    [D_EXPECTED_REGISTER] = { DIAG_ERROR, 1, 0, "expected-register",
+        "expected register" },
+    [D_UNKNOWN_REGISTER] = { DIAG_ERROR, 1, 1, "unknown-register",
+        "unknown register %s" },
+    [D_EXPECTED_HILO] = { DIAG_ERROR, 1, 0, "expected-hilo",
+        "expected %hi() or %lo()" },
+    [D_EXPECTED_LPAREN] = { DIAG_ERROR, 1, 0, "expected-lparen",
+        "expected (" },
+    [D_EXPECTED_RPAREN] = { DIAG_WARNING, 1, 0, "expected-rparen",
+        "expected )" },
+    [D_UNKNOWN_INSTRUCTION] = { DIAG_ERROR, 1, 1, "unknown-instruction",
+        "unknown instruction %s" },
+    [D_UNDEFINED_LABEL] = { DIAG_ERROR, 1, 1, "undefined-label",
+        "undefined label %s" },
+    [D_UNDEFINED_GLOBAL] = { DIAG_WARNING, 1, 1, "undefined-global",
+        "undefined global %s" },
+    [D_CANNOT_READ] = { DIAG_ERROR, -1, 2, "cannot-read",
+        "cannot read %s: %s" },
+    [D_INCBIN_RANGE] = { DIAG_ERROR, -1, 1, "incbin-range",
+        ".incbin range outside %s" },
+    [D_TOO_MANY_ARGUMENTS] = { DIAG_WARNING, 0, 1, "too-many-arguments",
+        "too many arguments to %s" },
+    [D_INCLUDE_DEPTH] = { DIAG_ERROR, -1, 0, "include-depth",
+        "includes nested too deep" },
+    [D_MACRO_DEPTH] = { DIAG_ERROR, -1, 0, "macro-depth",
+        "macros nested too deep" },
+    [D_MACRO_REDEFINED] = { DIAG_ERROR, 0, 1, "macro-redefined",
+        "macro %s redefined" },
+    [D_MACRO_NAME] = { DIAG_ERROR, 0, 0, "macro-name",
+        "expected macro name" },
+    [D_MACRO_UNTERMINATED] = { DIAG_ERROR, -1, 1, "macro-unterminated",
+        ".macro %s without .endm" },
+    [D_ENDM_OUTSIDE] = { DIAG_WARNING, 0, 0, "endm-outside",
+        ".endm outside a macro" },
+    [D_DATA_IN_TEXT] = { DIAG_WARNING, 0, 0, "data-in-text",
+        "data directive in text segment" },
+    [D_INSTRUCTION_OUTSIDE_TEXT] = { DIAG_WARNING, 0, 0,
+        "instruction-outside-text", "instruction outside text segment" },
+    [D_MERGED_DATA] = { DIAG_NOTE, 1, 2, "merged-data",
+        "merged %s data items, %s bytes saved" },
+    [D_MEMORY_LIMIT] = { DIAG_ERROR, -1, 2, "memory-limit",
+        "%s more bytes would go over the memory limit of %s" },
+    [D_JUMP_REGION] = { DIAG_ERROR, 1, 1, "jump-region",
+        "jump to %s leaves its 256 MB region" },
+    [D_RELAXED_BRANCHES] = { DIAG_NOTE, 1, 2, "relaxed-branches",
+        "relaxed %s beq out of range into beq and j, %s bytes added" },
+    [D_EXPECTED_NUMBER] = { DIAG_ERROR, 1, 0, "expected-number",
+        "expected number" },
+    [D_OUT_OF_MEMORY] = { DIAG_ERROR, -1, 1, "out-of-memory",
+        "out of memory for %s more bytes" },
+    [D_ADDRESS_RANGE] = { DIAG_ERROR, 0, 1, "address-range",
+        "%s goes past the end of the address space" },
+};
+
+static const char *severity_names[] = { "note", "warning", "error" };
+
+void
+diag_list_init(diag_list_t *dl, size_t max_errors) {
+    dl->table = malloc(DIAG_LIST_INIT_SIZE * sizeof(diag_t));
+    dl->size = 0;
+    dl->capacity = DIAG_LIST_INIT_SIZE;
+    dl->pool = malloc(DIAG_POOL_INIT_SIZE);
+    dl->poollen = 0;
+    dl->poolcap = DIAG_POOL_INIT_SIZE;
+    dl->errors = dl->warnings = 0;
+    dl->max_errors = max_errors;
+    dl->lastfile = NULL;
+    dl->lastfileoff = DIAG_NONE;
+}
+
+void
+diag_list_destroy(diag_list_t *dl) {
+    free(dl->table);
+    free(dl->pool);
+    dl->table = NULL;
+    dl->pool = NULL;
+    dl->size = dl->capacity = 0;
+}
+
+diag_severity_t
+diag_severity(diag_code_t code) {
+    return diag_info[code].severity;
+}
+
+const char *
+diag_name(diag_code_t code) {
+    return diag_info[code].name;
+}
+
+int
+diag_pass(diag_code_t code) {
+    return diag_info[code].pass;
+}
+
+int
+diag_nargs(diag_code_t code) {
+    return diag_info[code].nargs;
+}
+
+/* Offset of a copy of s, DIAG_NONE if it does not fit in 32 bits or
+    memory */
+static uint32_t
+pool_add(diag_list_t *dl, const char *s, size_t len) {
+    if (len >= DIAG_NONE - 1 - dl->poollen) return DIAG_NONE;
+    size_t need = dl->poollen + len + 1;
+    if (need > dl->poolcap) {
+        size_t cap = dl->poolcap;
+        while (cap < need) cap *= 2;
+        char *pool = realloc(dl->pool, cap);
+        if (!pool) return DIAG_NONE;
+        dl->pool = pool;
+        dl->poolcap = cap;
+    }
+    uint32_t off = dl->poollen;
+    memcpy(dl->pool + off, s, len);
+    dl->pool[off + len] = '\0';
+    dl->poollen += len + 1;
+    return off;
+}
+
+void
+diag_add(diag_list_t *dl, diag_code_t code, const char *file, size_t line,
+    size_t col, const char *src, size_t srclen, const char **args)
+{
+    if (diag_limit_reached(dl)) return;
+
+    if (dl->size == dl->capacity) {
+        diag_t *table = realloc(dl->table, 2 * dl->capacity * sizeof(diag_t));
+        if (!table) {
+            /* Still counted, an error must fail the run */
+            if (diag_info[code].severity == DIAG_ERROR) dl->errors++;
+            else if (diag_info[code].severity == DIAG_WARNING) dl->warnings++;
+            return;
+        }
+        dl->table = table;
+        dl->capacity *= 2;
+    }
+    diag_t *d = &dl->table[dl->size];
+    d->code = code;
+    d->severity = diag_info[code].severity;
+    d->nargs = diag_info[code].nargs;
+    d->line = line;
+    d->col = col;
+
+    /* Several diagnostics on a line share its file name and text */
+    if (!file) {
+        d->file = DIAG_NONE;
+    } else if (file == dl->lastfile) {
+        d->file = dl->lastfileoff;
+    } else {
+        d->file = pool_add(dl, file, strlen(file));
+        if (d->file != DIAG_NONE) {
+            dl->lastfile = file;
+            dl->lastfileoff = d->file;
+        }
+    }
+    const diag_t *prev = dl->size ? d - 1 : NULL;
+    if (!src) {
+        d->src = DIAG_NONE;
+        d->srclen = 0;
+    } else if (prev && prev->src != DIAG_NONE && prev->file == d->file
+        && prev->line == line && prev->srclen == srclen)
+    {
+        d->src = prev->src;
+        d->srclen = srclen;
+    } else {
+        d->src = pool_add(dl, src, srclen);
+        d->srclen = d->src != DIAG_NONE ? srclen : 0;
+    }
+
+    for (int i = 0; i < d->nargs; i++)
+        d->args[i] = pool_add(dl, args[i], strlen(args[i]));
+
+    dl->size++;
+    if (d->severity == DIAG_ERROR) dl->errors++;
+    else if (d->severity == DIAG_WARNING) dl->warnings++;
+}
+
+static const char *
+pool_str(const diag_list_t *dl, uint32_t off) {
+    return off != DIAG_NONE ? dl->pool + off : "";
+}
+
+/* Message with the arguments in place of each %s */
+static void
+print_message(const diag_list_t *dl, const diag_t *d, FILE *f,
+    void (*put)(const char *s, size_t len, FILE *f))
+{
+    const char *msg = diag_info[d->code].msg, *p;
+    int arg = 0;
+    while ((p = strstr(msg, "%s")) && arg < d->nargs) {
+        put(msg, p - msg, f);
+        const char *a = pool_str(dl, d->args[arg++]);
+        put(a, strlen(a), f);
+        msg = p + 2;
+    }
+    put(msg, strlen(msg), f);
+}
+
+static void
+put_plain(const char *s, size_t len, FILE *f) {
+    fwrite(s, 1, len, f);
+}
+
+void
+diag_print(const diag_list_t *dl, FILE *f) {
+    for (size_t i = 0; i < dl->size; i++) {
+        const diag_t *d = &dl->table[i];
+        if (d->file != DIAG_NONE) fprintf(f, "%s:", dl->pool + d->file);
+        if (d->line) fprintf(f, "%u:%u:", d->line, d->col);
+        if (d->file != DIAG_NONE || d->line) fputc(' ', f);
+        fprintf(f, "%s: ", severity_names[d->severity]);
+        print_message(dl, d, f, put_plain);
+        fputc('\n', f);
+
+        if (d->src == DIAG_NONE) continue;
+        const char *src = dl->pool + d->src;
+        fprintf(f, "%s\n", src);
+        /* Caret lined up under tabs too */
+        for (uint32_t c = 1; c < d->col && c <= d->srclen; c++)
+            fputc(src[c - 1] == '\t' ? '\t' : ' ', f);
+        fputs("^\n", f);
+    }
+    if (diag_limit_reached(dl))
+        fprintf(f, "too many errors, stopped after %zu\n", dl->errors);
+}
+
+static void
+put_json(const char *s, size_t len, FILE *f) {
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = s[i];
+        if (c == '"' || c == '\\') fprintf(f, "\\%c", c);
+        else if (c == '\n') fputs("\\n", f);
+        else if (c == '\t') fputs("\\t", f);
+        else if (c < 0x20) fprintf(f, "\\u%04x", c);
+        else fputc(c, f);
+    }
+}
+
+static void
+json_string(const char *s, FILE *f) {
+    fputc('"', f);
+    put_json(s, strlen(s), f);
+    fputc('"', f);
+}
+
+void
+diag_print_json(const diag_list_t *dl, FILE *f) {
+    fputs("{\"diagnostics\":[", f);
+    for (size_t i = 0; i < dl->size; i++) {
+        const diag_t *d = &dl->table[i];
+        fprintf(f, "%s{\"severity\":\"%s\",\"code\":\"%s\"", i ? "," : "",
+            severity_names[d->severity], diag_info[d->code].name);
+        if (d->file != DIAG_NONE) {
+            fputs(",\"file\":", f);
+            json_string(dl->pool + d->file, f);
+        }
+        if (d->line)
+            fprintf(f, ",\"line\":%u,\"column\":%u", d->line, d->col);
+
+        fputs(",\"message\":\"", f);
+        print_message(dl, d, f, put_json);
+        fputs("\",\"args\":[", f);
+        for (int a = 0; a < d->nargs; a++) {
+            if (a) fputc(',', f);
+            json_string(pool_str(dl, d->args[a]), f);
+        }
+        fputs("]}", f);
+    }
+    fprintf(f, "],\"errors\":%zu,\"warnings\":%zu,\"truncated\":%s}\n",
+        dl->errors, dl->warnings, diag_limit_reached(dl) ? "true" : "false");
+}
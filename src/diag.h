@@ -0,0 +1,129 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _DIAG_H
+#define _DIAG_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Macros */
+
+#define DIAG_ARGS_MAX   2
+#define DIAG_NONE       0xffffffff  /* no file or source line */
+
+/* Types */
+
+typedef enum { DIAG_NOTE, DIAG_WARNING, DIAG_ERROR } diag_severity_t;
+
+typedef enum {
+    D_EXPECTED_STRING,
+    D_EXPECTED_QUOTE,
+    D_UNKNOWN_ALIGNMENT,
+    D_UNKNOWN_DIRECTIVE,
+    D_EXPECTED_COMMA,
+    D_EXPECTED_REGISTER,
+    D_UNKNOWN_REGISTER,
+    D_EXPECTED_HILO,
+    D_EXPECTED_LPAREN,
+    D_EXPECTED_RPAREN,
+    D_UNKNOWN_INSTRUCTION,
+    D_UNDEFINED_LABEL,
+    D_UNDEFINED_GLOBAL,
+    D_CANNOT_READ,
+    D_INCBIN_RANGE,
+    D_TOO_MANY_ARGUMENTS,
+    D_INCLUDE_DEPTH,
+    D_MACRO_DEPTH,
+    D_MACRO_REDEFINED,
+    D_MACRO_NAME,
+    D_MACRO_UNTERMINATED,
+    D_ENDM_OUTSIDE,
+    D_DATA_IN_TEXT,
+    D_INSTRUCTION_OUTSIDE_TEXT,
+    D_MERGED_DATA,
+    D_MEMORY_LIMIT,
+    D_JUMP_REGION,
+    D_RELAXED_BRANCHES,
+    D_EXPECTED_NUMBER,
+    D_OUT_OF_MEMORY,
+    D_ADDRESS_RANGE,
+    D_CODES
+} diag_code_t;
+
+/* Diagnostic as recorded, the message is only formatted when printed */
+typedef struct {
+    uint16_t code;
+    uint8_t severity;
+    uint8_t nargs;
+    uint32_t file;      /* name, in the pool, or DIAG_NONE */
+    uint32_t line;      /* 0 if none */
+    uint32_t col;
+    uint32_t src;       /* source line, in the pool, or DIAG_NONE */
+    uint32_t srclen;
+    uint32_t args[DIAG_ARGS_MAX]; /* in the pool */
+} diag_t;
+
+typedef struct {
+    diag_t *table;
+    size_t size;
+    size_t capacity;
+    char *pool;         /* NUL terminated strings */
+    size_t poollen;
+    size_t poolcap;
+    size_t errors;
+    size_t warnings;
+    size_t max_errors;  /* stop recording after that many, 0 for no limit */
+    const char *lastfile; /* last interned, usually the same again */
+    uint32_t lastfileoff;
+} diag_list_t;
+
+/* Routines */
+
+void diag_list_init(diag_list_t *dl, size_t max_errors);
+void diag_list_destroy(diag_list_t *dl);
+
+diag_severity_t diag_severity(diag_code_t code);
+const char *diag_name(diag_code_t code);
+
+/* Assembler pass that checks for it, so it is reported once, -1 if it
+    stops assembly in whichever pass it happens */
+int diag_pass(diag_code_t code);
+int diag_nargs(diag_code_t code);
+
+/* Record a diagnostic with code's number of string arguments. file and
+    src may be NULL. Nothing is recorded past the error limit */
+void diag_add(diag_list_t *dl, diag_code_t code, const char *file,
+    size_t line, size_t col, const char *src, size_t srclen,
+    const char **args);
+
+static inline int
+diag_limit_reached(const diag_list_t *dl) {
+    return dl->max_errors && dl->errors >= dl->max_errors;
+}
+
+/* file:line:col: severity: message, the line and a caret */
+void diag_print(const diag_list_t *dl, FILE *f);
+
+/* {"diagnostics":[...],"errors":n,"warnings":n} */
+void diag_print_json(const diag_list_t *dl, FILE *f);
+
+#endif /* _DIAG_H */
@@ -0,0 +1,286 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    elfout.c: ELF32 MIPS output
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "elfout.h"
+#include "bytes.h"
+#include "strmap.h"
+
+/* ELF constants, not taken from <elf.h> to stay portable */
+#define ET_REL          1
+#define ET_EXEC         2
+#define EM_MIPS         8
+#define EF_MIPS_ABI_O32 0x00001000
+#define PT_LOAD         1
+#define PF_X            1
+#define PF_W            2
+#define PF_R            4
+#define SHT_PROGBITS    1
+#define SHT_SYMTAB      2
+#define SHT_STRTAB      3
+#define SHT_REL         9
+#define SHF_WRITE       1
+#define SHF_ALLOC       2
+#define SHF_EXECINSTR   4
+#define STB_LOCAL       0
+#define STB_GLOBAL      1
+#define STT_NOTYPE      0
+#define STT_OBJECT      1
+#define R_MIPS_26       4
+#define R_MIPS_HI16     5
+#define R_MIPS_LO16     6
+#define R_MIPS_PC16     10
+
+/* Sizes in the file */
+#define EHDR_SIZE       52
+#define PHDR_SIZE       32
+#define SHDR_SIZE       40
+#define SYM_SIZE        16
+#define REL_SIZE        8
+
+#define PAGE_SIZE       0x1000  /* load segment alignment */
+
+/* Section indices */
+enum { SH_NULL, SH_TEXT, SH_DATA, SH_SYMTAB, SH_STRTAB, SH_SHSTRTAB, SH_REL,
+    SH_MAX };
+
+static const char shstrtab[] =
+    "\0.text\0.data\0.symtab\0.strtab\0.shstrtab\0.rel.text";
+static const uint32_t shname[SH_MAX] = { 0, 1, 7, 13, 21, 29, 39 };
+
+/* Nearest ELF types only: %hi() pairs with ori, so it has no carry from
+    bit 15, while standard linkers apply R_MIPS_HI16 with one */
+static const uint8_t reloc_elf_type[] = {
+    [RELOC_PC16] = R_MIPS_PC16,
+    [RELOC_J26] = R_MIPS_26,
+    [RELOC_HI16] = R_MIPS_HI16,
+    [RELOC_LO16] = R_MIPS_LO16,
+};
+
+static size_t
+align(size_t x, size_t a) {
+    return (x + a - 1) & ~(a - 1);
+}
+
+static const byteorder_t *bo; /* of the image being built */
+
+static void
+put_shdr(uint8_t *p, uint32_t name, uint32_t type, uint32_t flags,
+    addr_t addr, size_t off, size_t size, uint32_t link, uint32_t info,
+    uint32_t addralign, uint32_t entsize)
+{
+    bo->put32(p, name);
+    bo->put32(p + 4, type);
+    bo->put32(p + 8, flags);
+    bo->put32(p + 12, addr);
+    bo->put32(p + 16, off);
+    bo->put32(p + 20, size);
+    bo->put32(p + 24, link);
+    bo->put32(p + 28, info);
+    bo->put32(p + 32, addralign);
+    bo->put32(p + 36, entsize);
+}
+
+static void
+put_phdr(uint8_t *p, size_t off, addr_t addr, size_t size, uint32_t flags) {
+    bo->put32(p, PT_LOAD);
+    bo->put32(p + 4, off);
+    bo->put32(p + 8, addr);
+    bo->put32(p + 12, addr);
+    bo->put32(p + 16, size);
+    bo->put32(p + 20, size);
+    bo->put32(p + 24, flags);
+    bo->put32(p + 28, PAGE_SIZE);
+}
+
+uint8_t *
+elf_build(segment_t *segs, int relocatable, endian_t end, size_t *len) {
+    bo = byteorder(end == ENDIAN_BIG);
+    segment_t *text = &segs[SEG_TEXT], *data = &segs[SEG_DATA];
+    reloc_table_t *rt = text->relocs;
+    size_t nrel = relocatable ? rt->size : 0;
+    int nsh = relocatable ? SH_MAX : SH_REL;
+
+    /* Symbols: null, every label (all local unless .globl), imports.
+        Locals must come first, so globals are counted apart */
+    size_t nlab = data->symbols->size + text->symbols->size;
+    symbol_t **labs = malloc((nlab + 1) * sizeof(symbol_t*));
+    uint8_t *labsh = malloc(nlab + 1);
+    const char **imports = malloc((nrel + 1) * sizeof(char*));
+    uint32_t *relsym = malloc((nrel + 1) * sizeof(uint32_t));
+    size_t nlocal = 0, nglobal = 0, nimport = 0, strsz = 1;
+
+    for (int pass = 0; pass < 2; pass++) {
+        for (int s = SEG_DATA; s <= SEG_TEXT; s++) {
+            symbol_table_t *st = segs[s].symbols;
+            for (size_t i = 0; i < st->size; i++) {
+                if (st->table[i].global != pass) continue;
+                labs[nlocal + nglobal] = &st->table[i];
+                labsh[nlocal + nglobal] = s == SEG_TEXT ? SH_TEXT : SH_DATA;
+                if (pass) nglobal++;
+                else nlocal++;
+                strsz += strlen(st->table[i].label) + 1;
+            }
+        }
+    }
+
+    /* Symbol index of each relocation, imports after the labels */
+    strmap_t map;
+    strmap_init(&map, nlab + nrel);
+    for (size_t i = 0; i < nlab; i++) {
+        uint32_t idx = 1 + i;
+        strmap_put(&map, labs[i]->label, &idx);
+    }
+    for (size_t i = 0; i < nrel; i++) {
+        uint32_t idx = 1 + nlab + nimport;
+        if (strmap_put(&map, rt->table[i].label, &idx) == 0) {
+            imports[nimport++] = rt->table[i].label;
+            strsz += strlen(rt->table[i].label) + 1;
+        }
+        relsym[i] = idx;
+    }
+    strmap_destroy(&map);
+    size_t nsym = 1 + nlab + nimport;
+
+    /* Layout: headers, loadable sections, then everything else */
+    size_t phoff = relocatable ? 0 : EHDR_SIZE;
+    size_t off = EHDR_SIZE + (relocatable ? 0 : 2 * PHDR_SIZE);
+    size_t textoff, dataoff;
+    if (relocatable) {
+        textoff = align(off, 4);
+        dataoff = align(textoff + text->size, 4);
+    } else {
+        /* File offset congruent to the address modulo the page size */
+        textoff = align(off, PAGE_SIZE) + (text->org & (PAGE_SIZE - 1));
+        dataoff = align(textoff + text->size, PAGE_SIZE)
+            + (data->org & (PAGE_SIZE - 1));
+    }
+    size_t symoff = align(dataoff + data->size, 4);
+    size_t stroff = symoff + nsym * SYM_SIZE;
+    size_t shstroff = stroff + strsz;
+    size_t reloff = align(shstroff + sizeof(shstrtab), 4);
+    size_t shoff = align(reloff + nrel * REL_SIZE, 4);
+    *len = shoff + nsh * SHDR_SIZE;
+
+    uint8_t *buf = calloc(*len, 1);
+
+    /* ELF header */
+    memcpy(buf, "\x7f" "ELF", 4);
+    buf[4] = 1;     /* ELFCLASS32 */
+    buf[5] = end == ENDIAN_BIG ? 2 : 1; /* ELFDATA2MSB or ELFDATA2LSB */
+    buf[6] = 1;     /* EV_CURRENT */
+    bo->put16(buf + 16, relocatable ? ET_REL : ET_EXEC);
+    bo->put16(buf + 18, EM_MIPS);
+    bo->put32(buf + 20, 1);
+    bo->put32(buf + 24, relocatable ? 0 : text->org);
+    bo->put32(buf + 28, phoff);
+    bo->put32(buf + 32, shoff);
+    bo->put32(buf + 36, EF_MIPS_ABI_O32);
+    bo->put16(buf + 40, EHDR_SIZE);
+    bo->put16(buf + 42, relocatable ? 0 : PHDR_SIZE);
+    bo->put16(buf + 44, relocatable ? 0 : 2);
+    bo->put16(buf + 46, SHDR_SIZE);
+    bo->put16(buf + 48, nsh);
+    bo->put16(buf + 50, SH_SHSTRTAB);
+
+    if (!relocatable) {
+        put_phdr(buf + phoff, textoff, text->org, text->size, PF_R | PF_X);
+        put_phdr(buf + phoff + PHDR_SIZE, dataoff, data->org, data->size,
+            PF_R | PF_W);
+    }
+
+    segment_read(text, 0, buf + textoff, text->size);
+    segment_read(data, 0, buf + dataoff, data->size);
+
+    /* REL keeps the addend in the field, zero but for the branch offset
+        which is relative to the next instruction */
+    for (size_t i = 0; i < nrel; i++) {
+        reloc_t *r = &rt->table[i];
+        uint8_t *field = buf + textoff + r->offset;
+        word_t ins = bo->get32(field);
+        switch (r->type) {
+            case RELOC_PC16: ins = (ins & 0xffff0000) | 0xffff; break;
+            case RELOC_J26: ins &= 0xfc000000; break;
+            case RELOC_HI16:
+            case RELOC_LO16: ins &= 0xffff0000; break;
+        }
+        bo->put32(field, ins);
+
+        uint8_t *p = buf + reloff + i * REL_SIZE;
+        bo->put32(p, r->offset);
+        bo->put32(p + 4, relsym[i] << 8 | reloc_elf_type[r->type]);
+    }
+
+    /* Symbol and string tables */
+    char *str = (char*)buf + stroff;
+    size_t stridx = 1;
+    uint8_t *p = buf + symoff + SYM_SIZE;
+    for (size_t i = 0; i < nlab; i++, p += SYM_SIZE) {
+        size_t l = strlen(labs[i]->label) + 1;
+        segment_t *seg = labsh[i] == SH_TEXT ? text : data;
+        memcpy(str + stridx, labs[i]->label, l);
+        bo->put32(p, stridx);
+        bo->put32(p + 4, labs[i]->address - (relocatable ? seg->org : 0));
+        p[12] = (labs[i]->global ? STB_GLOBAL : STB_LOCAL) << 4
+            | (labsh[i] == SH_DATA ? STT_OBJECT : STT_NOTYPE);
+        bo->put16(p + 14, labsh[i]);
+        stridx += l;
+    }
+    for (size_t i = 0; i < nimport; i++, p += SYM_SIZE) {
+        size_t l = strlen(imports[i]) + 1;
+        memcpy(str + stridx, imports[i], l);
+        bo->put32(p, stridx);
+        p[12] = STB_GLOBAL << 4 | STT_NOTYPE;
+        stridx += l;
+    }
+    memcpy(buf + shstroff, shstrtab, sizeof(shstrtab));
+
+    /* Section headers */
+    p = buf + shoff + SHDR_SIZE;
+    put_shdr(p, shname[SH_TEXT], SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR,
+        relocatable ? 0 : text->org, textoff, text->size, 0, 0, 4, 0);
+    p += SHDR_SIZE;
+    put_shdr(p, shname[SH_DATA], SHT_PROGBITS, SHF_ALLOC | SHF_WRITE,
+        relocatable ? 0 : data->org, dataoff, data->size, 0, 0, 4, 0);
+    p += SHDR_SIZE;
+    put_shdr(p, shname[SH_SYMTAB], SHT_SYMTAB, 0, 0, symoff,
+        nsym * SYM_SIZE, SH_STRTAB, 1 + nlocal, 4, SYM_SIZE);
+    p += SHDR_SIZE;
+    put_shdr(p, shname[SH_STRTAB], SHT_STRTAB, 0, 0, stroff, strsz, 0, 0,
+        1, 0);
+    p += SHDR_SIZE;
+    put_shdr(p, shname[SH_SHSTRTAB], SHT_STRTAB, 0, 0, shstroff,
+        sizeof(shstrtab), 0, 0, 1, 0);
+    p += SHDR_SIZE;
+    if (relocatable)
+        put_shdr(p, shname[SH_REL], SHT_REL, 0, 0, reloff, nrel * REL_SIZE,
+            SH_SYMTAB, SH_TEXT, 4, REL_SIZE);
+
+    free(labs);
+    free(labsh);
+    free(imports);
+    free(relsym);
+
+    return buf;
+}
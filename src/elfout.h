@@ -0,0 +1,38 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _ELFOUT_H
+#define _ELFOUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "assembler.h"
+
+/* Routines */
+
+/* ELF32 MIPS image of both segments, whole file in one buffer, in the
+    byte order of the segment data. Executable with segments loaded at
+    their origin, or relocatable with .rel.text from the segment
+    relocations */
+uint8_t *elf_build(segment_t *segs, int relocatable, endian_t end,
+    size_t *len);
+
+#endif /* _ELFOUT_H */
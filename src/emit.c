@@ -0,0 +1,329 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    emit.c: Buffered memory image emitters
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "emit.h"
+
+/* Tunables */
+#define IHEX_RECORD_BYTES   16  /* data bytes per record */
+#define LOGISIM_WORDS_PER_LINE  8
+#define LOGISIM_RUN_MIN     4   /* shortest run worth n*v encoding */
+#define LISTING_DATA_LINES  4   /* data words shown per statement */
+#define SYMBOL_COLUMN       16
+
+/* "00" "01" ... "ff" */
+#define L(h) #h "0" #h "1" #h "2" #h "3" #h "4" #h "5" #h "6" #h "7" \
+    #h "8" #h "9" #h "a" #h "b" #h "c" #h "d" #h "e" #h "f"
+#define U(h) #h "0" #h "1" #h "2" #h "3" #h "4" #h "5" #h "6" #h "7" \
+    #h "8" #h "9" #h "A" #h "B" #h "C" #h "D" #h "E" #h "F"
+
+const char hex_lower[512] =
+    L(0) L(1) L(2) L(3) L(4) L(5) L(6) L(7)
+    L(8) L(9) L(a) L(b) L(c) L(d) L(e) L(f);
+
+const char hex_upper[512] =
+    U(0) U(1) U(2) U(3) U(4) U(5) U(6) U(7)
+    U(8) U(9) U(A) U(B) U(C) U(D) U(E) U(F);
+
+void
+emitter_init(emitter_t *e, int fd) {
+    e->fd = fd;
+    e->err = 0;
+    e->len = 0;
+}
+
+void
+emitter_write(emitter_t *e, const void *buf, size_t len) {
+    const char *p = buf;
+    while (len && !e->err) {
+        ssize_t r = write(e->fd, p, len);
+        if (r < 0) {
+            if (errno != EINTR) e->err = errno;
+            continue;
+        }
+        p += r;
+        len -= r;
+    }
+}
+
+int
+emitter_flush(emitter_t *e) {
+    emitter_write(e, e->buf, e->len);
+    e->len = 0;
+    return e->err ? -1 : 0;
+}
+
+int
+format_from_name(const char *name, format_t *fmt) {
+    if (strcmp(name, "raw") == 0) *fmt = FMT_RAW;
+    else if (strcmp(name, "ihex") == 0) *fmt = FMT_IHEX;
+    else if (strcmp(name, "vmem") == 0) *fmt = FMT_VMEM;
+    else if (strcmp(name, "logisim") == 0) *fmt = FMT_LOGISIM;
+    else if (strcmp(name, "elf") == 0) *fmt = FMT_ELF;
+    else return -1;
+    return 0;
+}
+
+/* Intel HEX */
+
+static const uint8_t ihex_zeros[IHEX_RECORD_BYTES];
+
+static char *
+ihex_byte(char *p, uint8_t v, uint8_t *sum) {
+    memcpy(p, &hex_upper[2 * v], 2);
+    *sum += v;
+    return p + 2;
+}
+
+static void
+ihex_record(emitter_t *e, uint8_t type, uint16_t addr, const uint8_t *data,
+    size_t len)
+{
+    /* :LLAAAATT<data>CC\n */
+    char *p = emit_reserve(e, 12 + 2 * len), *start = p;
+    uint8_t sum = 0;
+
+    *p++ = ':';
+    p = ihex_byte(p, len, &sum);
+    p = ihex_byte(p, addr >> 8, &sum);
+    p = ihex_byte(p, addr, &sum);
+    p = ihex_byte(p, type, &sum);
+    for (size_t i = 0; i < len; i++)
+        p = ihex_byte(p, data[i], &sum);
+    p = ihex_byte(p, -sum, &sum);
+    *p++ = '\n';
+
+    e->len += p - start;
+}
+
+int
+emit_ihex(emitter_t *e, const segment_t *segs, int nsegs) {
+    uint32_t upper = 0xffffffff; /* current extended linear address */
+
+    for (int i = 0; i < nsegs; i++) {
+        const segment_t *seg = &segs[i];
+        size_t off = 0;
+        while (off < seg->size) {
+            addr_t addr = seg->org + off;
+
+            if (addr >> 16 != upper) {
+                upper = addr >> 16;
+                uint8_t ela[2] = { upper >> 8, upper };
+                ihex_record(e, 0x04, 0, ela, 2);
+            }
+
+            /* Records must not wrap across a 64K boundary, nor the end of
+                a stored run or hole */
+            size_t n = IHEX_RECORD_BYTES, span;
+            const uint8_t *bytes = segment_span(seg, off, &span);
+            if (n > span) n = span;
+            if (n > 0x10000 - (addr & 0xffff)) n = 0x10000 - (addr & 0xffff);
+
+            ihex_record(e, 0x00, addr, bytes ? bytes : ihex_zeros, n);
+            off += n;
+        }
+    }
+
+    ihex_record(e, 0x01, 0, NULL, 0);
+    return emitter_flush(e);
+}
+
+/* Verilog $readmemh, one word per line */
+
+int
+emit_vmem(emitter_t *e, const segment_t *seg, endian_t end) {
+    char *p = emit_reserve(e, 32);
+    e->len += sprintf(p, "// %s @ 0x%.8x\n",
+        seg->id == SEG_DATA ? ".data" : ".text", seg->org);
+
+    for (size_t i = 0; i < seg->size; i += 4) {
+        p = emit_reserve(e, 9);
+        p = fmt_hex32(p, segment_word(seg, i, end));
+        *p = '\n';
+        e->len += 9;
+    }
+
+    return emitter_flush(e);
+}
+
+/* Logisim v2.0 raw, runs of equal words as n*v */
+
+int
+emit_logisim(emitter_t *e, const segment_t *seg, endian_t end) {
+    emit_str(e, "v2.0 raw\n");
+
+    int col = 0;
+    size_t i = 0;
+    while (i < seg->size) {
+        word_t w = segment_word(seg, i, end);
+
+        size_t run = 1;
+        while (i + 4 * run < seg->size
+            && segment_word(seg, i + 4 * run, end) == w)
+        {
+            run++;
+        }
+
+        char *p = emit_reserve(e, 32), *start = p;
+        if (run >= LOGISIM_RUN_MIN) {
+            p += sprintf(p, "%zu*", run);
+        } else {
+            run = 1;
+        }
+        p = fmt_hex32(p, w);
+        if (++col == LOGISIM_WORDS_PER_LINE) {
+            *p++ = '\n';
+            col = 0;
+        } else {
+            *p++ = ' ';
+        }
+        e->len += p - start;
+
+        i += 4 * run;
+    }
+    if (col) e->buf[e->len - 1] = '\n'; /* last separator */
+
+    return emitter_flush(e);
+}
+
+/* Human readable views */
+
+void
+emit_symbols(emitter_t *e, const segment_t *segs, int nsegs) {
+    emit_str(e, "=== SYMBOL TABLE ===\nsegment\n  label           address\n"
+        "----------------------------\n");
+
+    for (int i = 0; i < nsegs; i++) {
+        char *p = emit_reserve(e, 32), *start = p;
+        memcpy(p, segs[i].id == SEG_DATA ? ".data [" : ".text [", 7);
+        p = fmt_dec(p + 7, segs[i].size, 0);
+        *p++ = ']';
+        *p++ = '\n';
+        e->len += p - start;
+
+        const symbol_table_t *st = segs[i].symbols;
+        for (size_t j = 0; j < st->size; j++) {
+            size_t ll = strlen(st->table[j].label);
+            emit_mem(e, "  ", 2);
+            emit_mem(e, st->table[j].label, ll);
+            emit_char(e, ':');
+
+            p = emit_reserve(e, SYMBOL_COLUMN + 12), start = p;
+            for (size_t k = ll + 1; k < SYMBOL_COLUMN; k++) *p++ = ' ';
+            if (ll + 1 >= SYMBOL_COLUMN) *p++ = ' ';
+            *p++ = '0';
+            *p++ = 'x';
+            p = fmt_hex32(p, st->table[j].address);
+            *p++ = '\n';
+            e->len += p - start;
+        }
+    }
+    emit_char(e, '\n');
+}
+
+void
+emit_hexdump(emitter_t *e, const segment_t *seg) {
+    emit_str(e, seg->id == SEG_DATA ? ".data" : ".text");
+    emit_str(e, "    0  1  2  3  4  5  6  7  8  9  a  b  c  d  e  f\n");
+
+    /* 00400000 xx xx .. xx   |................| */
+    for (size_t j = 0; j < seg->size; j += 16) {
+        size_t n = seg->size - j < 16 ? seg->size - j : 16;
+        char *p = emit_reserve(e, 80), *start = p;
+
+        p = fmt_hex32(p, seg->org + j);
+        *p++ = ' ';
+        for (size_t k = 0; k < 16; k++) {
+            if (k < n) p = fmt_hex8(p, segment_byte(seg, j + k));
+            else *p++ = ' ', *p++ = ' ';
+            *p++ = ' ';
+        }
+        *p++ = ' ';
+        *p++ = ' ';
+        *p++ = '|';
+        for (size_t k = 0; k < n; k++) {
+            uint8_t c = segment_byte(seg, j + k);
+            *p++ = c >= 0x20 && c < 0x7f ? c : '.';
+        }
+        *p++ = '|';
+        *p++ = '\n';
+
+        e->len += p - start;
+    }
+}
+
+int
+emit_listing(emitter_t *e, const segment_t *segs,
+    const statement_table_t *stmts, endian_t end)
+{
+    emit_str(e, "  line address  code      source\n");
+
+    for (size_t i = 0; i < stmts->size; i++) {
+        const statement_t *s = &stmts->table[i];
+        const segment_t *seg = &segs[s->seg];
+        size_t off = s->address - seg->org;
+
+        char *p = emit_reserve(e, 32), *start = p;
+        p = fmt_dec(p, s->line, 6);
+        *p++ = ' ';
+        p = fmt_hex32(p, s->address);
+        *p++ = ' ';
+        if (s->size == 0) {
+            memset(p, ' ', 8);
+            p += 8;
+        } else if (s->seg == SEG_TEXT) {
+            p = fmt_hex32(p, segment_word(seg, off, end));
+        } else {
+            /* Data, memory order */
+            for (size_t k = 0; k < 4; k++) {
+                if (k < s->size) p = fmt_hex8(p, segment_byte(seg, off + k));
+                else *p++ = ' ', *p++ = ' ';
+            }
+        }
+        *p++ = ' ';
+        *p++ = ' ';
+        e->len += p - start;
+
+        emit_mem(e, stmts->text + s->srcoff, s->srclen);
+        emit_char(e, '\n');
+
+        /* Continuation lines for data spanning several words */
+        for (size_t k = 4; k < s->size && k < 4 * LISTING_DATA_LINES; k += 4) {
+            p = emit_reserve(e, 32), start = p;
+            memset(p, ' ', 7);
+            p = fmt_hex32(p + 7, s->address + k);
+            *p++ = ' ';
+            for (size_t b = k; b < k + 4 && b < s->size; b++)
+                p = fmt_hex8(p, segment_byte(seg, off + b));
+            *p++ = '\n';
+            e->len += p - start;
+        }
+        if (s->size > 4 * LISTING_DATA_LINES)
+            emit_str(e, "       ...\n");
+    }
+
+    return emitter_flush(e);
+}
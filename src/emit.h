@@ -0,0 +1,158 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _EMIT_H
+#define _EMIT_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "assembler.h"
+
+/* Macros */
+
+#define EMIT_BUFF_SIZE  65536   /* bytes, flushed in one write */
+#define EMIT_LINE_MAX   256     /* longest single formatted record */
+
+/* Types */
+
+typedef enum {
+    FMT_RAW,        /* raw segment images, a.data and a.text */
+    FMT_IHEX,       /* Intel HEX, both segments in a.hex */
+    FMT_VMEM,       /* Verilog $readmemh, a.data.mem and a.text.mem */
+    FMT_LOGISIM,    /* Logisim v2.0 raw, a.data.img and a.text.img */
+    FMT_ELF         /* ELF32 MIPS executable, a.elf */
+} format_t;
+
+typedef struct {
+    int fd;
+    int err;
+    size_t len;
+    char buf[EMIT_BUFF_SIZE];
+} emitter_t;
+
+/* Hex lookup tables, two characters per byte */
+extern const char hex_lower[512];
+extern const char hex_upper[512];
+
+/* Routines */
+
+void emitter_init(emitter_t *e, int fd);
+int emitter_flush(emitter_t *e);
+void emitter_write(emitter_t *e, const void *buf, size_t len);
+
+/* Make room for at least n bytes, flushing if needed */
+static inline char *
+emit_reserve(emitter_t *e, size_t n) {
+    if (e->len + n > EMIT_BUFF_SIZE)
+        emitter_flush(e);
+    return e->buf + e->len;
+}
+
+static inline void
+emit_mem(emitter_t *e, const char *s, size_t n) {
+    if (n > EMIT_BUFF_SIZE) {
+        emitter_flush(e);
+        emitter_write(e, s, n);
+        return;
+    }
+    memcpy(emit_reserve(e, n), s, n);
+    e->len += n;
+}
+
+static inline void
+emit_str(emitter_t *e, const char *s) {
+    emit_mem(e, s, strlen(s));
+}
+
+static inline void
+emit_char(emitter_t *e, char c) {
+    *emit_reserve(e, 1) = c;
+    e->len++;
+}
+
+/* Unchecked formatters, caller reserves space */
+static inline char *
+fmt_hex8(char *p, uint8_t v) {
+    memcpy(p, &hex_lower[2 * v], 2);
+    return p + 2;
+}
+
+static inline char *
+fmt_hex16(char *p, uint16_t v) {
+    p = fmt_hex8(p, v >> 8);
+    return fmt_hex8(p, v);
+}
+
+static inline char *
+fmt_hex32(char *p, uint32_t v) {
+    p = fmt_hex16(p, v >> 16);
+    return fmt_hex16(p, v);
+}
+
+/* Right aligned decimal, padded with blanks to width */
+static inline char *
+fmt_dec(char *p, size_t v, int width) {
+    char tmp[24];
+    int n = 0;
+    do {
+        tmp[n++] = '0' + v % 10;
+        v /= 10;
+    } while (v);
+    while (width-- > n) *p++ = ' ';
+    while (n) *p++ = tmp[--n];
+    return p;
+}
+
+/* Byte i of the segment, zero in holes and past the end */
+static inline uint8_t
+segment_byte(const segment_t *seg, size_t i) {
+    size_t n;
+    const uint8_t *p = segment_span(seg, i, &n);
+    return p && n ? *p : 0;
+}
+
+/* Word starting at byte i of the segment in image byte order */
+static inline word_t
+segment_word(const segment_t *seg, size_t i, endian_t end) {
+    uint8_t b[4];
+    size_t n;
+    const uint8_t *p = segment_span(seg, i, &n);
+    if (p && n >= 4) memcpy(b, p, 4);
+    else segment_read(seg, i, b, 4); /* across runs or zero padded */
+    if (end == ENDIAN_BIG)
+        return (word_t)b[0] << 24 | (word_t)b[1] << 16 | (word_t)b[2] << 8
+            | b[3];
+    return (word_t)b[3] << 24 | (word_t)b[2] << 16 | (word_t)b[1] << 8 | b[0];
+}
+
+int format_from_name(const char *name, format_t *fmt);
+
+int emit_ihex(emitter_t *e, const segment_t *segs, int nsegs);
+int emit_vmem(emitter_t *e, const segment_t *seg, endian_t end);
+int emit_logisim(emitter_t *e, const segment_t *seg, endian_t end);
+
+void emit_symbols(emitter_t *e, const segment_t *segs, int nsegs);
+void emit_hexdump(emitter_t *e, const segment_t *seg);
+int emit_listing(emitter_t *e, const segment_t *segs,
+    const statement_table_t *stmts, endian_t end);
+
+#endif /* _EMIT_H */
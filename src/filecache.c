@@ -0,0 +1,270 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    filecache.c: Source files, mapped and split into lines once
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "filecache.h"
+
+/* Tunables */
+#define FILECACHE_INIT_SIZE 8   /* files */
+#define LINES_INIT_SIZE     256 /* lines */
+
+size_t
+split_lines(const char *data, size_t len, uint32_t **lines) {
+    size_t n = 0, cap = LINES_INIT_SIZE;
+    uint32_t *l = malloc(cap * sizeof(uint32_t));
+
+    const char *p = data, *end = data + len;
+    while (p < end) {
+        if (n == cap) {
+            cap *= 2;
+            l = realloc(l, cap * sizeof(uint32_t));
+        }
+        l[n++] = p - data;
+        const char *nl = memchr(p, '\n', end - p);
+        p = nl ? nl + 1 : end;
+    }
+
+    *lines = l;
+    return n;
+}
+
+/* FNV-1a, 64 bit */
+static uint64_t
+content_hash(const char *data, size_t len) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)data[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+/* Identity, to notice changes */
+static void
+identify(cached_file_t *cf, const struct stat *st) {
+    cf->dev = st->st_dev;
+    cf->ino = st->st_ino;
+    cf->size = st->st_size;
+    cf->mtime = st->st_mtim;
+}
+
+static int
+unchanged(const cached_file_t *cf, const struct stat *st) {
+    return cf->dev == st->st_dev && cf->ino == st->st_ino
+        && cf->size == st->st_size
+        && cf->mtime.tv_sec == st->st_mtim.tv_sec
+        && cf->mtime.tv_nsec == st->st_mtim.tv_nsec;
+}
+
+static void
+unload(cached_file_t *cf) {
+    if (cf->maplen) munmap((void*)cf->data, cf->maplen);
+    else free((void*)cf->data);
+    free(cf->lines);
+    cf->data = NULL;
+    cf->lines = NULL;
+}
+
+/* Map it when the page tail after the last newline provides the NUL,
+    copy it otherwise */
+static int
+load(cached_file_t *cf, int fd, const struct stat *st) {
+    long page = sysconf(_SC_PAGESIZE);
+    size_t len = st->st_size;
+
+    cf->maplen = 0;
+    if (len > 0 && len % page != 0) {
+        void *map = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED && ((char*)map)[len - 1] == '\n') {
+            cf->data = map;
+            cf->len = len;
+            cf->maplen = len;
+        } else if (map != MAP_FAILED) {
+            munmap(map, len);
+        }
+    }
+
+    if (!cf->maplen) {
+        char *buf = malloc(len + 2);
+        size_t got = 0;
+        while (got < len) {
+            ssize_t r = read(fd, buf + got, len - got);
+            if (r < 0 && errno == EINTR) continue;
+            if (r <= 0) {
+                free(buf);
+                if (r == 0) errno = EIO;
+                return -1;
+            }
+            got += r;
+        }
+        if (len == 0 || buf[len - 1] != '\n') buf[len++] = '\n';
+        buf[len] = '\0';
+        cf->data = buf;
+        cf->len = len;
+    }
+
+    cf->nlines = split_lines(cf->data, cf->len, &cf->lines);
+    cf->hash = content_hash(cf->data, cf->len);
+    identify(cf, st);
+    return 0;
+}
+
+void
+filecache_init(filecache_t *fc) {
+    fc->files = malloc(FILECACHE_INIT_SIZE * sizeof(cached_file_t*));
+    fc->size = 0;
+    fc->capacity = FILECACHE_INIT_SIZE;
+    strmap_init(&fc->index, FILECACHE_INIT_SIZE);
+    fc->run = 1;
+}
+
+void
+filecache_destroy(filecache_t *fc) {
+    for (size_t i = 0; i < fc->size; i++) {
+        if (fc->files[i]->data) unload(fc->files[i]);
+        free(fc->files[i]->path);
+        free(fc->files[i]);
+    }
+    free(fc->files);
+    strmap_destroy(&fc->index);
+    fc->size = fc->capacity = 0;
+}
+
+void
+filecache_new_run(filecache_t *fc) {
+    fc->run++;
+}
+
+/* Entry for path, created empty on first use */
+static cached_file_t *
+entry(filecache_t *fc, const char *path) {
+    uint32_t idx;
+    if (strmap_get(&fc->index, path, &idx))
+        return fc->files[idx];
+
+    cached_file_t *cf = calloc(1, sizeof(cached_file_t));
+    cf->path = strdup(path);
+    if (fc->size == fc->capacity) {
+        fc->capacity *= 2;
+        fc->files = realloc(fc->files, fc->capacity * sizeof(cached_file_t*));
+    }
+    idx = fc->size;
+    fc->files[fc->size++] = cf;
+    strmap_put(&fc->index, cf->path, &idx);
+    return cf;
+}
+
+/* Unreadable: kept in the set without data, so it is watched and retried */
+static cached_file_t *
+missing(filecache_t *fc, const char *path) {
+    int err = errno;
+    cached_file_t *cf = entry(fc, path);
+    if (cf->data) unload(cf);
+    cf->checked = fc->run;
+    errno = err;
+    return NULL;
+}
+
+cached_file_t *
+filecache_get(filecache_t *fc, const char *path) {
+    cached_file_t *cf = NULL;
+    uint32_t idx;
+
+    if (strmap_get(&fc->index, path, &idx)) {
+        cf = fc->files[idx];
+        if (cf->checked == fc->run && cf->data)
+            return cf; /* already validated this run */
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return missing(fc, path);
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return missing(fc, path);
+    }
+
+    if (cf && cf->data) {
+        if (unchanged(cf, &st)) {
+            close(fd);
+            cf->checked = fc->run;
+            return cf;
+        }
+        unload(cf); /* changed */
+    }
+
+    if (!cf) cf = entry(fc, path);
+
+    int r = load(cf, fd, &st);
+    close(fd);
+    if (r < 0) return missing(fc, path);
+
+    cf->checked = fc->run;
+    return cf;
+}
+
+void
+filecache_note(filecache_t *fc, const char *path, const struct stat *st) {
+    cached_file_t *cf = entry(fc, path);
+    cf->checked = fc->run;
+    if (cf->data) return; /* also a source, its contents are watched */
+    cf->binary = 1;
+    if (st) identify(cf, st);
+    else cf->size = -1;
+}
+
+size_t
+filecache_refresh(filecache_t *fc) {
+    unsigned last = fc->run;
+    size_t changed = 0;
+
+    filecache_new_run(fc);
+    for (size_t i = 0; i < fc->size; i++) {
+        cached_file_t *cf = fc->files[i];
+        if (cf->checked != last) continue;
+
+        if (cf->binary && !cf->data) {
+            struct stat st;
+            int found = stat(cf->path, &st) == 0;
+            if (found ? !unchanged(cf, &st) : cf->size >= 0) changed++;
+            filecache_note(fc, cf->path, found ? &st : NULL);
+            continue;
+        }
+
+        int had = cf->data != NULL;
+        uint64_t hash = cf->hash;
+        if (!filecache_get(fc, cf->path)) {
+            /* Gone or still missing, kept to notice it coming back */
+            if (had) changed++;
+        } else if (!had || cf->hash != hash) {
+            changed++;
+        }
+    }
+    return changed;
+}
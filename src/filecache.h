@@ -0,0 +1,88 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _FILECACHE_H
+#define _FILECACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "strmap.h"
+
+/* Types */
+
+/* Source file, loaded and split into lines once */
+typedef struct {
+    char *path;
+    const char *data;   /* always ends in '\n' followed by a NUL, NULL
+                            while the file cannot be read */
+    size_t len;         /* without the NUL */
+    uint32_t *lines;    /* offset of every line start */
+    size_t nlines;
+    uint64_t hash;      /* of the contents */
+
+    /* How it was loaded */
+    size_t maplen;      /* 0 if data was malloc()ed */
+
+    /* Identity, to notice changes */
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    struct timespec mtime;
+    unsigned checked;   /* run it was last validated in */
+    int binary;         /* noted by filecache_note(), size -1 if missing */
+} cached_file_t;
+
+/* Files by path, kept across runs and reloaded only when they change */
+typedef struct {
+    cached_file_t **files;
+    size_t size;
+    size_t capacity;
+    strmap_t index;
+    unsigned run;
+} filecache_t;
+
+/* Routines */
+
+void filecache_init(filecache_t *fc);
+void filecache_destroy(filecache_t *fc);
+
+/* Start a run: files are checked for changes again on their first use */
+void filecache_new_run(filecache_t *fc);
+
+/* Loaded file, or NULL with errno set. A path that cannot be read is kept
+    without data, so it is watched and retried like the others */
+cached_file_t *filecache_get(filecache_t *fc, const char *path);
+
+/* Start a run revalidating the files used in the last one, returns how
+    many of them changed contents or went missing */
+size_t filecache_refresh(filecache_t *fc);
+
+/* Record a binary used this run by its identity alone, without loading it,
+    so a refresh notices it changing. st is NULL if it cannot be read */
+void filecache_note(filecache_t *fc, const char *path, const struct stat *st);
+
+/* Split a buffer into lines, returns the number of lines */
+size_t split_lines(const char *data, size_t len, uint32_t **lines);
+
+#endif /* _FILECACHE_H */
@@ -0,0 +1,118 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    image.c: Output files of each format, shared by assembler and linker
+
+*/
+
+#include <stdlib.h>
+
+#include "image.h"
+#include "elfout.h"
+#include "symfile.h"
+
+/* Output files of each format, segment -1 is both */
+typedef struct {
+    const char *ext;
+    int seg;
+} target_t;
+
+static const target_t targets[][IMAGE_MAX_FILES] = {
+    [FMT_RAW]       = { { ".data", SEG_DATA }, { ".text", SEG_TEXT } },
+    [FMT_IHEX]      = { { ".hex", -1 }, { NULL, 0 } },
+    [FMT_VMEM]      = { { ".data.mem", SEG_DATA }, { ".text.mem", SEG_TEXT } },
+    [FMT_LOGISIM]   = { { ".data.img", SEG_DATA }, { ".text.img", SEG_TEXT } },
+    [FMT_ELF]       = { { ".elf", -1 }, { NULL, 0 } },
+};
+
+static emitter_t e;
+
+int
+image_open(outset_t *os, const char *base, format_t fmt, int *idx) {
+    int n = 0;
+    for (; n < IMAGE_MAX_FILES && targets[fmt][n].ext; n++) {
+        idx[n] = outset_open(os, base, targets[fmt][n].ext);
+        if (idx[n] < 0) return -1;
+    }
+    return n;
+}
+
+void
+image_write(outset_t *os, const int *idx, format_t fmt, segment_t *segs,
+    endian_t end)
+{
+    for (int i = 0; i < IMAGE_MAX_FILES && targets[fmt][i].ext; i++) {
+        int seg = targets[fmt][i].seg, r = 0;
+
+        if (fmt == FMT_RAW) {
+            /* Queued, written together with the rest at commit */
+            for (size_t off = 0, n; off < segs[seg].size; off += n) {
+                const uint8_t *p = segment_span(&segs[seg], off, &n);
+                if (p) outset_add(os, idx[i], p, n);
+                else outset_add_zeros(os, idx[i], n);
+            }
+            continue;
+        }
+
+        emitter_init(&e, outset_fd(os, idx[i]));
+        switch (fmt) {
+            case FMT_IHEX: r = emit_ihex(&e, segs, 2); break;
+            case FMT_VMEM: r = emit_vmem(&e, &segs[seg], end); break;
+            case FMT_LOGISIM: r = emit_logisim(&e, &segs[seg], end); break;
+            case FMT_ELF: {
+                /* Built whole, written in one call */
+                size_t len;
+                uint8_t *elf = elf_build(segs, 0, end, &len);
+                emitter_write(&e, elf, len);
+                r = e.err ? -1 : 0;
+                free(elf);
+            } break;
+            case FMT_RAW: break;
+        }
+        if (r < 0) outset_fail(os, idx[i], e.err);
+    }
+}
+
+void
+image_write_symbols(outset_t *os, int idx, segment_t *segs,
+    const symindex_t *si, int binary)
+{
+    emitter_init(&e, outset_fd(os, idx));
+
+    if (binary) {
+        size_t len;
+        uint8_t *sym = symfile_build(si, &len);
+        emitter_write(&e, sym, len);
+        free(sym);
+        if (e.err) outset_fail(os, idx, e.err);
+        return;
+    }
+
+    for (int s = SEG_DATA; s <= SEG_TEXT; s++) {
+        symbol_table_t *st = segs[s].symbols;
+        for (size_t i = 0; i < st->size; i++) {
+            emit_str(&e, st->table[i].label);
+            char *p = emit_reserve(&e, 12);
+            memcpy(p, ":0x", 3);
+            p = fmt_hex32(p + 3, st->table[i].address);
+            *p = '\n';
+            e.len += 12;
+        }
+    }
+    if (emitter_flush(&e) < 0) outset_fail(os, idx, e.err);
+}
@@ -0,0 +1,47 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _IMAGE_H
+#define _IMAGE_H
+
+#include "assembler.h"
+#include "emit.h"
+#include "outfile.h"
+#include "symindex.h"
+
+/* Macros */
+
+#define IMAGE_MAX_FILES 2
+
+/* Routines */
+
+/* Open the files of a format, returns their number or -1 */
+int image_open(outset_t *os, const char *base, format_t fmt, int *idx);
+
+/* Write or queue both segments in the files from image_open() */
+void image_write(outset_t *os, const int *idx, format_t fmt,
+    segment_t *segs, endian_t end);
+
+/* label:0xADDR lines for arfmipssim, or the binary symbol file from the
+    index of the same segments */
+void image_write_symbols(outset_t *os, int idx, segment_t *segs,
+    const symindex_t *si, int binary);
+
+#endif /* _IMAGE_H */
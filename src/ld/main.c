@@ -0,0 +1,326 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    ld/main.c: arfmipsld, links relocatable objects from arfmipsas -c
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "assembler.h"
+#include "object.h"
+#include "strmap.h"
+#include "image.h"
+#include "symindex.h"
+
+/* Tunables */
+#define RELOCS_PER_THREAD   4096    /* smallest share worth a thread */
+
+typedef struct {
+    const char *path;
+    const uint8_t *map;
+    size_t len;
+    object_t obj;
+    addr_t base[2];     /* offset of its sections in the output */
+    int errors;
+} module_t;
+
+typedef struct {
+    module_t *mods;
+    size_t nmods;
+    const byteorder_t *order; /* of every module */
+    segment_t *out;
+    uint8_t *image[2];  /* bytes of each output segment */
+    strmap_t *globals;
+    addr_t *gaddr;      /* address of each global */
+    size_t first, step; /* modules handled by a worker */
+} link_job_t;
+
+void
+usage(char *name) {
+    fprintf(stderr, "Usage: %s [options] file.o...\nOptions\n"
+    "  -g\t\tGenerate debug symbols for arfmipssim.\n"
+    "  -G\t\tGenerate binary debug symbols, indexed and mmap-able.\n"
+    "  -o <file>\tPlace the output into <file>.\n"
+    "  -f <format>\tOutput format: raw (default), ihex, vmem, logisim, elf.\n"
+    "  -Tdata <addr>\tOrigin of the data segment.\n"
+    "  -Ttext <addr>\tOrigin of the text segment.\n"
+    "  -j <n>\t\tResolve relocations on up to n threads.\n", name);
+}
+
+int
+module_map(module_t *m) {
+    int fd = open(m->path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return -1;
+    }
+    m->len = st.st_size;
+    m->map = m->len ? mmap(NULL, m->len, PROT_READ, MAP_PRIVATE, fd, 0)
+        : NULL;
+    close(fd);
+    if (m->map == MAP_FAILED) return -1;
+
+    if (object_parse(m->map, m->len, &m->obj) < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
+/* Copy sections in place and patch every relocation of some modules */
+void *
+link_worker(void *arg) {
+    link_job_t *job = arg;
+
+    for (size_t i = job->first; i < job->nmods; i += job->step) {
+        module_t *m = &job->mods[i];
+        object_t *o = &m->obj;
+
+        for (int s = SEG_DATA; s <= SEG_TEXT; s++)
+            memcpy(job->image[s] + m->base[s], o->data[s], o->size[s]);
+
+        for (size_t r = 0; r < o->nrelocs; r++) {
+            obj_reloc_t *rel = &o->relocs[r];
+            obj_symbol_t *sym = &o->symbols[rel->sym];
+            addr_t s, p;
+
+            if (sym->seg != OBJ_SEG_UNDEF) {
+                s = job->out[sym->seg].org + m->base[sym->seg] + sym->value;
+            } else {
+                uint32_t g;
+                if (!strmap_get(job->globals, sym->name, &g)) {
+                    fprintf(stderr, "%s: undefined reference to %s\n",
+                        m->path, sym->name);
+                    m->errors++;
+                    continue;
+                }
+                s = job->gaddr[g];
+            }
+
+            segment_t *seg = &job->out[rel->seg];
+            size_t off = m->base[rel->seg] + rel->offset;
+            p = seg->org + off;
+            if (reloc_apply(job->image[rel->seg] + off, job->order,
+                rel->type, p, s)
+                < 0)
+            {
+                fprintf(stderr, "%s: reference to %s at 0x%.8x out of "
+                    "range\n", m->path, sym->name, p);
+                m->errors++;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+int
+main(int argc, char **argv) {
+    if (argc < 2) {
+        usage(*argv);
+        return 1;
+    }
+
+    /* Command line options */
+    int debugsym = 0;
+    const char *outfn = "a";
+    format_t fmt = FMT_RAW;
+    addr_t org[2] = { DATA_ORG, TEXT_ORG };
+    long nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+
+    module_t *mods = calloc(argc, sizeof(module_t));
+    size_t nmods = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] == '-') {
+            if (strcmp(argv[i], "-Tdata") == 0 && i + 1 < argc)
+                org[SEG_DATA] = strtoul(argv[++i], NULL, 0);
+            else if (strcmp(argv[i], "-Ttext") == 0 && i + 1 < argc)
+                org[SEG_TEXT] = strtoul(argv[++i], NULL, 0);
+            else switch (argv[i][1]) {
+                case 'g': debugsym = 1; break;
+                case 'G': debugsym = 2; break;
+                case 'o': outfn = argv[++i]; break;
+                case 'j': nthreads = strtol(argv[++i], NULL, 0); break;
+                case 'f': {
+                    if (++i >= argc || format_from_name(argv[i], &fmt) < 0) {
+                        usage(*argv);
+                        return 1;
+                    }
+                } break;
+            }
+        } else mods[nmods++].path = argv[i];
+    }
+
+    if (nmods == 0 || !outfn) {
+        usage(*argv);
+        return 1;
+    }
+
+    /* Read objects and lay their sections out one after another */
+    size_t size[2] = { 0, 0 }, nglobals = 0, nrelocs = 0;
+    for (size_t i = 0; i < nmods; i++) {
+        module_t *m = &mods[i];
+        if (module_map(m) < 0) {
+            fprintf(stderr, "Error reading %s: %s\n", m->path,
+                strerror(errno));
+            return 1;
+        }
+        for (int s = SEG_DATA; s <= SEG_TEXT; s++) {
+            m->base[s] = size[s];
+            size[s] = (size[s] + m->obj.size[s] + 3) & ~(size_t)3;
+        }
+        nglobals += m->obj.nsymbols;
+        nrelocs += m->obj.nrelocs;
+
+        if (m->obj.endian != mods[0].obj.endian) {
+            fprintf(stderr, "%s: byte order differs from %s\n", m->path,
+                mods[0].path);
+            return 1;
+        }
+    }
+    endian_t end = mods[0].obj.endian;
+
+    segment_t *out = calloc(2, sizeof(segment_t));
+    uint8_t *image[2];
+    for (segid_t s = SEG_DATA; s <= SEG_TEXT; s++) {
+        out[s].id = s;
+        out[s].org = org[s];
+        out[s].size = size[s];
+        out[s].symbols = symbol_table_new();
+        out[s].relocs = reloc_table_new();
+        if (!(image[s] = segment_whole(&out[s]))) {
+            fprintf(stderr, "Error linking: %s\n", strerror(ENOMEM));
+            return 1;
+        }
+    }
+
+    /* Final symbol addresses, exported ones into the global map */
+    strmap_t globals;
+    strmap_init(&globals, nglobals);
+    addr_t *gaddr = malloc((nglobals + 1) * sizeof(addr_t));
+    uint32_t *gmod = malloc((nglobals + 1) * sizeof(uint32_t));
+    int errors = 0;
+    uint32_t ng = 0;
+
+    for (size_t i = 0; i < nmods; i++) {
+        object_t *o = &mods[i].obj;
+        for (size_t j = 0; j < o->nsymbols; j++) {
+            obj_symbol_t *sym = &o->symbols[j];
+            if (sym->seg == OBJ_SEG_UNDEF) continue;
+
+            addr_t a = org[sym->seg] + mods[i].base[sym->seg] + sym->value;
+            symbol_table_push(out[sym->seg].symbols,
+                (symbol_t){ a, strdup(sym->name), sym->global });
+
+            if (!sym->global) continue;
+            uint32_t g = ng;
+            if (strmap_put(&globals, sym->name, &g)) {
+                fprintf(stderr, "%s: multiple definition of %s, first "
+                    "defined in %s\n", mods[i].path, sym->name,
+                    mods[gmod[g]].path);
+                errors++;
+                continue;
+            }
+            gaddr[ng] = a;
+            gmod[ng++] = i;
+        }
+    }
+
+    /* Patch relocations, modules split among workers */
+    if (nthreads < 1) nthreads = 1;
+    if ((size_t)nthreads > nmods) nthreads = nmods;
+    if ((size_t)nthreads > nrelocs / RELOCS_PER_THREAD + 1)
+        nthreads = nrelocs / RELOCS_PER_THREAD + 1;
+
+    link_job_t *jobs = malloc(nthreads * sizeof(link_job_t));
+    pthread_t *th = malloc(nthreads * sizeof(pthread_t));
+    for (long t = 0; t < nthreads; t++) {
+        jobs[t] = (link_job_t){ mods, nmods, byteorder(end == ENDIAN_BIG),
+            out, { image[SEG_DATA], image[SEG_TEXT] }, &globals, gaddr, t,
+            nthreads };
+        if (t > 0 && pthread_create(&th[t], NULL, link_worker, &jobs[t]) != 0)
+            jobs[t].step = 0; /* run below instead */
+    }
+    link_worker(&jobs[0]);
+    for (long t = 1; t < nthreads; t++) {
+        if (jobs[t].step) pthread_join(th[t], NULL);
+        else {
+            jobs[t].step = nthreads;
+            link_worker(&jobs[t]);
+        }
+    }
+    free(jobs);
+    free(th);
+
+    for (size_t i = 0; i < nmods; i++)
+        errors += mods[i].errors;
+
+    int r = 1;
+    symindex_t si = { 0 };
+    if (!errors) {
+        outset_t os;
+        outset_init(&os);
+        int imgidx[IMAGE_MAX_FILES], symidx = -1;
+        if (image_open(&os, outfn, fmt, imgidx) < 0
+            || (debugsym && (symidx = outset_open(&os, outfn, ".sym")) < 0))
+        {
+            fprintf(stderr, "Error opening output %s: %s\n", outfn,
+                strerror(errno));
+            outset_abort(&os);
+        } else {
+            image_write(&os, imgidx, fmt, out, end);
+            if (debugsym) {
+                symindex_build(&si, out);
+                image_write_symbols(&os, symidx, out, &si, debugsym == 2);
+            }
+            r = outset_commit(&os, stderr) < 0;
+        }
+    } else {
+        fprintf(stderr, "Error linking\n");
+    }
+
+    /* Deinit */
+    symindex_destroy(&si);
+    strmap_destroy(&globals);
+    free(gaddr);
+    free(gmod);
+    for (size_t i = 0; i < nmods; i++) {
+        object_destroy(&mods[i].obj);
+        if (mods[i].map) munmap((void*)mods[i].map, mods[i].len);
+    }
+    free(mods);
+
+    segment_destroy(&out[SEG_DATA]);
+    segment_destroy(&out[SEG_TEXT]);
+    free(out);
+
+    return r;
+}
@@ -0,0 +1,188 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    linetab.c: PC to source line table
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "linetab.h"
+#include "bytes.h"
+
+/* Sizes in the file */
+#define HEADER_SIZE 32
+#define ENTRY_SIZE  8
+
+uint8_t *
+linetab_build(const statement_table_t *stmts, const segment_t *text,
+    size_t *len)
+{
+    /* One entry per run of instructions from the same line, in address
+        order as the text segment is laid out */
+    uint32_t *ent = malloc((2 * stmts->size + 1) * sizeof(uint32_t));
+    size_t n = 0;
+    uint32_t last = 0xffffffff;
+    for (size_t i = 0; i < stmts->size; i++) {
+        const statement_t *s = &stmts->table[i];
+        if (s->seg != SEG_TEXT || s->size == 0) continue;
+
+        size_t line = s->line > LINETAB_LINE_MAX ? LINETAB_LINE_MAX : s->line;
+        uint32_t file = s->file < LINETAB_FILES_MAX ? s->file
+            : LINETAB_FILES_MAX - 1;
+        uint32_t packed = file << 24 | line;
+        if (packed == last) continue;
+
+        ent[2 * n] = s->address;
+        ent[2 * n + 1] = last = packed;
+        n++;
+    }
+
+    size_t nfiles = stmts->nfiles < LINETAB_FILES_MAX ? stmts->nfiles
+        : LINETAB_FILES_MAX;
+    size_t strsz = 0;
+    for (size_t i = 0; i < nfiles; i++)
+        strsz += strlen(stmts->files[i]) + 1;
+
+    size_t entoff = HEADER_SIZE;
+    size_t fileoff = entoff + n * ENTRY_SIZE;
+    size_t stroff = fileoff + nfiles * 4;
+    *len = stroff + strsz;
+
+    uint8_t *buf = calloc(*len, 1);
+    memcpy(buf, LINETAB_MAGIC, 4);
+    put_u16le(buf + 4, LINETAB_VERSION);
+    put_u16le(buf + 6, nfiles);
+    put_u32le(buf + 8, n);
+    put_u32le(buf + 12, text->org + text->size);
+    put_u32le(buf + 16, entoff);
+    put_u32le(buf + 20, fileoff);
+    put_u32le(buf + 24, stroff);
+    put_u32le(buf + 28, strsz);
+
+    for (size_t i = 0; i < n; i++) {
+        put_u32le(buf + entoff + i * ENTRY_SIZE, ent[2 * i]);
+        put_u32le(buf + entoff + i * ENTRY_SIZE + 4, ent[2 * i + 1]);
+    }
+
+    size_t stridx = 0;
+    for (size_t i = 0; i < nfiles; i++) {
+        size_t l = strlen(stmts->files[i]);
+        put_u32le(buf + fileoff + 4 * i, stridx);
+        memcpy(buf + stroff + stridx, stmts->files[i], l + 1);
+        stridx += l + 1;
+    }
+
+    free(ent);
+    return buf;
+}
+
+int
+linetab_load(linetab_t *lt, const void *buf, size_t len) {
+    const uint8_t *b = buf;
+    lt->map = b;
+    lt->len = len;
+    lt->mapped = 0;
+
+    if (len < HEADER_SIZE || memcmp(b, LINETAB_MAGIC, 4) != 0
+        || get_u16le(b + 4) != LINETAB_VERSION)
+    {
+        return -1;
+    }
+
+    lt->nfiles = get_u16le(b + 6);
+    lt->nentries = get_u32le(b + 8);
+    lt->end = get_u32le(b + 12);
+    uint64_t entoff = get_u32le(b + 16), fileoff = get_u32le(b + 20);
+    uint64_t stroff = get_u32le(b + 24);
+    lt->strsz = get_u32le(b + 28);
+
+    if (entoff + (uint64_t)lt->nentries * ENTRY_SIZE > len
+        || fileoff + 4 * (uint64_t)lt->nfiles > len
+        || stroff + lt->strsz > len
+        || (lt->strsz && b[stroff + lt->strsz - 1] != '\0'))
+    {
+        return -1;
+    }
+
+    lt->entries = b + entoff;
+    lt->files = b + fileoff;
+    lt->strings = (const char*)b + stroff;
+    return 0;
+}
+
+int
+linetab_open(linetab_t *lt, const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+        close(fd);
+        return -1;
+    }
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return -1;
+
+    if (linetab_load(lt, map, st.st_size) < 0) {
+        munmap(map, st.st_size);
+        return -1;
+    }
+    lt->mapped = 1;
+    return 0;
+}
+
+void
+linetab_close(linetab_t *lt) {
+    if (lt->mapped) munmap((void*)lt->map, lt->len);
+    lt->map = NULL;
+    lt->len = 0;
+}
+
+int
+linetab_find(const linetab_t *lt, addr_t pc, linetab_entry_t *ent) {
+    if (pc >= lt->end) return -1;
+
+    /* Last entry at or below pc */
+    uint32_t lo = 0, n = lt->nentries;
+    while (n > 0) {
+        uint32_t half = n / 2;
+        if (get_u32le(lt->entries + (lo + half) * ENTRY_SIZE) <= pc) {
+            lo += half + 1;
+            n -= half + 1;
+        } else n = half;
+    }
+    if (lo == 0) return -1;
+
+    const uint8_t *p = lt->entries + (lo - 1) * ENTRY_SIZE;
+    uint32_t packed = get_u32le(p + 4), file = packed >> 24;
+    ent->pc = get_u32le(p);
+    ent->line = packed & LINETAB_LINE_MAX;
+    ent->file = "";
+    if (file < lt->nfiles) {
+        uint32_t name = get_u32le(lt->files + 4 * file);
+        if (name < lt->strsz) ent->file = lt->strings + name;
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _LINETAB_H
+#define _LINETAB_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "assembler.h"
+
+/* Macros */
+
+#define LINETAB_MAGIC   "AMLN"
+#define LINETAB_VERSION 1
+
+#define LINETAB_LINE_MAX    0xffffff    /* lines above are saturated */
+#define LINETAB_FILES_MAX   256
+
+/* Types */
+
+/* PC to source line table, used in place, see doc/SYMFILE.md */
+typedef struct {
+    const uint8_t *map;
+    size_t len;
+    int mapped;         /* map is ours to munmap */
+    uint32_t nentries;
+    uint32_t nfiles;
+    addr_t end;         /* of the text segment */
+    const uint8_t *entries;
+    const uint8_t *files;
+    const char *strings;
+    uint32_t strsz;
+} linetab_t;
+
+typedef struct {
+    addr_t pc;          /* first instruction of the line */
+    size_t line;
+    const char *file;
+} linetab_entry_t;
+
+/* Routines */
+
+/* Whole file in one buffer, from the statements of the text segment */
+uint8_t *linetab_build(const statement_table_t *stmts, const segment_t *text,
+    size_t *len);
+
+/* mmap a file, or use a buffer in memory; 0, or -1 if malformed */
+int linetab_open(linetab_t *lt, const char *path);
+int linetab_load(linetab_t *lt, const void *buf, size_t len);
+void linetab_close(linetab_t *lt);
+
+/* Source line of the instruction at pc, O(log n). 0, or -1 if none */
+int linetab_find(const linetab_t *lt, addr_t pc, linetab_entry_t *ent);
+
+#endif /* _LINETAB_H */
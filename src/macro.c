@@ -0,0 +1,192 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    macro.c: .macro definitions and expansion
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "macro.h"
+
+/* Tunables */
+#define MACRO_TABLE_INIT_SIZE   8   /* macros */
+#define MACRO_BODY_INIT_SIZE    256 /* bytes */
+
+static int
+isnamechar(char c) {
+    return isalnum(c) || c == '_';
+}
+
+void
+macro_table_init(macro_table_t *mt) {
+    mt->table = malloc(MACRO_TABLE_INIT_SIZE * sizeof(macro_t*));
+    mt->size = 0;
+    mt->capacity = MACRO_TABLE_INIT_SIZE;
+    strmap_init(&mt->index, MACRO_TABLE_INIT_SIZE);
+}
+
+void
+macro_table_destroy(macro_table_t *mt) {
+    for (size_t i = 0; i < mt->size; i++) {
+        macro_t *m = mt->table[i];
+        free(m->name);
+        for (int j = 0; j < m->nparams; j++)
+            free(m->params[j]);
+        free(m->body);
+        free(m->pieces);
+        free(m);
+    }
+    free(mt->table);
+    strmap_destroy(&mt->index);
+    mt->size = mt->capacity = 0;
+}
+
+macro_t *
+macro_table_find(macro_table_t *mt, const char *name) {
+    uint32_t i;
+    return strmap_get(&mt->index, name, &i) ? mt->table[i] : NULL;
+}
+
+macro_t *
+macro_table_define(macro_table_t *mt, const char *line, const char *eol) {
+    while (line < eol && isblank(*line)) line++;
+    const char *name = line;
+    while (line < eol && isnamechar(*line)) line++;
+    if (line == name) return NULL;
+
+    char *n = strndup(name, line - name);
+    if (macro_table_find(mt, n)) {
+        free(n);
+        return NULL;
+    }
+
+    macro_t *m = calloc(1, sizeof(macro_t));
+    m->name = n;
+
+    /* Parameters, separated by commas or blanks */
+    while (line < eol) {
+        while (line < eol && (isblank(*line) || *line == ',')) line++;
+        const char *p = line;
+        while (line < eol && isnamechar(*line)) line++;
+        if (line == p) break;
+        if (m->nparams == MACRO_PARAMS_MAX) break;
+        m->params[m->nparams++] = strndup(p, line - p);
+    }
+
+    m->body = malloc(MACRO_BODY_INIT_SIZE);
+    m->bodycap = MACRO_BODY_INIT_SIZE;
+
+    if (mt->size == mt->capacity) {
+        mt->capacity *= 2;
+        mt->table = realloc(mt->table, mt->capacity * sizeof(macro_t*));
+    }
+    uint32_t idx = mt->size;
+    mt->table[mt->size++] = m;
+    strmap_put(&mt->index, m->name, &idx);
+    return m;
+}
+
+void
+macro_add_line(macro_t *m, const char *bol, const char *eol) {
+    size_t len = eol - bol;
+    if (len && bol[len - 1] == '\n') len--;
+    while (m->bodylen + len + 1 > m->bodycap) {
+        m->bodycap *= 2;
+        m->body = realloc(m->body, m->bodycap);
+    }
+    memcpy(m->body + m->bodylen, bol, len);
+    m->bodylen += len;
+    m->body[m->bodylen++] = '\n';
+}
+
+void
+macro_finish(macro_t *m) {
+    size_t cap = 8;
+    m->pieces = malloc(cap * sizeof(macro_piece_t));
+    m->npieces = 0;
+
+    const char *p = m->body, *lit = p, *end = m->body + m->bodylen;
+    while (p < end) {
+        const char *bs = memchr(p, '\\', end - p);
+        if (!bs) break;
+
+        const char *name = bs + 1, *q = name;
+        while (q < end && isnamechar(*q)) q++;
+        int param = -1;
+        for (int i = 0; i < m->nparams; i++) {
+            if (strlen(m->params[i]) == (size_t)(q - name)
+                && memcmp(m->params[i], name, q - name) == 0)
+            {
+                param = i;
+                break;
+            }
+        }
+        if (param < 0) {
+            p = bs + 1;
+            continue;
+        }
+
+        if (m->npieces + 2 > cap) {
+            cap *= 2;
+            m->pieces = realloc(m->pieces, cap * sizeof(macro_piece_t));
+        }
+        if (bs > lit)
+            m->pieces[m->npieces++] = (macro_piece_t){ lit, bs - lit, -1 };
+        m->pieces[m->npieces++] = (macro_piece_t){ NULL, 0, param };
+        p = lit = q;
+    }
+
+    if (m->npieces + 1 > cap)
+        m->pieces = realloc(m->pieces, (cap + 1) * sizeof(macro_piece_t));
+    if (end > lit)
+        m->pieces[m->npieces++] = (macro_piece_t){ lit, end - lit, -1 };
+}
+
+size_t
+macro_expanded_len(const macro_t *m, const size_t *arglens) {
+    size_t n = 0;
+    for (size_t i = 0; i < m->npieces; i++)
+        n += m->pieces[i].param < 0 ? m->pieces[i].len
+            : arglens[m->pieces[i].param];
+    return n + 2; /* newline and NUL */
+}
+
+char *
+macro_expand(const macro_t *m, const char **args, const size_t *arglens,
+    size_t *len)
+{
+    char *buf = malloc(macro_expanded_len(m, arglens)), *p = buf;
+    for (size_t i = 0; i < m->npieces; i++) {
+        const macro_piece_t *pc = &m->pieces[i];
+        if (pc->param < 0) {
+            memcpy(p, pc->text, pc->len);
+            p += pc->len;
+        } else {
+            memcpy(p, args[pc->param], arglens[pc->param]);
+            p += arglens[pc->param];
+        }
+    }
+    if (p == buf || p[-1] != '\n') *p++ = '\n';
+    *p = '\0';
+
+    *len = p - buf;
+    return buf;
+}
@@ -0,0 +1,82 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _MACRO_H
+#define _MACRO_H
+
+#include <stddef.h>
+
+#include "strmap.h"
+
+/* Macros */
+
+#define MACRO_PARAMS_MAX    16
+
+/* Types */
+
+/* Body split once at the parameter references, so expanding is only
+    copying pieces */
+typedef struct {
+    const char *text;   /* into body, for literal pieces */
+    size_t len;
+    int param;          /* parameter index, -1 for literal text */
+} macro_piece_t;
+
+typedef struct {
+    char *name;
+    char *params[MACRO_PARAMS_MAX];
+    int nparams;
+    char *body;         /* body lines, '\n' terminated */
+    size_t bodylen;
+    size_t bodycap;
+    macro_piece_t *pieces;
+    size_t npieces;
+    int seen_pass;      /* pass its definition was last met in */
+} macro_t;
+
+typedef struct {
+    macro_t **table;
+    size_t size;
+    size_t capacity;
+    strmap_t index;
+} macro_table_t;
+
+/* Routines */
+
+void macro_table_init(macro_table_t *mt);
+void macro_table_destroy(macro_table_t *mt);
+macro_t *macro_table_find(macro_table_t *mt, const char *name);
+
+/* New macro from the rest of a .macro line: name [param, ...].
+    NULL without a name or if it is already defined */
+macro_t *macro_table_define(macro_table_t *mt, const char *line,
+    const char *eol);
+
+void macro_add_line(macro_t *m, const char *bol, const char *eol);
+void macro_finish(macro_t *m);
+
+/* Bytes macro_expand() allocates for these arguments */
+size_t macro_expanded_len(const macro_t *m, const size_t *arglens);
+
+/* Body with arguments substituted, '\n' and NUL terminated */
+char *macro_expand(const macro_t *m, const char **args, const size_t *arglens,
+    size_t *len);
+
+#endif /* _MACRO_H */
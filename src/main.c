@@ -24,103 +24,217 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <string.h>
-#include <ctype.h>
+
+#include <time.h>
+#include <unistd.h>
 
 #include "assembler.h"
+#include "emit.h"
+#include "outfile.h"
+#include "image.h"
+#include "object.h"
+#include "elfout.h"
+#include "linetab.h"
+#include "symindex.h"
+#include "watch.h"
+
+/* Tunables */
+#define WATCH_DEBOUNCE_MS   50  /* quiet time before reassembling */
+
+/* What to assemble and where to */
+typedef struct {
+    const char *infn;
+    const char *outfn;
+    const char *lstfn;
+    int verbose;
+    int debugsym;
+    format_t fmt;
+    asm_options_t opts;
+    size_t max_errors;  /* 0 for no limit */
+    int json_diags;     /* diagnostics as JSON */
+    FILE *verf;
+} job_t;
 
 void
 usage(char *name) {
     fprintf(stderr, "Usage: %s [options] file\nOptions\n"
-    "  -v\t\tVerbose output.\n  -g\t\tGenerate debug symbols for arfmipssim.\n  -o <file>\tPlace the output into <file>.\n", name);
+    "  -v\t\tVerbose output.\n"
+    "  -g\t\tGenerate debug symbols for arfmipssim.\n"
+    "  -G\t\tGenerate binary debug symbols, indexed and mmap-able.\n"
+    "  -o <file>\tPlace the output into <file>.\n"
+    "  -f <format>\tOutput format: raw (default), ihex, vmem, logisim, elf.\n"
+    "  -l <file>\tWrite a listing into <file>.\n"
+    "  -c\t\tAssemble into a relocatable object <file>.o for arfmipsld.\n"
+    "  --watch\tStay resident, reassembling when the sources change.\n"
+    "  --merge-strings\tShare identical labelled strings and tables.\n"
+    "  -EB, -EL\tBig or little endian (default) output.\n"
+    "  --max-errors <n>\tStop after n errors.\n"
+    "  --max-memory <n>\tFail rather than use over n bytes, k, M or G.\n"
+    "  --json-diagnostics\tReport diagnostics as a JSON object.\n",
+    name);
 }
 
-char *
-read_whole_file(FILE *f, size_t *sz) {
-    fseek(f, 0, SEEK_END);
-    *sz = ftell(f);
-    fseek(f, 0, SEEK_SET);
-
-    char *buff = malloc(*sz);
-    fread(buff, *sz, 1, f);
-
-    fclose(f);
-
-    return buff;
+/* Byte count with an optional k, M or G suffix */
+int
+parse_size(const char *s, size_t *n) {
+    char *end;
+    unsigned long long v = strtoull(s, &end, 0);
+    int shift = 0;
+    switch (*end) {
+        case 'k': case 'K': shift = 10; end++; break;
+        case 'm': case 'M': shift = 20; end++; break;
+        case 'g': case 'G': shift = 30; end++; break;
+    }
+    if (end == s || *end != '\0' || v > SIZE_MAX >> shift) return -1;
+    *n = v << shift;
+    return 0;
 }
 
 void
-print_symbols(segment_t *segs) {
-    printf("=== SYMBOL TABLE ===\nsegment\n  label           address\n"
-    "----------------------------\n");
-    for (int i = 0; i < 2; i++) { /* 2 segments */
-        switch (segs[i].id) {
-            case SEG_DATA: printf(".data [%d]\n", segs[i].size); break;
-            case SEG_TEXT: printf(".text [%d]\n", segs[i].size); break;
-        }
-        
-        for (int j = 0; j < segs[i].symbols->size; j++) {
-            symbol_t s = segs[i].symbols->table[j];
-            printf("  %s:", s.label);
-            printf("%.*s", 16 - strlen(s.label) - 1, "                ");
-            printf("0x%.8x\n", s.address);
-        }
-    }
-    printf("\n");
+print_symbols(emitter_t *e, segment_t *segs) {
+    emit_symbols(e, segs, 2);
 }
 
 void
-write_symbols(symbol_table_t *st, FILE *f) {
-    for (int i = 0; i < st->size; i++) {
-        fprintf(f, "%s:0x%.8x\n", st->table[i].label,
-            st->table[i].address);
+dump_segments(emitter_t *e, segment_t *segs) {
+    emit_str(e, "=== SEGMENT DUMP ===\n");
+    for (int i = 0; i < 2; i++) /* 2 segments */
+        emit_hexdump(e, &segs[i]);
+}
+
+/* Assemble a job into its outputs, 0 on success */
+int
+build(const job_t *job) {
+    const asm_options_t *opts = &job->opts;
+    const char *outfn = job->outfn;
+    format_t fmt = job->fmt;
+
+    /* Open every output up front, so nothing is assembled for nothing */
+    outset_t os;
+    outset_init(&os);
+    int imgidx[IMAGE_MAX_FILES], objidx = -1, symidx = -1, lstidx = -1;
+    int linidx = -1;
+    if (opts->relocatable) {
+        if ((objidx = outset_open(&os, outfn, ".o")) < 0)
+            goto open_error;
+    } else if (image_open(&os, outfn, fmt, imgidx) < 0)
+        goto open_error;
+    if (job->debugsym && ((symidx = outset_open(&os, outfn, ".sym")) < 0
+        || (linidx = outset_open(&os, outfn, ".lines")) < 0))
+    {
+        goto open_error;
+    }
+    if (job->lstfn && (lstidx = outset_open(&os, job->lstfn, "")) < 0)
+        goto open_error;
+
+    /* Read input file, included files go through the same cache */
+    cached_file_t *input = filecache_get(opts->cache, job->infn);
+    if (!input) {
+        outset_abort(&os);
+        fprintf(stderr, "Error reading file: %s\n", strerror(errno));
+        return 1;
     }
+
+    /* Assemble input */
+    segment_t *segments = NULL;
+    statement_table_t *stmts = NULL;
+    symindex_t index;
+    diag_list_t diags;
+    diag_list_init(&diags, job->max_errors);
+    int r = assemble(input->data, input->len, opts, &segments,
+        job->lstfn || job->debugsym ? &stmts : NULL,
+        job->debugsym ? &index : NULL, &diags, job->verf);
+
+    if (job->json_diags) diag_print_json(&diags, stderr);
+    else diag_print(&diags, stderr);
+    diag_list_destroy(&diags);
+
+    if (r < 0) {
+        outset_abort(&os);
+        fprintf(stderr, "Error assembling\n");
+        return 1;
+    }
+
+    /* Verbose */
+    static emitter_t e;
+    if (job->verbose) {
+        fflush(stdout);
+        emitter_init(&e, STDOUT_FILENO);
+        print_symbols(&e, segments);
+        dump_segments(&e, segments);
+        emitter_flush(&e);
+    }
+
+    /* Output */
+    uint8_t *obj = NULL;
+    if (opts->relocatable) {
+        size_t objlen;
+        obj = fmt == FMT_ELF ? elf_build(segments, 1, opts->endian, &objlen)
+            : object_build(segments, opts->endian, &objlen);
+        outset_add(&os, objidx, obj, objlen);
+    } else
+        image_write(&os, imgidx, fmt, segments, opts->endian);
+
+    uint8_t *lines = NULL;
+    if (job->debugsym) {
+        image_write_symbols(&os, symidx, segments, &index,
+            job->debugsym == 2);
+
+        size_t linlen;
+        lines = linetab_build(stmts, &segments[SEG_TEXT], &linlen);
+        outset_add(&os, linidx, lines, linlen);
+    }
+
+    if (job->lstfn) {
+        emitter_init(&e, outset_fd(&os, lstidx));
+        if (emit_listing(&e, segments, stmts, opts->endian) < 0)
+            outset_fail(&os, lstidx, e.err);
+    }
+
+    r = outset_commit(&os, stderr);
+
+    /* Deinit */
+    free(obj);
+    free(lines);
+    if (stmts) statement_table_destroy(stmts);
+    if (job->debugsym) symindex_destroy(&index);
+
+    segment_destroy(&segments[SEG_DATA]);
+    segment_destroy(&segments[SEG_TEXT]);
+
+    free(segments);
+
+    return r < 0 ? 1 : 0;
+
+open_error:
+    fprintf(stderr, "Error opening output %s: %s\n", outfn, strerror(errno));
+    outset_abort(&os);
+    return 1;
 }
 
-void
-dump_segments(segment_t *segs) {
-    printf("=== SEGMENT DUMP ===\n");
-    for (int i = 0; i < 2; i++) { /* 2 segments */
-        addr_t org;
-        switch (segs[i].id) {
-            case SEG_DATA: {
-                printf(".data", segs[i].size);
-                org = DATA_ORG;
-            } break;
-            case SEG_TEXT: {
-                printf(".text", segs[i].size); 
-                org = TEXT_ORG;
-            } break;
-        }
-        
-        printf("    0  1  2  3  4  5  6  7  8  9  a  b  c  d  e  f");
-
-        int j = 0;
-        for (; j < segs[i].size; j++) {
-            if (j % 16 == 0) {
-                if (j != 0) {
-                    printf("  |");
-                    for (int k = j - 16; k < j; k++)
-                        isprint(segs[i].data[k]) ? putchar(segs[i].data[k]) : putchar('.');
-                    printf("|");
-                }
-                printf("\n%.8x ", org + j);
-            }
+/* Reassemble whenever the input or a file it includes changes */
+int
+watch(const job_t *job) {
+    watcher_t w;
+    if (watcher_init(&w) < 0) {
+        fprintf(stderr, "Error watching %s: %s\n", job->infn,
+            strerror(errno));
+        return 1;
+    }
 
-            printf("%.2x ", segs[i].data[j]);
-        }
-        
-        if (j % 16 != 0) {
-            for (int k = 0; k < 16 - (j % 16); k++)
-                printf("   ");
-            printf("  |");
-            for (int k = 16 * (j / 16); k < segs[i].size; k++)
-                isprint(segs[i].data[k]) ? putchar(segs[i].data[k]) : putchar('.');
-            printf("|");
-        }
-
-        printf("\n");
+    while (watcher_wait(&w, job->opts.cache, WATCH_DEBOUNCE_MS) == 0) {
+        struct timespec t0, t1;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        int r = build(job);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        fprintf(stderr, "%s: %s in %.1f ms\n", job->infn,
+            r ? "failed" : "reassembled",
+            (t1.tv_sec - t0.tv_sec) * 1e3 + (t1.tv_nsec - t0.tv_nsec) / 1e6);
     }
-    
+
+    fprintf(stderr, "Error watching %s: %s\n", job->infn, strerror(errno));
+    watcher_destroy(&w);
+    return 1;
 }
 
 int
@@ -131,21 +245,48 @@ main(int argc, char **argv) {
     }
 
     /* Command line options */
-    int verbose = 0;
-    int debugsym = 0;
-    char *outfn = NULL;
-    char *infn = NULL;
+    job_t job = { 0 };
+    int watching = 0;
+    job.fmt = FMT_RAW;
 
     for (int i = 1; i < argc; i++) {
-        if (argv[i][0] == '-') {
+        if (strcmp(argv[i], "--watch") == 0) {
+            watching = 1;
+        } else if (strcmp(argv[i], "--merge-strings") == 0) {
+            job.opts.merge_strings = 1;
+        } else if (strcmp(argv[i], "--max-errors") == 0 && i + 1 < argc) {
+            job.max_errors = strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--max-memory") == 0 && i + 1 < argc) {
+            if (parse_size(argv[++i], &job.opts.max_memory) < 0) {
+                usage(*argv);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-EB") == 0) {
+            job.opts.endian = ENDIAN_BIG;
+        } else if (strcmp(argv[i], "-EL") == 0) {
+            job.opts.endian = ENDIAN_LITTLE;
+        } else if (strcmp(argv[i], "--json-diagnostics") == 0) {
+            job.json_diags = 1;
+        } else if (argv[i][0] == '-') {
             /* Argument */
             switch (argv[i][1]) {
-                case 'v': verbose = 1; break;
-                case 'g': debugsym = 1; break;
-                case 'o': outfn = argv[++i]; break;
+                case 'v': job.verbose = 1; break;
+                case 'g': job.debugsym = 1; break;
+                case 'G': job.debugsym = 2; break;
+                case 'o': job.outfn = argv[++i]; break;
+                case 'l': job.lstfn = argv[++i]; break;
+                case 'c': job.opts.relocatable = 1; break;
+                case 'f': {
+                    if (++i >= argc
+                        || format_from_name(argv[i], &job.fmt) < 0)
+                    {
+                        usage(*argv);
+                        return 1;
+                    }
+                } break;
             }
         } else {
-            if (infn == NULL) infn = argv[i];
+            if (job.infn == NULL) job.infn = argv[i];
             else {
                 usage(*argv);
                 return 1;
@@ -153,77 +294,27 @@ main(int argc, char **argv) {
          }
     }
 
-    if (infn == NULL) {
+    if (job.infn == NULL) {
         usage(*argv);
         return 1;
     }
 
-    if (!outfn) {
-        outfn = malloc(2);
-        strcpy(outfn, "a");
-    }
-
-    FILE *verf = NULL;
-    if (verbose) verf = stdout;
-    else verf = fopen("/dev/null", "w");
-
-    /* Read input file */
-    FILE *inf = fopen(infn, "r");
-    if (!inf) {
-        free(outfn);
-        fprintf(stderr, "Error reading file: %s\n", strerror(errno));
-        return 1;
-    }
-
-    size_t inlen;
-    char *input = read_whole_file(inf, &inlen);
-
-    /* Assemble input */
-    segment_t *segments = NULL;
-    int r = assemble(input, inlen, &segments, verf, stderr);
-    if (r < 0) {
-        fprintf(stderr, "Error assembling\n");
-        return 1;
-    }
-
-    /* Verbose */
-    if (verbose) {
-        print_symbols(segments);
-        dump_segments(segments);
-    }
+    if (!job.outfn) job.outfn = "a";
 
-    char buff[256];
-
-    strcpy(buff, outfn);
-    strcat(buff, ".data");
-    FILE *outdf = fopen(buff, "wb");
-    fwrite(segments[SEG_DATA].data, segments[SEG_DATA].size, 1, outdf);
-    fclose(outdf);
-
-    strcpy(buff, outfn);
-    strcat(buff, ".text");
-    FILE *outtf = fopen(buff, "wb");
-    fwrite(segments[SEG_TEXT].data, segments[SEG_TEXT].size, 1, outtf);
-    fclose(outtf);
-
-    if (debugsym) {
-        strcpy(buff, outfn);
-        strcat(buff, ".sym");
-        FILE *outsf = fopen(buff, "wb");
-        write_symbols(segments[SEG_DATA].symbols, outsf);
-        write_symbols(segments[SEG_TEXT].symbols, outsf);
-        fclose(outsf);
-    }
+    if (job.verbose) job.verf = stdout;
+    else job.verf = fopen("/dev/null", "w");
 
+    /* Sources stay loaded between runs when watching */
+    filecache_t cache;
+    filecache_init(&cache);
+    job.opts.cache = &cache;
+    job.opts.filename = job.infn;
 
-    /* Deinit */
-    free(input);
-    free(outfn);
+    int r = build(&job);
+    if (watching)
+        r = watch(&job);
 
-    segment_destroy(&segments[SEG_DATA]);
-    segment_destroy(&segments[SEG_TEXT]);
-
-    free(segments);
+    filecache_destroy(&cache);
 
-    return 0;
+    return r;
 }
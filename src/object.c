@@ -0,0 +1,260 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    object.c: Relocatable object format, see doc/OBJECT.md
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "object.h"
+#include "bytes.h"
+#include "strmap.h"
+
+/* Sizes in the file */
+#define HEADER_SIZE 40
+#define SYMBOL_SIZE 12
+#define RELOC_SIZE  12
+
+#define ALIGN4(x)   (((x) + 3) & ~(size_t)3)
+
+uint8_t *
+object_build(segment_t *segs, endian_t end, size_t *len) {
+    /* Defined symbols first, then the imports the relocations need */
+    size_t ndef = segs[SEG_DATA].symbols->size + segs[SEG_TEXT].symbols->size;
+    size_t nrel = segs[SEG_DATA].relocs->size + segs[SEG_TEXT].relocs->size;
+
+    const char **names = malloc((ndef + nrel) * sizeof(char*));
+    uint32_t *relsym = malloc((nrel ? nrel : 1) * sizeof(uint32_t));
+    strmap_t map;
+    strmap_init(&map, ndef + nrel);
+
+    size_t nsym = 0, strsz = 0;
+    for (int s = SEG_DATA; s <= SEG_TEXT; s++) {
+        symbol_table_t *st = segs[s].symbols;
+        for (size_t i = 0; i < st->size; i++) {
+            uint32_t idx = nsym;
+            if (strmap_put(&map, st->table[i].label, &idx) == 0) {
+                names[nsym++] = st->table[i].label;
+                strsz += strlen(st->table[i].label) + 1;
+            }
+        }
+    }
+    ndef = nsym;
+
+    size_t r = 0;
+    for (int s = SEG_DATA; s <= SEG_TEXT; s++) {
+        reloc_table_t *rt = segs[s].relocs;
+        for (size_t i = 0; i < rt->size; i++, r++) {
+            uint32_t idx = nsym;
+            if (strmap_put(&map, rt->table[i].label, &idx) == 0) {
+                names[nsym++] = rt->table[i].label;
+                strsz += strlen(rt->table[i].label) + 1;
+            }
+            relsym[r] = idx;
+        }
+    }
+    strmap_destroy(&map);
+
+    /* Layout */
+    size_t dataoff = HEADER_SIZE;
+    size_t textoff = dataoff + ALIGN4(segs[SEG_DATA].size);
+    size_t symoff = textoff + ALIGN4(segs[SEG_TEXT].size);
+    size_t reloff = symoff + nsym * SYMBOL_SIZE;
+    size_t stroff = reloff + nrel * RELOC_SIZE;
+    *len = stroff + strsz;
+
+    uint8_t *buf = calloc(*len, 1);
+
+    memcpy(buf, OBJ_MAGIC, 4);
+    put_u16le(buf + 4, OBJ_VERSION);
+    put_u16le(buf + 6, end == ENDIAN_BIG ? OBJ_BIG_ENDIAN : 0);
+    put_u32le(buf + 8, segs[SEG_DATA].size);
+    put_u32le(buf + 12, segs[SEG_TEXT].size);
+    put_u32le(buf + 16, segs[SEG_DATA].org);
+    put_u32le(buf + 20, segs[SEG_TEXT].org);
+    put_u32le(buf + 24, nsym);
+    put_u32le(buf + 28, nrel);
+    put_u32le(buf + 32, strsz);
+
+    segment_read(&segs[SEG_DATA], 0, buf + dataoff, segs[SEG_DATA].size);
+    segment_read(&segs[SEG_TEXT], 0, buf + textoff, segs[SEG_TEXT].size);
+
+    /* Symbols, in the same order they were named above */
+    uint8_t *p = buf + symoff;
+    size_t stridx = 0, k = 0;
+    for (int s = SEG_DATA; s <= SEG_TEXT; s++) {
+        symbol_table_t *st = segs[s].symbols;
+        for (size_t i = 0; i < st->size; i++) {
+            if (k >= ndef || names[k] != st->table[i].label)
+                continue; /* duplicate label */
+            put_u32le(p, stridx);
+            put_u32le(p + 4, st->table[i].address - segs[s].org);
+            p[8] = s;
+            p[9] = st->table[i].global;
+            p += SYMBOL_SIZE;
+            stridx += strlen(names[k]) + 1;
+            k++;
+        }
+    }
+    for (; k < nsym; k++) {
+        put_u32le(p, stridx);
+        put_u32le(p + 4, 0);
+        p[8] = OBJ_SEG_UNDEF;
+        p[9] = 1;
+        p += SYMBOL_SIZE;
+        stridx += strlen(names[k]) + 1;
+    }
+
+    /* Relocations */
+    r = 0;
+    for (int s = SEG_DATA; s <= SEG_TEXT; s++) {
+        reloc_table_t *rt = segs[s].relocs;
+        for (size_t i = 0; i < rt->size; i++, r++) {
+            put_u32le(p, rt->table[i].offset);
+            p[4] = rt->table[i].type;
+            p[5] = s;
+            put_u32le(p + 8, relsym[r]);
+            p += RELOC_SIZE;
+        }
+    }
+
+    /* String table */
+    char *str = (char*)buf + stroff;
+    for (k = 0; k < nsym; k++) {
+        size_t l = strlen(names[k]) + 1;
+        memcpy(str, names[k], l);
+        str += l;
+    }
+
+    free(names);
+    free(relsym);
+
+    return buf;
+}
+
+int
+object_parse(const uint8_t *buf, size_t len, object_t *obj) {
+    memset(obj, 0, sizeof(object_t));
+
+    if (len < HEADER_SIZE || memcmp(buf, OBJ_MAGIC, 4) != 0
+        || get_u16le(buf + 4) != OBJ_VERSION)
+    {
+        return -1;
+    }
+
+    obj->endian = get_u16le(buf + 6) & OBJ_BIG_ENDIAN ? ENDIAN_BIG
+        : ENDIAN_LITTLE;
+    obj->size[SEG_DATA] = get_u32le(buf + 8);
+    obj->size[SEG_TEXT] = get_u32le(buf + 12);
+    obj->org[SEG_DATA] = get_u32le(buf + 16);
+    obj->org[SEG_TEXT] = get_u32le(buf + 20);
+    obj->nsymbols = get_u32le(buf + 24);
+    obj->nrelocs = get_u32le(buf + 28);
+    size_t strsz = get_u32le(buf + 32);
+
+    size_t dataoff = HEADER_SIZE;
+    size_t textoff = dataoff + ALIGN4(obj->size[SEG_DATA]);
+    size_t symoff = textoff + ALIGN4(obj->size[SEG_TEXT]);
+    size_t reloff = symoff + obj->nsymbols * SYMBOL_SIZE;
+    size_t stroff = reloff + obj->nrelocs * RELOC_SIZE;
+    if (stroff < symoff || stroff + strsz != len
+        || (strsz && buf[len - 1] != '\0'))
+    {
+        return -1;
+    }
+
+    obj->data[SEG_DATA] = buf + dataoff;
+    obj->data[SEG_TEXT] = buf + textoff;
+
+    const char *str = (const char*)buf + stroff;
+    obj->symbols = malloc((obj->nsymbols + 1) * sizeof(obj_symbol_t));
+    const uint8_t *p = buf + symoff;
+    for (size_t i = 0; i < obj->nsymbols; i++, p += SYMBOL_SIZE) {
+        obj_symbol_t *s = &obj->symbols[i];
+        uint32_t name = get_u32le(p);
+        s->value = get_u32le(p + 4);
+        s->seg = p[8];
+        s->global = p[9];
+        if (name >= strsz || (s->seg != OBJ_SEG_UNDEF && (s->seg > SEG_TEXT
+            || s->value > obj->size[s->seg])))
+        {
+            object_destroy(obj);
+            return -1;
+        }
+        s->name = str + name;
+    }
+
+    obj->relocs = malloc((obj->nrelocs + 1) * sizeof(obj_reloc_t));
+    for (size_t i = 0; i < obj->nrelocs; i++, p += RELOC_SIZE) {
+        obj_reloc_t *r = &obj->relocs[i];
+        r->offset = get_u32le(p);
+        r->type = p[4];
+        r->seg = p[5];
+        r->sym = get_u32le(p + 8);
+        if (r->seg > SEG_TEXT || r->type > RELOC_LO16
+            || r->sym >= obj->nsymbols
+            || (size_t)r->offset + 4 > obj->size[r->seg])
+        {
+            object_destroy(obj);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void
+object_destroy(object_t *obj) {
+    free(obj->symbols);
+    free(obj->relocs);
+    obj->symbols = NULL;
+    obj->relocs = NULL;
+    obj->nsymbols = obj->nrelocs = 0;
+}
+
+int
+reloc_apply(uint8_t *field, const byteorder_t *bo, reloc_type_t type,
+    addr_t p, addr_t s)
+{
+    word_t ins = bo->get32(field);
+
+    switch (type) {
+        case RELOC_PC16: {
+            /* Relative to the next instruction, in words */
+            int32_t off = (int32_t)(s - p - 4) / 4;
+            if (off < INT16_MIN || off > INT16_MAX) return -1;
+            ins = (ins & 0xffff0000) | (off & 0xffff);
+        } break;
+        case RELOC_J26: {
+            /* Target must be in the same 256 MB region */
+            if (((p + 4) & 0xf0000000) != (s & 0xf0000000)) return -1;
+            ins = (ins & 0xfc000000) | ((s & 0x0ffffffc) >> 2);
+        } break;
+        case RELOC_HI16: {
+            ins = (ins & 0xffff0000) | (s >> 16);
+        } break;
+        case RELOC_LO16: {
+            ins = (ins & 0xffff0000) | (s & 0xffff);
+        } break;
+    }
+
+    bo->put32(field, ins);
+    return 0;
+}
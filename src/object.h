@@ -0,0 +1,79 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _OBJECT_H
+#define _OBJECT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "assembler.h"
+#include "bytes.h"
+
+/* Macros */
+
+#define OBJ_MAGIC       "AMOF"
+#define OBJ_VERSION     1
+#define OBJ_SEG_UNDEF   0xff    /* imported symbol */
+#define OBJ_BIG_ENDIAN  0x0001  /* flag, section contents big endian */
+
+/* Types */
+
+typedef struct {
+    const char *name;   /* into the string table */
+    addr_t value;       /* offset from the segment origin */
+    uint8_t seg;        /* SEG_DATA, SEG_TEXT or OBJ_SEG_UNDEF */
+    uint8_t global;
+} obj_symbol_t;
+
+typedef struct {
+    addr_t offset;      /* of the instruction, from the segment origin */
+    uint8_t type;       /* reloc_type_t */
+    uint8_t seg;
+    uint32_t sym;       /* index into symbols */
+} obj_reloc_t;
+
+/* Parsed object, section contents point into the file image */
+typedef struct {
+    const uint8_t *data[2];
+    size_t size[2];
+    addr_t org[2];
+    obj_symbol_t *symbols;
+    size_t nsymbols;
+    obj_reloc_t *relocs;
+    size_t nrelocs;
+    endian_t endian;    /* of the section contents */
+} object_t;
+
+/* Routines */
+
+/* Serialize assembled segments, whole image in one buffer */
+uint8_t *object_build(segment_t *segs, endian_t end, size_t *len);
+
+/* 0, or -1 on a malformed image */
+int object_parse(const uint8_t *buf, size_t len, object_t *obj);
+void object_destroy(object_t *obj);
+
+/* Patch the instruction at p, in the byte order of bo, for a reference to
+    s, -1 when out of range */
+int reloc_apply(uint8_t *field, const byteorder_t *bo, reloc_type_t type,
+    addr_t p, addr_t s);
+
+#endif /* _OBJECT_H */
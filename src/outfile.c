@@ -0,0 +1,229 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    outfile.c: Batched, atomic output files
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "outfile.h"
+
+/* Tunables */
+#define OUTSET_INIT_SIZE    4       /* files */
+#define OUTFILE_IOV_INIT    4       /* queued writes */
+#define THREAD_MIN_BYTES    (1 << 20) /* smallest batch worth threads */
+#define ZEROS_CHUNK         65536   /* bytes per queued run of zeros */
+
+#ifndef IOV_MAX
+#define IOV_MAX             1024    /* POSIX minimum */
+#endif
+
+static mode_t create_mode; /* as open() would create them */
+
+void
+outset_init(outset_t *os) {
+    os->files = malloc(OUTSET_INIT_SIZE * sizeof(outfile_t));
+    os->size = 0;
+    os->capacity = OUTSET_INIT_SIZE;
+
+    mode_t mask = umask(0);
+    umask(mask);
+    create_mode = 0666 & ~mask;
+}
+
+int
+outset_open(outset_t *os, const char *base, const char *ext) {
+    if (os->size == os->capacity) {
+        os->capacity *= 2;
+        os->files = realloc(os->files, os->capacity * sizeof(outfile_t));
+    }
+
+    outfile_t *of = &os->files[os->size];
+    size_t bl = strlen(base), el = strlen(ext);
+
+    of->path = malloc(bl + el + 1);
+    memcpy(of->path, base, bl);
+    memcpy(of->path + bl, ext, el + 1);
+
+    /* Temporary in the same directory, so rename() is atomic */
+    of->tmppath = malloc(bl + el + 8);
+    memcpy(of->tmppath, of->path, bl + el);
+    memcpy(of->tmppath + bl + el, ".XXXXXX", 8);
+
+    of->fd = mkstemp(of->tmppath);
+    if (of->fd < 0) {
+        free(of->path);
+        free(of->tmppath);
+        return -1;
+    }
+    fchmod(of->fd, create_mode); /* mkstemp creates 0600 */
+
+    of->iov = NULL;
+    of->iovcnt = of->iovcap = 0;
+    of->queued = 0;
+    of->err = 0;
+
+    return os->size++;
+}
+
+int
+outset_fd(outset_t *os, int i) {
+    return os->files[i].fd;
+}
+
+void
+outset_add(outset_t *os, int i, const void *buf, size_t len) {
+    outfile_t *of = &os->files[i];
+    if (len == 0) return;
+    if (of->iovcnt == of->iovcap) {
+        of->iovcap = of->iovcap ? 2 * of->iovcap : OUTFILE_IOV_INIT;
+        of->iov = realloc(of->iov, of->iovcap * sizeof(struct iovec));
+    }
+    of->iov[of->iovcnt].iov_base = (void*)buf;
+    of->iov[of->iovcnt].iov_len = len;
+    of->iovcnt++;
+    of->queued += len;
+}
+
+void
+outset_add_zeros(outset_t *os, int i, size_t len) {
+    static const char zeros[ZEROS_CHUNK];
+    for (; len > ZEROS_CHUNK; len -= ZEROS_CHUNK)
+        outset_add(os, i, zeros, ZEROS_CHUNK);
+    outset_add(os, i, zeros, len);
+}
+
+void
+outset_fail(outset_t *os, int i, int err) {
+    if (!os->files[i].err)
+        os->files[i].err = err ? err : EIO;
+}
+
+/* Write out every queued buffer, retrying short writes */
+static void *
+outfile_flush(void *arg) {
+    outfile_t *of = arg;
+    struct iovec *iov = of->iov;
+    int cnt = of->iovcnt;
+
+    while (cnt > 0 && !of->err) {
+        ssize_t r = writev(of->fd, iov, cnt > IOV_MAX ? IOV_MAX : cnt);
+        if (r < 0) {
+            if (errno != EINTR) of->err = errno;
+            continue;
+        }
+        /* Skip what was written */
+        while (cnt > 0 && (size_t)r >= iov->iov_len) {
+            r -= iov->iov_len;
+            iov++;
+            cnt--;
+        }
+        if (cnt > 0) {
+            iov->iov_base = (char*)iov->iov_base + r;
+            iov->iov_len -= r;
+        }
+    }
+
+    return NULL;
+}
+
+static void
+outset_destroy(outset_t *os) {
+    for (size_t i = 0; i < os->size; i++) {
+        free(os->files[i].path);
+        free(os->files[i].tmppath);
+        free(os->files[i].iov);
+    }
+    free(os->files);
+    os->files = NULL;
+    os->size = os->capacity = 0;
+}
+
+int
+outset_commit(outset_t *os, FILE *errf) {
+    /* Submit all files together, concurrently when the batch is large */
+    size_t total = 0;
+    for (size_t i = 0; i < os->size; i++)
+        total += os->files[i].queued;
+
+    pthread_t *th = NULL;
+    int *started = NULL;
+    if (os->size > 1 && total >= THREAD_MIN_BYTES) {
+        th = malloc(os->size * sizeof(pthread_t));
+        started = calloc(os->size, sizeof(int));
+        for (size_t i = 0; i < os->size; i++)
+            started[i] = pthread_create(&th[i], NULL, outfile_flush,
+                &os->files[i]) == 0;
+    }
+
+    for (size_t i = 0; i < os->size; i++) {
+        if (th && started[i]) pthread_join(th[i], NULL);
+        else outfile_flush(&os->files[i]);
+    }
+    free(th);
+    free(started);
+
+    int failed = 0;
+    for (size_t i = 0; i < os->size; i++) {
+        outfile_t *of = &os->files[i];
+        if (close(of->fd) != 0 && !of->err)
+            of->err = errno;
+        if (of->err) {
+            fprintf(errf, "Error writing %s: %s\n", of->path,
+                strerror(of->err));
+            failed = 1;
+        }
+    }
+
+    /* Only replace outputs once every file was written, in reverse order
+        of opening so the image, opened first, changes last: whoever sees
+        a new one also finds the new symbols, lines and listing */
+    for (size_t i = os->size; i-- > 0 && !failed; ) {
+        outfile_t *of = &os->files[i];
+        if (rename(of->tmppath, of->path) != 0) {
+            fprintf(errf, "Error writing %s: %s\n", of->path,
+                strerror(errno));
+            failed = 1;
+        }
+    }
+
+    if (failed) {
+        for (size_t i = 0; i < os->size; i++)
+            unlink(os->files[i].tmppath);
+    }
+
+    outset_destroy(os);
+    return failed ? -1 : 0;
+}
+
+void
+outset_abort(outset_t *os) {
+    for (size_t i = 0; i < os->size; i++) {
+        close(os->files[i].fd);
+        unlink(os->files[i].tmppath);
+    }
+    outset_destroy(os);
+}
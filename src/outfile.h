@@ -0,0 +1,76 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _OUTFILE_H
+#define _OUTFILE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <sys/uio.h>
+
+/* Types */
+
+/* Output file, written to a temporary and renamed over path on commit */
+typedef struct {
+    char *path;
+    char *tmppath;
+    int fd;
+    struct iovec *iov;  /* queued writes */
+    int iovcnt;
+    int iovcap;
+    size_t queued;      /* bytes */
+    int err;            /* errno of the first failure */
+} outfile_t;
+
+typedef struct {
+    outfile_t *files;
+    size_t size;
+    size_t capacity;
+} outset_t;
+
+/* Routines */
+
+void outset_init(outset_t *os);
+
+/* Create a temporary for base + ext, returns its index or -1 */
+int outset_open(outset_t *os, const char *base, const char *ext);
+
+/* Descriptor of the temporary, for streaming writers */
+int outset_fd(outset_t *os, int i);
+
+/* Queue a write, buf must stay valid until commit */
+void outset_add(outset_t *os, int i, const void *buf, size_t len);
+
+/* Queue len zero bytes */
+void outset_add_zeros(outset_t *os, int i, size_t len);
+
+/* Record a failure of a streaming writer */
+void outset_fail(outset_t *os, int i, int err);
+
+/* Flush queued writes and, only if all succeeded, rename the temporaries
+    into place, last opened first. A rename failing stops the rest, so
+    earlier files may already be replaced. Returns 0 or -1, with diagnostics
+    on errf */
+int outset_commit(outset_t *os, FILE *errf);
+
+/* Remove the temporaries */
+void outset_abort(outset_t *os);
+
+#endif /* _OUTFILE_H */
@@ -0,0 +1,105 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    strmap.c: String keyed hash map
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "strmap.h"
+
+/* Tunables */
+#define STRMAP_INIT_SIZE    16  /* entries */
+
+/* FNV-1a */
+uint32_t
+strmap_hash(const char *key, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)key[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+void
+strmap_init(strmap_t *m, size_t hint) {
+    m->capacity = STRMAP_INIT_SIZE;
+    while (m->capacity < 2 * hint) m->capacity *= 2;
+    m->table = calloc(m->capacity, sizeof(strmap_entry_t));
+    m->size = 0;
+}
+
+void
+strmap_destroy(strmap_t *m) {
+    free(m->table);
+    m->table = NULL;
+    m->size = m->capacity = 0;
+}
+
+static strmap_entry_t *
+strmap_slot(strmap_entry_t *table, size_t capacity, const char *key,
+    uint32_t h)
+{
+    size_t i = h & (capacity - 1);
+    while (table[i].key
+        && (table[i].hash != h || strcmp(table[i].key, key) != 0))
+    {
+        i = (i + 1) & (capacity - 1);
+    }
+    return &table[i];
+}
+
+int
+strmap_get(const strmap_t *m, const char *key, uint32_t *value) {
+    strmap_entry_t *e = strmap_slot(m->table, m->capacity, key,
+        strmap_hash(key, strlen(key)));
+    if (!e->key) return 0;
+    *value = e->value;
+    return 1;
+}
+
+int
+strmap_put(strmap_t *m, const char *key, uint32_t *value) {
+    /* Keep load under 1/2 */
+    if (2 * (m->size + 1) > m->capacity) {
+        size_t ncap = 2 * m->capacity;
+        strmap_entry_t *nt = calloc(ncap, sizeof(strmap_entry_t));
+        for (size_t i = 0; i < m->capacity; i++)
+            if (m->table[i].key)
+                *strmap_slot(nt, ncap, m->table[i].key, m->table[i].hash) =
+                    m->table[i];
+        free(m->table);
+        m->table = nt;
+        m->capacity = ncap;
+    }
+
+    uint32_t h = strmap_hash(key, strlen(key));
+    strmap_entry_t *e = strmap_slot(m->table, m->capacity, key, h);
+    if (e->key) {
+        *value = e->value;
+        return 1;
+    }
+    e->key = key;
+    e->hash = h;
+    e->value = *value;
+    m->size++;
+    return 0;
+}
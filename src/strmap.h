@@ -0,0 +1,55 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _STRMAP_H
+#define _STRMAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Types */
+
+/* Open addressing string -> index map, keys are not owned */
+typedef struct {
+    const char *key;
+    uint32_t hash;
+    uint32_t value;
+} strmap_entry_t;
+
+typedef struct {
+    strmap_entry_t *table;
+    size_t size;
+    size_t capacity;    /* power of 2 */
+} strmap_t;
+
+/* Routines */
+
+uint32_t strmap_hash(const char *key, size_t len);
+
+void strmap_init(strmap_t *m, size_t hint);
+void strmap_destroy(strmap_t *m);
+
+/* 1 and *value if found, 0 otherwise */
+int strmap_get(const strmap_t *m, const char *key, uint32_t *value);
+
+/* Insert, returns 0, or 1 with the existing value left in *value */
+int strmap_put(strmap_t *m, const char *key, uint32_t *value);
+
+#endif /* _STRMAP_H */
@@ -0,0 +1,214 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    symfile.c: Binary debug symbol file
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "symfile.h"
+#include "bytes.h"
+#include "strmap.h"
+
+/* Sizes in the file */
+#define HEADER_SIZE 40
+#define ENTRY_SIZE  16
+
+#define NO_ENTRY    0xffffffff
+
+uint8_t *
+symfile_build(const symindex_t *si, size_t *len) {
+    size_t n = si->n, strsz = 0;
+    for (size_t i = 0; i < n; i++)
+        strsz += strlen(si->sym[i]->label) + 1;
+
+    uint32_t nbuckets = 1;
+    while (nbuckets < n) nbuckets *= 2;
+
+    size_t entoff = HEADER_SIZE;
+    size_t bucketoff = entoff + n * ENTRY_SIZE;
+    size_t chainoff = bucketoff + nbuckets * 4;
+    size_t stroff = chainoff + n * 4;
+    *len = stroff + strsz;
+
+    uint8_t *buf = calloc(*len, 1);
+    memcpy(buf, SYMFILE_MAGIC, 4);
+    put_u16le(buf + 4, SYMFILE_VERSION);
+    put_u32le(buf + 8, n);
+    put_u32le(buf + 12, nbuckets);
+    put_u32le(buf + 16, strsz);
+    put_u32le(buf + 20, entoff);
+    put_u32le(buf + 24, bucketoff);
+    put_u32le(buf + 28, chainoff);
+    put_u32le(buf + 32, stroff);
+
+    memset(buf + bucketoff, 0xff, nbuckets * 4);
+
+    size_t stridx = 0;
+    for (size_t i = 0; i < n; i++) {
+        const symbol_t *sym = si->sym[i];
+        size_t l = strlen(sym->label);
+
+        uint8_t *p = buf + entoff + i * ENTRY_SIZE;
+        put_u32le(p, sym->address);
+        put_u32le(p + 4, si->size[i]);
+        put_u32le(p + 8, stridx);
+        put_u16le(p + 12, l > 0xffff ? 0xffff : l);
+        p[14] = si->seg[i];
+        p[15] = sym->global;
+
+        memcpy(buf + stroff + stridx, sym->label, l + 1);
+        stridx += l + 1;
+
+        /* Chain into its bucket in entry order, so of duplicate names the
+            lowest address comes first */
+        uint32_t h = strmap_hash(sym->label, l) & (nbuckets - 1);
+        uint8_t *slot = buf + bucketoff + 4 * h;
+        while (get_u32le(slot) != NO_ENTRY)
+            slot = buf + chainoff + 4 * get_u32le(slot);
+        put_u32le(slot, i);
+        put_u32le(buf + chainoff + 4 * i, NO_ENTRY);
+    }
+
+    return buf;
+}
+
+int
+symfile_load(symfile_t *sf, const void *buf, size_t len) {
+    const uint8_t *b = buf;
+    sf->map = b;
+    sf->len = len;
+    sf->mapped = 0;
+
+    if (len < HEADER_SIZE || memcmp(b, SYMFILE_MAGIC, 4) != 0
+        || get_u16le(b + 4) != SYMFILE_VERSION)
+    {
+        return -1;
+    }
+
+    sf->nsyms = get_u32le(b + 8);
+    sf->nbuckets = get_u32le(b + 12);
+    sf->strsz = get_u32le(b + 16);
+    uint64_t entoff = get_u32le(b + 20), bucketoff = get_u32le(b + 24);
+    uint64_t chainoff = get_u32le(b + 28), stroff = get_u32le(b + 32);
+
+    if (sf->nbuckets == 0 || (sf->nbuckets & (sf->nbuckets - 1))
+        || entoff + (uint64_t)sf->nsyms * ENTRY_SIZE > len
+        || bucketoff + 4 * (uint64_t)sf->nbuckets > len
+        || chainoff + 4 * (uint64_t)sf->nsyms > len
+        || stroff + sf->strsz > len
+        || (sf->strsz && b[stroff + sf->strsz - 1] != '\0'))
+    {
+        return -1;
+    }
+
+    sf->entries = b + entoff;
+    sf->buckets = b + bucketoff;
+    sf->chain = b + chainoff;
+    sf->strings = (const char*)b + stroff;
+    return 0;
+}
+
+int
+symfile_open(symfile_t *sf, const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+        close(fd);
+        return -1;
+    }
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return -1;
+
+    if (symfile_load(sf, map, st.st_size) < 0) {
+        munmap(map, st.st_size);
+        return -1;
+    }
+    sf->mapped = 1;
+    return 0;
+}
+
+void
+symfile_close(symfile_t *sf) {
+    if (sf->mapped) munmap((void*)sf->map, sf->len);
+    sf->map = NULL;
+    sf->len = 0;
+}
+
+void
+symfile_entry(const symfile_t *sf, uint32_t i, symfile_entry_t *ent) {
+    const uint8_t *p = sf->entries + i * ENTRY_SIZE;
+    uint32_t name = get_u32le(p + 8);
+    ent->address = get_u32le(p);
+    ent->size = get_u32le(p + 4);
+    ent->label = name < sf->strsz ? sf->strings + name : "";
+    ent->seg = p[14];
+    ent->global = p[15];
+}
+
+long
+symfile_find_addr(const symfile_t *sf, addr_t addr) {
+    /* Last entry at or below addr */
+    uint32_t lo = 0, n = sf->nsyms;
+    while (n > 0) {
+        uint32_t half = n / 2;
+        if (get_u32le(sf->entries + (lo + half) * ENTRY_SIZE) <= addr) {
+            lo += half + 1;
+            n -= half + 1;
+        } else n = half;
+    }
+    if (lo == 0) return -1;
+
+    /* Prefer the first label of several at that address */
+    const uint8_t *p = sf->entries + (lo - 1) * ENTRY_SIZE;
+    addr_t a = get_u32le(p);
+    while (lo > 1 && get_u32le(p - ENTRY_SIZE) == a) {
+        p -= ENTRY_SIZE;
+        lo--;
+    }
+    if (addr - a >= get_u32le(p + 4) && addr != a) return -1;
+    return lo - 1;
+}
+
+long
+symfile_find_name(const symfile_t *sf, const char *label) {
+    size_t l = strlen(label);
+    uint32_t i = get_u32le(sf->buckets
+        + 4 * (strmap_hash(label, l) & (sf->nbuckets - 1)));
+
+    while (i != NO_ENTRY && i < sf->nsyms) {
+        const uint8_t *p = sf->entries + i * ENTRY_SIZE;
+        uint32_t name = get_u32le(p + 8);
+        if (get_u16le(p + 12) == l && name + l < sf->strsz
+            && memcmp(sf->strings + name, label, l + 1) == 0)
+        {
+            return i;
+        }
+        i = get_u32le(sf->chain + 4 * i);
+    }
+    return -1;
+}
@@ -0,0 +1,78 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _SYMFILE_H
+#define _SYMFILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "assembler.h"
+#include "symindex.h"
+
+/* Macros */
+
+#define SYMFILE_MAGIC   "AMSY"
+#define SYMFILE_VERSION 1
+
+/* Types */
+
+/* Binary symbol file, used in place without parsing, see doc/SYMFILE.md */
+typedef struct {
+    const uint8_t *map;
+    size_t len;
+    int mapped;         /* map is ours to munmap */
+    uint32_t nsyms;
+    uint32_t nbuckets;
+    const uint8_t *entries;
+    const uint8_t *buckets;
+    const uint8_t *chain;
+    const char *strings;
+    uint32_t strsz;
+} symfile_t;
+
+typedef struct {
+    addr_t address;
+    uint32_t size;      /* bytes up to the next symbol or segment end */
+    const char *label;
+    segid_t seg;
+    int global;
+} symfile_entry_t;
+
+/* Routines */
+
+/* Whole file in one buffer */
+uint8_t *symfile_build(const symindex_t *si, size_t *len);
+
+/* mmap a file, or use a buffer in memory; 0, or -1 if malformed */
+int symfile_open(symfile_t *sf, const char *path);
+int symfile_load(symfile_t *sf, const void *buf, size_t len);
+void symfile_close(symfile_t *sf);
+
+void symfile_entry(const symfile_t *sf, uint32_t i, symfile_entry_t *ent);
+
+/* Index of the symbol containing addr, O(log n), or -1 */
+long symfile_find_addr(const symfile_t *sf, addr_t addr);
+
+/* Index of the symbol named label, O(1), or -1. Of duplicate names, the
+    one at the lowest address */
+long symfile_find_name(const symfile_t *sf, const char *label);
+
+#endif /* _SYMFILE_H */
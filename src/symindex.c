@@ -0,0 +1,115 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    symindex.c: Address sorted symbol index
+
+*/
+
+#include <stdlib.h>
+
+#include "symindex.h"
+
+typedef struct {
+    const symbol_t *sym;
+    segid_t seg;
+    uint32_t ord;       /* keeps equal addresses in table order */
+} sortsym_t;
+
+static int
+sortsym_cmp(const void *a, const void *b) {
+    const sortsym_t *x = a, *y = b;
+    if (x->sym->address != y->sym->address)
+        return x->sym->address < y->sym->address ? -1 : 1;
+    return x->ord < y->ord ? -1 : x->ord > y->ord;
+}
+
+void
+symindex_build(symindex_t *si, const segment_t *segs) {
+    size_t n = segs[SEG_DATA].symbols->size + segs[SEG_TEXT].symbols->size;
+    sortsym_t *ss = malloc((n + 1) * sizeof(sortsym_t));
+    size_t k = 0;
+
+    for (int s = SEG_DATA; s <= SEG_TEXT; s++) {
+        const symbol_table_t *st = segs[s].symbols;
+        for (size_t i = 0; i < st->size; i++, k++)
+            ss[k] = (sortsym_t){ &st->table[i], s, k };
+    }
+    qsort(ss, n, sizeof(sortsym_t), sortsym_cmp);
+
+    si->n = n;
+    si->address = malloc((n + 1) * sizeof(addr_t));
+    si->size = malloc((n + 1) * sizeof(uint32_t));
+    si->back = malloc((n + 1) * sizeof(uint32_t));
+    si->sym = malloc((n + 1) * sizeof(symbol_t*));
+    si->seg = malloc(n + 1);
+
+    for (size_t i = 0; i < n; i++) {
+        si->address[i] = ss[i].sym->address;
+        si->sym[i] = ss[i].sym;
+        si->seg[i] = ss[i].seg;
+        si->back[i] = i > 0 && si->address[i - 1] == si->address[i]
+            ? si->back[i - 1] + 1 : 0;
+    }
+
+    /* Size up to the next symbol of the segment, or its end. Labels
+        sharing an address share the size */
+    addr_t next[2] = { segs[SEG_DATA].org + segs[SEG_DATA].size,
+        segs[SEG_TEXT].org + segs[SEG_TEXT].size };
+    uint32_t nextsize[2] = { 0, 0 };
+    for (size_t i = n; i-- > 0;) {
+        segid_t sg = si->seg[i];
+        addr_t a = si->address[i];
+        if (a < next[sg]) {
+            nextsize[sg] = next[sg] - a;
+            next[sg] = a;
+        }
+        si->size[i] = a == next[sg] ? nextsize[sg] : 0;
+    }
+
+    free(ss);
+}
+
+void
+symindex_destroy(symindex_t *si) {
+    free(si->address);
+    free(si->size);
+    free(si->back);
+    free(si->sym);
+    free(si->seg);
+    si->n = 0;
+}
+
+long
+symindex_find(const symindex_t *si, addr_t addr) {
+    size_t n = si->n;
+    if (n == 0 || addr < si->address[0]) return -1;
+
+    /* Last entry at or below addr, the loop body compiles to a cmov */
+    const addr_t *base = si->address;
+    while (n > 1) {
+        size_t half = n / 2;
+        base = base[half] <= addr ? base + half : base;
+        n -= half;
+    }
+    size_t i = base - si->address;
+    i -= si->back[i];
+
+    if (addr - si->address[i] >= si->size[i] && addr != si->address[i])
+        return -1;
+    return i;
+}
@@ -0,0 +1,53 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _SYMINDEX_H
+#define _SYMINDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "assembler.h"
+
+/* Types */
+
+/* Labels of both segments sorted by address, one array per field so the
+    search only touches addresses. Labels at the same address keep their
+    source order */
+struct symindex {
+    addr_t *address;
+    uint32_t *size;     /* bytes up to the next symbol or segment end */
+    uint32_t *back;     /* entries back to the first at the same address */
+    const symbol_t **sym;
+    uint8_t *seg;
+    size_t n;
+};
+
+/* Routines */
+
+/* From the symbol tables once every label has its final address */
+void symindex_build(symindex_t *si, const segment_t *segs);
+void symindex_destroy(symindex_t *si);
+
+/* Index of the symbol containing addr, first of those at its address,
+    or -1 */
+long symindex_find(const symindex_t *si, addr_t addr);
+
+#endif /* _SYMINDEX_H */
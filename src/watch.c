@@ -0,0 +1,137 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    watch.c: Waiting for source files to change
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+
+#include "watch.h"
+
+/* Tunables */
+#define WATCH_EVENTS    (IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE \
+    | IN_DELETE | IN_MOVED_FROM)
+#define EVENT_BUFF_SIZE (16 * (sizeof(struct inotify_event) + NAME_MAX + 1))
+
+int
+watcher_init(watcher_t *w) {
+    w->fd = inotify_init1(IN_CLOEXEC);
+    w->dirs = NULL;
+    w->ndirs = 0;
+    return w->fd < 0 ? -1 : 0;
+}
+
+void
+watcher_destroy(watcher_t *w) {
+    for (size_t i = 0; i < w->ndirs; i++)
+        free(w->dirs[i]);
+    free(w->dirs);
+    close(w->fd);
+}
+
+static const char *
+base_name(const char *path) {
+    const char *slash = strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
+
+/* Watch the directory of every file used, adding a directory again just
+    returns its descriptor */
+static int
+watch_files(watcher_t *w, filecache_t *fc) {
+    for (size_t i = 0; i < fc->size; i++) {
+        const char *path = fc->files[i]->path;
+        if (fc->files[i]->checked != fc->run) continue;
+
+        const char *base = base_name(path);
+        char *dir = base == path ? strdup(".")
+            : strndup(path, base - path);
+        int wd = inotify_add_watch(w->fd, dir, WATCH_EVENTS);
+        if (wd < 0) {
+            free(dir);
+            if (errno == ENOENT || errno == ENOTDIR)
+                continue; /* no directory to create the file in yet */
+            return -1;
+        }
+
+        if ((size_t)wd >= w->ndirs) {
+            w->dirs = realloc(w->dirs, (wd + 1) * sizeof(char*));
+            memset(w->dirs + w->ndirs, 0, (wd + 1 - w->ndirs) * sizeof(char*));
+            w->ndirs = wd + 1;
+        }
+        if (w->dirs[wd]) free(dir);
+        else w->dirs[wd] = dir;
+    }
+    return 0;
+}
+
+/* Read pending events, 1 if one names a file used, 0 if none did, -1 on
+    error or timeout */
+static int
+read_events(watcher_t *w, filecache_t *fc, int timeout) {
+    struct pollfd pfd = { w->fd, POLLIN, 0 };
+    int r = poll(&pfd, 1, timeout);
+    if (r <= 0) return r < 0 && errno != EINTR ? -2 : -1;
+
+    char buf[EVENT_BUFF_SIZE]
+        __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t len = read(w->fd, buf, sizeof(buf));
+    if (len < 0) return errno == EINTR || errno == EAGAIN ? 0 : -2;
+
+    int relevant = 0;
+    for (char *p = buf; p < buf + len; ) {
+        struct inotify_event *ev = (struct inotify_event*)p;
+        p += sizeof(struct inotify_event) + ev->len;
+        if (ev->mask & IN_Q_OVERFLOW) relevant = 1;
+        if (!ev->len) continue;
+
+        for (size_t i = 0; i < fc->size && !relevant; i++) {
+            cached_file_t *cf = fc->files[i];
+            relevant = cf->checked == fc->run
+                && strcmp(base_name(cf->path), ev->name) == 0;
+        }
+    }
+    return relevant;
+}
+
+int
+watcher_wait(watcher_t *w, filecache_t *fc, int debounce_ms) {
+    if (watch_files(w, fc) < 0)
+        return -1;
+
+    for (;;) {
+        int r = read_events(w, fc, -1);
+        if (r == -2) return -1;
+        if (r <= 0) continue;
+
+        /* Let a burst of writes settle */
+        while ((r = read_events(w, fc, debounce_ms)) >= 0);
+        if (r == -2) return -1;
+
+        /* Saving without changes is not worth a run */
+        if (filecache_refresh(fc) > 0)
+            return 0;
+    }
+}
@@ -0,0 +1,45 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _WATCH_H
+#define _WATCH_H
+
+#include "filecache.h"
+
+/* Types */
+
+/* inotify watches on the directories of the files of a cache, so files
+    replaced by rename are noticed too */
+typedef struct {
+    int fd;
+    char **dirs;        /* by watch descriptor */
+    size_t ndirs;
+} watcher_t;
+
+/* Routines */
+
+int watcher_init(watcher_t *w);
+void watcher_destroy(watcher_t *w);
+
+/* Block until a file used in the last run of the cache changes contents,
+    after writes to it have settled for debounce_ms. 0, or -1 on error */
+int watcher_wait(watcher_t *w, filecache_t *fc, int debounce_ms);
+
+#endif /* _WATCH_H */
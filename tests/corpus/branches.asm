@@ -0,0 +1,81 @@
+# Out of range beq, relaxed into beq, beq and j. Relaxing "out" pushes
+# "edge" from the last reachable word out of reach of "near" as well
+        .macro f1
+        add $t0, $t0, $t1
+        add $t0, $t0, $t1
+        .endm
+        .macro f2
+        f1
+        f1
+        .endm
+        .macro f3
+        f2
+        f2
+        .endm
+        .macro f4
+        f3
+        f3
+        .endm
+        .macro f5
+        f4
+        f4
+        .endm
+        .macro f6
+        f5
+        f5
+        .endm
+        .macro f7
+        f6
+        f6
+        .endm
+        .macro f8
+        f7
+        f7
+        .endm
+        .macro f9
+        f8
+        f8
+        .endm
+        .macro f10
+        f9
+        f9
+        .endm
+        .macro f11
+        f10
+        f10
+        .endm
+        .macro f12
+        f11
+        f11
+        .endm
+        .macro f13
+        f12
+        f12
+        .endm
+        .macro f14
+        f13
+        f13
+        .endm
+        .text
+start:  beq $t0, $t1, short
+short:  beq $t0, $t1, edge
+out:    beq $t0, $t1, far
+        f14
+        f13
+        f12
+        f11
+        f10
+        f9
+        f8
+        f7
+        f6
+        f5
+        f4
+        f3
+        f2
+        f1
+edge:   add $t0, $t0, $t1
+        add $t0, $t0, $t1
+far:    j start
+        beq $zero, $zero, start
+        beq $t0, $t1, far
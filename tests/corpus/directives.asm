@@ -0,0 +1,31 @@
+# Every directive
+        .globl main
+        .extern elsewhere
+        .macro push reg
+        sw \reg, 0($sp)
+        .endm
+        .macro long_xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+        sw $zero, 0($sp)
+        .endm
+        .data
+bytes:  .byte 1, 2, 0xff
+halves: .half 0x1234, 0xffff
+        .align 1
+words:  .word 0x12345678, 0, 0xffffffff
+str:    .ascii "abc"
+strz:   .asciiz "hello world"
+        .align 2
+gap:    .space 13
+        .align 2
+blob:   .incbin "blob.bin"
+part:   .incbin "blob.bin", 4, 3
+        .include "common.inc"
+        .text
+main:   push $ra
+        push $t0
+        lui $t1, %hi(words)
+        ori $t1, $t1, %lo(words)
+        j main
+        long_xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+        .data
+more:   .word 7
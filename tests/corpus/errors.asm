@@ -0,0 +1,17 @@
+# Diagnostics
+        .data
+        .word 1
+        .frobnicate 3
+        .align 3
+        .text
+        add $t0, $x1, $t2
+        frob $t0
+        beq $t0, $t1, nowhere
+        .word 4
+        add $t0 $t1, $t2
+        ori $t0, $t0, foo
+        .data
+        .word zz
+        .space 0xffffffff
+        .ascii "no end
+        .asciiz "abc
@@ -0,0 +1,30 @@
+# Every instruction form, with every register name
+        .data
+table:  .word 1, 2, 3, 4
+        .text
+start:  and $zero, $at, $v0
+        or $v1, $a0, $a1
+        add $a2, $a3, $t0
+        sub $t1, $t2, $t3
+        slt $t4, $t5, $t6
+        and $t7, $s0, $s1
+        or $s2, $s3, $s4
+        add $s5, $s6, $s7
+        sub $t8, $t9, $k0
+        slt $k1, $gp, $sp
+        add $fp, $ra, $zero
+        ori $t0, $t1, 0xffff
+        ori $t0, $zero, 0
+        lw $t0, 0($sp)
+        lw $ra, 0x7ffc($sp)
+        sw $t0, 4($fp)
+        sw $zero, 0xfffc ( $gp )
+        lui $at, 0x1001
+        lui $t0, %hi(table)
+        ori $t0, $t0, %lo(table)
+back:   beq $t0, $t1, back
+        beq $zero, $zero, ahead
+        beq $t0, $t1, start
+        j start
+        j ahead
+ahead:  j back
@@ -0,0 +1,8195 @@
+# generated by golden --generate-labels 4096
+        .data
+d0:     .word 0
+d1:     .word 506952114
+d2:     .word 1013904228
+d3:     .word 1520856342
+d4:     .word 2027808456
+d5:     .word 387276923
+d6:     .word 894229037
+d7:     .word 1401181151
+d8:     .word 1908133265
+d9:     .word 267601732
+d10:     .word 774553846
+d11:     .word 1281505960
+d12:     .word 1788458074
+d13:     .word 147926541
+d14:     .word 654878655
+d15:     .word 1161830769
+d16:     .word 1668782883
+d17:     .word 28251350
+d18:     .word 535203464
+d19:     .word 1042155578
+d20:     .word 1549107692
+d21:     .word 2056059806
+d22:     .word 415528273
+d23:     .word 922480387
+d24:     .word 1429432501
+d25:     .word 1936384615
+d26:     .word 295853082
+d27:     .word 802805196
+d28:     .word 1309757310
+d29:     .word 1816709424
+d30:     .word 176177891
+d31:     .word 683130005
+d32:     .word 1190082119
+d33:     .word 1697034233
+d34:     .word 56502700
+d35:     .word 563454814
+d36:     .word 1070406928
+d37:     .word 1577359042
+d38:     .word 2084311156
+d39:     .word 443779623
+d40:     .word 950731737
+d41:     .word 1457683851
+d42:     .word 1964635965
+d43:     .word 324104432
+d44:     .word 831056546
+d45:     .word 1338008660
+d46:     .word 1844960774
+d47:     .word 204429241
+d48:     .word 711381355
+d49:     .word 1218333469
+d50:     .word 1725285583
+d51:     .word 84754050
+d52:     .word 591706164
+d53:     .word 1098658278
+d54:     .word 1605610392
+d55:     .word 2112562506
+d56:     .word 472030973
+d57:     .word 978983087
+d58:     .word 1485935201
+d59:     .word 1992887315
+d60:     .word 352355782
+d61:     .word 859307896
+d62:     .word 1366260010
+d63:     .word 1873212124
+d64:     .word 232680591
+d65:     .word 739632705
+d66:     .word 1246584819
+d67:     .word 1753536933
+d68:     .word 113005400
+d69:     .word 619957514
+d70:     .word 1126909628
+d71:     .word 1633861742
+d72:     .word 2140813856
+d73:     .word 500282323
+d74:     .word 1007234437
+d75:     .word 1514186551
+d76:     .word 2021138665
+d77:     .word 380607132
+d78:     .word 887559246
+d79:     .word 1394511360
+d80:     .word 1901463474
+d81:     .word 260931941
+d82:     .word 767884055
+d83:     .word 1274836169
+d84:     .word 1781788283
+d85:     .word 141256750
+d86:     .word 648208864
+d87:     .word 1155160978
+d88:     .word 1662113092
+d89:     .word 21581559
+d90:     .word 528533673
+d91:     .word 1035485787
+d92:     .word 1542437901
+d93:     .word 2049390015
+d94:     .word 408858482
+d95:     .word 915810596
+d96:     .word 1422762710
+d97:     .word 1929714824
+d98:     .word 289183291
+d99:     .word 796135405
+d100:     .word 1303087519
+d101:     .word 1810039633
+d102:     .word 169508100
+d103:     .word 676460214
+d104:     .word 1183412328
+d105:     .word 1690364442
+d106:     .word 49832909
+d107:     .word 556785023
+d108:     .word 1063737137
+d109:     .word 1570689251
+d110:     .word 2077641365
+d111:     .word 437109832
+d112:     .word 944061946
+d113:     .word 1451014060
+d114:     .word 1957966174
+d115:     .word 317434641
+d116:     .word 824386755
+d117:     .word 1331338869
+d118:     .word 1838290983
+d119:     .word 197759450
+d120:     .word 704711564
+d121:     .word 1211663678
+d122:     .word 1718615792
+d123:     .word 78084259
+d124:     .word 585036373
+d125:     .word 1091988487
+d126:     .word 1598940601
+d127:     .word 2105892715
+d128:     .word 465361182
+d129:     .word 972313296
+d130:     .word 1479265410
+d131:     .word 1986217524
+d132:     .word 345685991
+d133:     .word 852638105
+d134:     .word 1359590219
+d135:     .word 1866542333
+d136:     .word 226010800
+d137:     .word 732962914
+d138:     .word 1239915028
+d139:     .word 1746867142
+d140:     .word 106335609
+d141:     .word 613287723
+d142:     .word 1120239837
+d143:     .word 1627191951
+d144:     .word 2134144065
+d145:     .word 493612532
+d146:     .word 1000564646
+d147:     .word 1507516760
+d148:     .word 2014468874
+d149:     .word 373937341
+d150:     .word 880889455
+d151:     .word 1387841569
+d152:     .word 1894793683
+d153:     .word 254262150
+d154:     .word 761214264
+d155:     .word 1268166378
+d156:     .word 1775118492
+d157:     .word 134586959
+d158:     .word 641539073
+d159:     .word 1148491187
+d160:     .word 1655443301
+d161:     .word 14911768
+d162:     .word 521863882
+d163:     .word 1028815996
+d164:     .word 1535768110
+d165:     .word 2042720224
+d166:     .word 402188691
+d167:     .word 909140805
+d168:     .word 1416092919
+d169:     .word 1923045033
+d170:     .word 282513500
+d171:     .word 789465614
+d172:     .word 1296417728
+d173:     .word 1803369842
+d174:     .word 162838309
+d175:     .word 669790423
+d176:     .word 1176742537
+d177:     .word 1683694651
+d178:     .word 43163118
+d179:     .word 550115232
+d180:     .word 1057067346
+d181:     .word 1564019460
+d182:     .word 2070971574
+d183:     .word 430440041
+d184:     .word 937392155
+d185:     .word 1444344269
+d186:     .word 1951296383
+d187:     .word 310764850
+d188:     .word 817716964
+d189:     .word 1324669078
+d190:     .word 1831621192
+d191:     .word 191089659
+d192:     .word 698041773
+d193:     .word 1204993887
+d194:     .word 1711946001
+d195:     .word 71414468
+d196:     .word 578366582
+d197:     .word 1085318696
+d198:     .word 1592270810
+d199:     .word 2099222924
+d200:     .word 458691391
+d201:     .word 965643505
+d202:     .word 1472595619
+d203:     .word 1979547733
+d204:     .word 339016200
+d205:     .word 845968314
+d206:     .word 1352920428
+d207:     .word 1859872542
+d208:     .word 219341009
+d209:     .word 726293123
+d210:     .word 1233245237
+d211:     .word 1740197351
+d212:     .word 99665818
+d213:     .word 606617932
+d214:     .word 1113570046
+d215:     .word 1620522160
+d216:     .word 2127474274
+d217:     .word 486942741
+d218:     .word 993894855
+d219:     .word 1500846969
+d220:     .word 2007799083
+d221:     .word 367267550
+d222:     .word 874219664
+d223:     .word 1381171778
+d224:     .word 1888123892
+d225:     .word 247592359
+d226:     .word 754544473
+d227:     .word 1261496587
+d228:     .word 1768448701
+d229:     .word 127917168
+d230:     .word 634869282
+d231:     .word 1141821396
+d232:     .word 1648773510
+d233:     .word 8241977
+d234:     .word 515194091
+d235:     .word 1022146205
+d236:     .word 1529098319
+d237:     .word 2036050433
+d238:     .word 395518900
+d239:     .word 902471014
+d240:     .word 1409423128
+d241:     .word 1916375242
+d242:     .word 275843709
+d243:     .word 782795823
+d244:     .word 1289747937
+d245:     .word 1796700051
+d246:     .word 156168518
+d247:     .word 663120632
+d248:     .word 1170072746
+d249:     .word 1677024860
+d250:     .word 36493327
+d251:     .word 543445441
+d252:     .word 1050397555
+d253:     .word 1557349669
+d254:     .word 2064301783
+d255:     .word 423770250
+d256:     .word 930722364
+d257:     .word 1437674478
+d258:     .word 1944626592
+d259:     .word 304095059
+d260:     .word 811047173
+d261:     .word 1317999287
+d262:     .word 1824951401
+d263:     .word 184419868
+d264:     .word 691371982
+d265:     .word 1198324096
+d266:     .word 1705276210
+d267:     .word 64744677
+d268:     .word 571696791
+d269:     .word 1078648905
+d270:     .word 1585601019
+d271:     .word 2092553133
+d272:     .word 452021600
+d273:     .word 958973714
+d274:     .word 1465925828
+d275:     .word 1972877942
+d276:     .word 332346409
+d277:     .word 839298523
+d278:     .word 1346250637
+d279:     .word 1853202751
+d280:     .word 212671218
+d281:     .word 719623332
+d282:     .word 1226575446
+d283:     .word 1733527560
+d284:     .word 92996027
+d285:     .word 599948141
+d286:     .word 1106900255
+d287:     .word 1613852369
+d288:     .word 2120804483
+d289:     .word 480272950
+d290:     .word 987225064
+d291:     .word 1494177178
+d292:     .word 2001129292
+d293:     .word 360597759
+d294:     .word 867549873
+d295:     .word 1374501987
+d296:     .word 1881454101
+d297:     .word 240922568
+d298:     .word 747874682
+d299:     .word 1254826796
+d300:     .word 1761778910
+d301:     .word 121247377
+d302:     .word 628199491
+d303:     .word 1135151605
+d304:     .word 1642103719
+d305:     .word 1572186
+d306:     .word 508524300
+d307:     .word 1015476414
+d308:     .word 1522428528
+d309:     .word 2029380642
+d310:     .word 388849109
+d311:     .word 895801223
+d312:     .word 1402753337
+d313:     .word 1909705451
+d314:     .word 269173918
+d315:     .word 776126032
+d316:     .word 1283078146
+d317:     .word 1790030260
+d318:     .word 149498727
+d319:     .word 656450841
+d320:     .word 1163402955
+d321:     .word 1670355069
+d322:     .word 29823536
+d323:     .word 536775650
+d324:     .word 1043727764
+d325:     .word 1550679878
+d326:     .word 2057631992
+d327:     .word 417100459
+d328:     .word 924052573
+d329:     .word 1431004687
+d330:     .word 1937956801
+d331:     .word 297425268
+d332:     .word 804377382
+d333:     .word 1311329496
+d334:     .word 1818281610
+d335:     .word 177750077
+d336:     .word 684702191
+d337:     .word 1191654305
+d338:     .word 1698606419
+d339:     .word 58074886
+d340:     .word 565027000
+d341:     .word 1071979114
+d342:     .word 1578931228
+d343:     .word 2085883342
+d344:     .word 445351809
+d345:     .word 952303923
+d346:     .word 1459256037
+d347:     .word 1966208151
+d348:     .word 325676618
+d349:     .word 832628732
+d350:     .word 1339580846
+d351:     .word 1846532960
+d352:     .word 206001427
+d353:     .word 712953541
+d354:     .word 1219905655
+d355:     .word 1726857769
+d356:     .word 86326236
+d357:     .word 593278350
+d358:     .word 1100230464
+d359:     .word 1607182578
+d360:     .word 2114134692
+d361:     .word 473603159
+d362:     .word 980555273
+d363:     .word 1487507387
+d364:     .word 1994459501
+d365:     .word 353927968
+d366:     .word 860880082
+d367:     .word 1367832196
+d368:     .word 1874784310
+d369:     .word 234252777
+d370:     .word 741204891
+d371:     .word 1248157005
+d372:     .word 1755109119
+d373:     .word 114577586
+d374:     .word 621529700
+d375:     .word 1128481814
+d376:     .word 1635433928
+d377:     .word 2142386042
+d378:     .word 501854509
+d379:     .word 1008806623
+d380:     .word 1515758737
+d381:     .word 2022710851
+d382:     .word 382179318
+d383:     .word 889131432
+d384:     .word 1396083546
+d385:     .word 1903035660
+d386:     .word 262504127
+d387:     .word 769456241
+d388:     .word 1276408355
+d389:     .word 1783360469
+d390:     .word 142828936
+d391:     .word 649781050
+d392:     .word 1156733164
+d393:     .word 1663685278
+d394:     .word 23153745
+d395:     .word 530105859
+d396:     .word 1037057973
+d397:     .word 1544010087
+d398:     .word 2050962201
+d399:     .word 410430668
+d400:     .word 917382782
+d401:     .word 1424334896
+d402:     .word 1931287010
+d403:     .word 290755477
+d404:     .word 797707591
+d405:     .word 1304659705
+d406:     .word 1811611819
+d407:     .word 171080286
+d408:     .word 678032400
+d409:     .word 1184984514
+d410:     .word 1691936628
+d411:     .word 51405095
+d412:     .word 558357209
+d413:     .word 1065309323
+d414:     .word 1572261437
+d415:     .word 2079213551
+d416:     .word 438682018
+d417:     .word 945634132
+d418:     .word 1452586246
+d419:     .word 1959538360
+d420:     .word 319006827
+d421:     .word 825958941
+d422:     .word 1332911055
+d423:     .word 1839863169
+d424:     .word 199331636
+d425:     .word 706283750
+d426:     .word 1213235864
+d427:     .word 1720187978
+d428:     .word 79656445
+d429:     .word 586608559
+d430:     .word 1093560673
+d431:     .word 1600512787
+d432:     .word 2107464901
+d433:     .word 466933368
+d434:     .word 973885482
+d435:     .word 1480837596
+d436:     .word 1987789710
+d437:     .word 347258177
+d438:     .word 854210291
+d439:     .word 1361162405
+d440:     .word 1868114519
+d441:     .word 227582986
+d442:     .word 734535100
+d443:     .word 1241487214
+d444:     .word 1748439328
+d445:     .word 107907795
+d446:     .word 614859909
+d447:     .word 1121812023
+d448:     .word 1628764137
+d449:     .word 2135716251
+d450:     .word 495184718
+d451:     .word 1002136832
+d452:     .word 1509088946
+d453:     .word 2016041060
+d454:     .word 375509527
+d455:     .word 882461641
+d456:     .word 1389413755
+d457:     .word 1896365869
+d458:     .word 255834336
+d459:     .word 762786450
+d460:     .word 1269738564
+d461:     .word 1776690678
+d462:     .word 136159145
+d463:     .word 643111259
+d464:     .word 1150063373
+d465:     .word 1657015487
+d466:     .word 16483954
+d467:     .word 523436068
+d468:     .word 1030388182
+d469:     .word 1537340296
+d470:     .word 2044292410
+d471:     .word 403760877
+d472:     .word 910712991
+d473:     .word 1417665105
+d474:     .word 1924617219
+d475:     .word 284085686
+d476:     .word 791037800
+d477:     .word 1297989914
+d478:     .word 1804942028
+d479:     .word 164410495
+d480:     .word 671362609
+d481:     .word 1178314723
+d482:     .word 1685266837
+d483:     .word 44735304
+d484:     .word 551687418
+d485:     .word 1058639532
+d486:     .word 1565591646
+d487:     .word 2072543760
+d488:     .word 432012227
+d489:     .word 938964341
+d490:     .word 1445916455
+d491:     .word 1952868569
+d492:     .word 312337036
+d493:     .word 819289150
+d494:     .word 1326241264
+d495:     .word 1833193378
+d496:     .word 192661845
+d497:     .word 699613959
+d498:     .word 1206566073
+d499:     .word 1713518187
+d500:     .word 72986654
+d501:     .word 579938768
+d502:     .word 1086890882
+d503:     .word 1593842996
+d504:     .word 2100795110
+d505:     .word 460263577
+d506:     .word 967215691
+d507:     .word 1474167805
+d508:     .word 1981119919
+d509:     .word 340588386
+d510:     .word 847540500
+d511:     .word 1354492614
+d512:     .word 1861444728
+d513:     .word 220913195
+d514:     .word 727865309
+d515:     .word 1234817423
+d516:     .word 1741769537
+d517:     .word 101238004
+d518:     .word 608190118
+d519:     .word 1115142232
+d520:     .word 1622094346
+d521:     .word 2129046460
+d522:     .word 488514927
+d523:     .word 995467041
+d524:     .word 1502419155
+d525:     .word 2009371269
+d526:     .word 368839736
+d527:     .word 875791850
+d528:     .word 1382743964
+d529:     .word 1889696078
+d530:     .word 249164545
+d531:     .word 756116659
+d532:     .word 1263068773
+d533:     .word 1770020887
+d534:     .word 129489354
+d535:     .word 636441468
+d536:     .word 1143393582
+d537:     .word 1650345696
+d538:     .word 9814163
+d539:     .word 516766277
+d540:     .word 1023718391
+d541:     .word 1530670505
+d542:     .word 2037622619
+d543:     .word 397091086
+d544:     .word 904043200
+d545:     .word 1410995314
+d546:     .word 1917947428
+d547:     .word 277415895
+d548:     .word 784368009
+d549:     .word 1291320123
+d550:     .word 1798272237
+d551:     .word 157740704
+d552:     .word 664692818
+d553:     .word 1171644932
+d554:     .word 1678597046
+d555:     .word 38065513
+d556:     .word 545017627
+d557:     .word 1051969741
+d558:     .word 1558921855
+d559:     .word 2065873969
+d560:     .word 425342436
+d561:     .word 932294550
+d562:     .word 1439246664
+d563:     .word 1946198778
+d564:     .word 305667245
+d565:     .word 812619359
+d566:     .word 1319571473
+d567:     .word 1826523587
+d568:     .word 185992054
+d569:     .word 692944168
+d570:     .word 1199896282
+d571:     .word 1706848396
+d572:     .word 66316863
+d573:     .word 573268977
+d574:     .word 1080221091
+d575:     .word 1587173205
+d576:     .word 2094125319
+d577:     .word 453593786
+d578:     .word 960545900
+d579:     .word 1467498014
+d580:     .word 1974450128
+d581:     .word 333918595
+d582:     .word 840870709
+d583:     .word 1347822823
+d584:     .word 1854774937
+d585:     .word 214243404
+d586:     .word 721195518
+d587:     .word 1228147632
+d588:     .word 1735099746
+d589:     .word 94568213
+d590:     .word 601520327
+d591:     .word 1108472441
+d592:     .word 1615424555
+d593:     .word 2122376669
+d594:     .word 481845136
+d595:     .word 988797250
+d596:     .word 1495749364
+d597:     .word 2002701478
+d598:     .word 362169945
+d599:     .word 869122059
+d600:     .word 1376074173
+d601:     .word 1883026287
+d602:     .word 242494754
+d603:     .word 749446868
+d604:     .word 1256398982
+d605:     .word 1763351096
+d606:     .word 122819563
+d607:     .word 629771677
+d608:     .word 1136723791
+d609:     .word 1643675905
+d610:     .word 3144372
+d611:     .word 510096486
+d612:     .word 1017048600
+d613:     .word 1524000714
+d614:     .word 2030952828
+d615:     .word 390421295
+d616:     .word 897373409
+d617:     .word 1404325523
+d618:     .word 1911277637
+d619:     .word 270746104
+d620:     .word 777698218
+d621:     .word 1284650332
+d622:     .word 1791602446
+d623:     .word 151070913
+d624:     .word 658023027
+d625:     .word 1164975141
+d626:     .word 1671927255
+d627:     .word 31395722
+d628:     .word 538347836
+d629:     .word 1045299950
+d630:     .word 1552252064
+d631:     .word 2059204178
+d632:     .word 418672645
+d633:     .word 925624759
+d634:     .word 1432576873
+d635:     .word 1939528987
+d636:     .word 298997454
+d637:     .word 805949568
+d638:     .word 1312901682
+d639:     .word 1819853796
+d640:     .word 179322263
+d641:     .word 686274377
+d642:     .word 1193226491
+d643:     .word 1700178605
+d644:     .word 59647072
+d645:     .word 566599186
+d646:     .word 1073551300
+d647:     .word 1580503414
+d648:     .word 2087455528
+d649:     .word 446923995
+d650:     .word 953876109
+d651:     .word 1460828223
+d652:     .word 1967780337
+d653:     .word 327248804
+d654:     .word 834200918
+d655:     .word 1341153032
+d656:     .word 1848105146
+d657:     .word 207573613
+d658:     .word 714525727
+d659:     .word 1221477841
+d660:     .word 1728429955
+d661:     .word 87898422
+d662:     .word 594850536
+d663:     .word 1101802650
+d664:     .word 1608754764
+d665:     .word 2115706878
+d666:     .word 475175345
+d667:     .word 982127459
+d668:     .word 1489079573
+d669:     .word 1996031687
+d670:     .word 355500154
+d671:     .word 862452268
+d672:     .word 1369404382
+d673:     .word 1876356496
+d674:     .word 235824963
+d675:     .word 742777077
+d676:     .word 1249729191
+d677:     .word 1756681305
+d678:     .word 116149772
+d679:     .word 623101886
+d680:     .word 1130054000
+d681:     .word 1637006114
+d682:     .word 2143958228
+d683:     .word 503426695
+d684:     .word 1010378809
+d685:     .word 1517330923
+d686:     .word 2024283037
+d687:     .word 383751504
+d688:     .word 890703618
+d689:     .word 1397655732
+d690:     .word 1904607846
+d691:     .word 264076313
+d692:     .word 771028427
+d693:     .word 1277980541
+d694:     .word 1784932655
+d695:     .word 144401122
+d696:     .word 651353236
+d697:     .word 1158305350
+d698:     .word 1665257464
+d699:     .word 24725931
+d700:     .word 531678045
+d701:     .word 1038630159
+d702:     .word 1545582273
+d703:     .word 2052534387
+d704:     .word 412002854
+d705:     .word 918954968
+d706:     .word 1425907082
+d707:     .word 1932859196
+d708:     .word 292327663
+d709:     .word 799279777
+d710:     .word 1306231891
+d711:     .word 1813184005
+d712:     .word 172652472
+d713:     .word 679604586
+d714:     .word 1186556700
+d715:     .word 1693508814
+d716:     .word 52977281
+d717:     .word 559929395
+d718:     .word 1066881509
+d719:     .word 1573833623
+d720:     .word 2080785737
+d721:     .word 440254204
+d722:     .word 947206318
+d723:     .word 1454158432
+d724:     .word 1961110546
+d725:     .word 320579013
+d726:     .word 827531127
+d727:     .word 1334483241
+d728:     .word 1841435355
+d729:     .word 200903822
+d730:     .word 707855936
+d731:     .word 1214808050
+d732:     .word 1721760164
+d733:     .word 81228631
+d734:     .word 588180745
+d735:     .word 1095132859
+d736:     .word 1602084973
+d737:     .word 2109037087
+d738:     .word 468505554
+d739:     .word 975457668
+d740:     .word 1482409782
+d741:     .word 1989361896
+d742:     .word 348830363
+d743:     .word 855782477
+d744:     .word 1362734591
+d745:     .word 1869686705
+d746:     .word 229155172
+d747:     .word 736107286
+d748:     .word 1243059400
+d749:     .word 1750011514
+d750:     .word 109479981
+d751:     .word 616432095
+d752:     .word 1123384209
+d753:     .word 1630336323
+d754:     .word 2137288437
+d755:     .word 496756904
+d756:     .word 1003709018
+d757:     .word 1510661132
+d758:     .word 2017613246
+d759:     .word 377081713
+d760:     .word 884033827
+d761:     .word 1390985941
+d762:     .word 1897938055
+d763:     .word 257406522
+d764:     .word 764358636
+d765:     .word 1271310750
+d766:     .word 1778262864
+d767:     .word 137731331
+d768:     .word 644683445
+d769:     .word 1151635559
+d770:     .word 1658587673
+d771:     .word 18056140
+d772:     .word 525008254
+d773:     .word 1031960368
+d774:     .word 1538912482
+d775:     .word 2045864596
+d776:     .word 405333063
+d777:     .word 912285177
+d778:     .word 1419237291
+d779:     .word 1926189405
+d780:     .word 285657872
+d781:     .word 792609986
+d782:     .word 1299562100
+d783:     .word 1806514214
+d784:     .word 165982681
+d785:     .word 672934795
+d786:     .word 1179886909
+d787:     .word 1686839023
+d788:     .word 46307490
+d789:     .word 553259604
+d790:     .word 1060211718
+d791:     .word 1567163832
+d792:     .word 2074115946
+d793:     .word 433584413
+d794:     .word 940536527
+d795:     .word 1447488641
+d796:     .word 1954440755
+d797:     .word 313909222
+d798:     .word 820861336
+d799:     .word 1327813450
+d800:     .word 1834765564
+d801:     .word 194234031
+d802:     .word 701186145
+d803:     .word 1208138259
+d804:     .word 1715090373
+d805:     .word 74558840
+d806:     .word 581510954
+d807:     .word 1088463068
+d808:     .word 1595415182
+d809:     .word 2102367296
+d810:     .word 461835763
+d811:     .word 968787877
+d812:     .word 1475739991
+d813:     .word 1982692105
+d814:     .word 342160572
+d815:     .word 849112686
+d816:     .word 1356064800
+d817:     .word 1863016914
+d818:     .word 222485381
+d819:     .word 729437495
+d820:     .word 1236389609
+d821:     .word 1743341723
+d822:     .word 102810190
+d823:     .word 609762304
+d824:     .word 1116714418
+d825:     .word 1623666532
+d826:     .word 2130618646
+d827:     .word 490087113
+d828:     .word 997039227
+d829:     .word 1503991341
+d830:     .word 2010943455
+d831:     .word 370411922
+d832:     .word 877364036
+d833:     .word 1384316150
+d834:     .word 1891268264
+d835:     .word 250736731
+d836:     .word 757688845
+d837:     .word 1264640959
+d838:     .word 1771593073
+d839:     .word 131061540
+d840:     .word 638013654
+d841:     .word 1144965768
+d842:     .word 1651917882
+d843:     .word 11386349
+d844:     .word 518338463
+d845:     .word 1025290577
+d846:     .word 1532242691
+d847:     .word 2039194805
+d848:     .word 398663272
+d849:     .word 905615386
+d850:     .word 1412567500
+d851:     .word 1919519614
+d852:     .word 278988081
+d853:     .word 785940195
+d854:     .word 1292892309
+d855:     .word 1799844423
+d856:     .word 159312890
+d857:     .word 666265004
+d858:     .word 1173217118
+d859:     .word 1680169232
+d860:     .word 39637699
+d861:     .word 546589813
+d862:     .word 1053541927
+d863:     .word 1560494041
+d864:     .word 2067446155
+d865:     .word 426914622
+d866:     .word 933866736
+d867:     .word 1440818850
+d868:     .word 1947770964
+d869:     .word 307239431
+d870:     .word 814191545
+d871:     .word 1321143659
+d872:     .word 1828095773
+d873:     .word 187564240
+d874:     .word 694516354
+d875:     .word 1201468468
+d876:     .word 1708420582
+d877:     .word 67889049
+d878:     .word 574841163
+d879:     .word 1081793277
+d880:     .word 1588745391
+d881:     .word 2095697505
+d882:     .word 455165972
+d883:     .word 962118086
+d884:     .word 1469070200
+d885:     .word 1976022314
+d886:     .word 335490781
+d887:     .word 842442895
+d888:     .word 1349395009
+d889:     .word 1856347123
+d890:     .word 215815590
+d891:     .word 722767704
+d892:     .word 1229719818
+d893:     .word 1736671932
+d894:     .word 96140399
+d895:     .word 603092513
+d896:     .word 1110044627
+d897:     .word 1616996741
+d898:     .word 2123948855
+d899:     .word 483417322
+d900:     .word 990369436
+d901:     .word 1497321550
+d902:     .word 2004273664
+d903:     .word 363742131
+d904:     .word 870694245
+d905:     .word 1377646359
+d906:     .word 1884598473
+d907:     .word 244066940
+d908:     .word 751019054
+d909:     .word 1257971168
+d910:     .word 1764923282
+d911:     .word 124391749
+d912:     .word 631343863
+d913:     .word 1138295977
+d914:     .word 1645248091
+d915:     .word 4716558
+d916:     .word 511668672
+d917:     .word 1018620786
+d918:     .word 1525572900
+d919:     .word 2032525014
+d920:     .word 391993481
+d921:     .word 898945595
+d922:     .word 1405897709
+d923:     .word 1912849823
+d924:     .word 272318290
+d925:     .word 779270404
+d926:     .word 1286222518
+d927:     .word 1793174632
+d928:     .word 152643099
+d929:     .word 659595213
+d930:     .word 1166547327
+d931:     .word 1673499441
+d932:     .word 32967908
+d933:     .word 539920022
+d934:     .word 1046872136
+d935:     .word 1553824250
+d936:     .word 2060776364
+d937:     .word 420244831
+d938:     .word 927196945
+d939:     .word 1434149059
+d940:     .word 1941101173
+d941:     .word 300569640
+d942:     .word 807521754
+d943:     .word 1314473868
+d944:     .word 1821425982
+d945:     .word 180894449
+d946:     .word 687846563
+d947:     .word 1194798677
+d948:     .word 1701750791
+d949:     .word 61219258
+d950:     .word 568171372
+d951:     .word 1075123486
+d952:     .word 1582075600
+d953:     .word 2089027714
+d954:     .word 448496181
+d955:     .word 955448295
+d956:     .word 1462400409
+d957:     .word 1969352523
+d958:     .word 328820990
+d959:     .word 835773104
+d960:     .word 1342725218
+d961:     .word 1849677332
+d962:     .word 209145799
+d963:     .word 716097913
+d964:     .word 1223050027
+d965:     .word 1730002141
+d966:     .word 89470608
+d967:     .word 596422722
+d968:     .word 1103374836
+d969:     .word 1610326950
+d970:     .word 2117279064
+d971:     .word 476747531
+d972:     .word 983699645
+d973:     .word 1490651759
+d974:     .word 1997603873
+d975:     .word 357072340
+d976:     .word 864024454
+d977:     .word 1370976568
+d978:     .word 1877928682
+d979:     .word 237397149
+d980:     .word 744349263
+d981:     .word 1251301377
+d982:     .word 1758253491
+d983:     .word 117721958
+d984:     .word 624674072
+d985:     .word 1131626186
+d986:     .word 1638578300
+d987:     .word 2145530414
+d988:     .word 504998881
+d989:     .word 1011950995
+d990:     .word 1518903109
+d991:     .word 2025855223
+d992:     .word 385323690
+d993:     .word 892275804
+d994:     .word 1399227918
+d995:     .word 1906180032
+d996:     .word 265648499
+d997:     .word 772600613
+d998:     .word 1279552727
+d999:     .word 1786504841
+d1000:     .word 145973308
+d1001:     .word 652925422
+d1002:     .word 1159877536
+d1003:     .word 1666829650
+d1004:     .word 26298117
+d1005:     .word 533250231
+d1006:     .word 1040202345
+d1007:     .word 1547154459
+d1008:     .word 2054106573
+d1009:     .word 413575040
+d1010:     .word 920527154
+d1011:     .word 1427479268
+d1012:     .word 1934431382
+d1013:     .word 293899849
+d1014:     .word 800851963
+d1015:     .word 1307804077
+d1016:     .word 1814756191
+d1017:     .word 174224658
+d1018:     .word 681176772
+d1019:     .word 1188128886
+d1020:     .word 1695081000
+d1021:     .word 54549467
+d1022:     .word 561501581
+d1023:     .word 1068453695
+d1024:     .word 1575405809
+d1025:     .word 2082357923
+d1026:     .word 441826390
+d1027:     .word 948778504
+d1028:     .word 1455730618
+d1029:     .word 1962682732
+d1030:     .word 322151199
+d1031:     .word 829103313
+d1032:     .word 1336055427
+d1033:     .word 1843007541
+d1034:     .word 202476008
+d1035:     .word 709428122
+d1036:     .word 1216380236
+d1037:     .word 1723332350
+d1038:     .word 82800817
+d1039:     .word 589752931
+d1040:     .word 1096705045
+d1041:     .word 1603657159
+d1042:     .word 2110609273
+d1043:     .word 470077740
+d1044:     .word 977029854
+d1045:     .word 1483981968
+d1046:     .word 1990934082
+d1047:     .word 350402549
+d1048:     .word 857354663
+d1049:     .word 1364306777
+d1050:     .word 1871258891
+d1051:     .word 230727358
+d1052:     .word 737679472
+d1053:     .word 1244631586
+d1054:     .word 1751583700
+d1055:     .word 111052167
+d1056:     .word 618004281
+d1057:     .word 1124956395
+d1058:     .word 1631908509
+d1059:     .word 2138860623
+d1060:     .word 498329090
+d1061:     .word 1005281204
+d1062:     .word 1512233318
+d1063:     .word 2019185432
+d1064:     .word 378653899
+d1065:     .word 885606013
+d1066:     .word 1392558127
+d1067:     .word 1899510241
+d1068:     .word 258978708
+d1069:     .word 765930822
+d1070:     .word 1272882936
+d1071:     .word 1779835050
+d1072:     .word 139303517
+d1073:     .word 646255631
+d1074:     .word 1153207745
+d1075:     .word 1660159859
+d1076:     .word 19628326
+d1077:     .word 526580440
+d1078:     .word 1033532554
+d1079:     .word 1540484668
+d1080:     .word 2047436782
+d1081:     .word 406905249
+d1082:     .word 913857363
+d1083:     .word 1420809477
+d1084:     .word 1927761591
+d1085:     .word 287230058
+d1086:     .word 794182172
+d1087:     .word 1301134286
+d1088:     .word 1808086400
+d1089:     .word 167554867
+d1090:     .word 674506981
+d1091:     .word 1181459095
+d1092:     .word 1688411209
+d1093:     .word 47879676
+d1094:     .word 554831790
+d1095:     .word 1061783904
+d1096:     .word 1568736018
+d1097:     .word 2075688132
+d1098:     .word 435156599
+d1099:     .word 942108713
+d1100:     .word 1449060827
+d1101:     .word 1956012941
+d1102:     .word 315481408
+d1103:     .word 822433522
+d1104:     .word 1329385636
+d1105:     .word 1836337750
+d1106:     .word 195806217
+d1107:     .word 702758331
+d1108:     .word 1209710445
+d1109:     .word 1716662559
+d1110:     .word 76131026
+d1111:     .word 583083140
+d1112:     .word 1090035254
+d1113:     .word 1596987368
+d1114:     .word 2103939482
+d1115:     .word 463407949
+d1116:     .word 970360063
+d1117:     .word 1477312177
+d1118:     .word 1984264291
+d1119:     .word 343732758
+d1120:     .word 850684872
+d1121:     .word 1357636986
+d1122:     .word 1864589100
+d1123:     .word 224057567
+d1124:     .word 731009681
+d1125:     .word 1237961795
+d1126:     .word 1744913909
+d1127:     .word 104382376
+d1128:     .word 611334490
+d1129:     .word 1118286604
+d1130:     .word 1625238718
+d1131:     .word 2132190832
+d1132:     .word 491659299
+d1133:     .word 998611413
+d1134:     .word 1505563527
+d1135:     .word 2012515641
+d1136:     .word 371984108
+d1137:     .word 878936222
+d1138:     .word 1385888336
+d1139:     .word 1892840450
+d1140:     .word 252308917
+d1141:     .word 759261031
+d1142:     .word 1266213145
+d1143:     .word 1773165259
+d1144:     .word 132633726
+d1145:     .word 639585840
+d1146:     .word 1146537954
+d1147:     .word 1653490068
+d1148:     .word 12958535
+d1149:     .word 519910649
+d1150:     .word 1026862763
+d1151:     .word 1533814877
+d1152:     .word 2040766991
+d1153:     .word 400235458
+d1154:     .word 907187572
+d1155:     .word 1414139686
+d1156:     .word 1921091800
+d1157:     .word 280560267
+d1158:     .word 787512381
+d1159:     .word 1294464495
+d1160:     .word 1801416609
+d1161:     .word 160885076
+d1162:     .word 667837190
+d1163:     .word 1174789304
+d1164:     .word 1681741418
+d1165:     .word 41209885
+d1166:     .word 548161999
+d1167:     .word 1055114113
+d1168:     .word 1562066227
+d1169:     .word 2069018341
+d1170:     .word 428486808
+d1171:     .word 935438922
+d1172:     .word 1442391036
+d1173:     .word 1949343150
+d1174:     .word 308811617
+d1175:     .word 815763731
+d1176:     .word 1322715845
+d1177:     .word 1829667959
+d1178:     .word 189136426
+d1179:     .word 696088540
+d1180:     .word 1203040654
+d1181:     .word 1709992768
+d1182:     .word 69461235
+d1183:     .word 576413349
+d1184:     .word 1083365463
+d1185:     .word 1590317577
+d1186:     .word 2097269691
+d1187:     .word 456738158
+d1188:     .word 963690272
+d1189:     .word 1470642386
+d1190:     .word 1977594500
+d1191:     .word 337062967
+d1192:     .word 844015081
+d1193:     .word 1350967195
+d1194:     .word 1857919309
+d1195:     .word 217387776
+d1196:     .word 724339890
+d1197:     .word 1231292004
+d1198:     .word 1738244118
+d1199:     .word 97712585
+d1200:     .word 604664699
+d1201:     .word 1111616813
+d1202:     .word 1618568927
+d1203:     .word 2125521041
+d1204:     .word 484989508
+d1205:     .word 991941622
+d1206:     .word 1498893736
+d1207:     .word 2005845850
+d1208:     .word 365314317
+d1209:     .word 872266431
+d1210:     .word 1379218545
+d1211:     .word 1886170659
+d1212:     .word 245639126
+d1213:     .word 752591240
+d1214:     .word 1259543354
+d1215:     .word 1766495468
+d1216:     .word 125963935
+d1217:     .word 632916049
+d1218:     .word 1139868163
+d1219:     .word 1646820277
+d1220:     .word 6288744
+d1221:     .word 513240858
+d1222:     .word 1020192972
+d1223:     .word 1527145086
+d1224:     .word 2034097200
+d1225:     .word 393565667
+d1226:     .word 900517781
+d1227:     .word 1407469895
+d1228:     .word 1914422009
+d1229:     .word 273890476
+d1230:     .word 780842590
+d1231:     .word 1287794704
+d1232:     .word 1794746818
+d1233:     .word 154215285
+d1234:     .word 661167399
+d1235:     .word 1168119513
+d1236:     .word 1675071627
+d1237:     .word 34540094
+d1238:     .word 541492208
+d1239:     .word 1048444322
+d1240:     .word 1555396436
+d1241:     .word 2062348550
+d1242:     .word 421817017
+d1243:     .word 928769131
+d1244:     .word 1435721245
+d1245:     .word 1942673359
+d1246:     .word 302141826
+d1247:     .word 809093940
+d1248:     .word 1316046054
+d1249:     .word 1822998168
+d1250:     .word 182466635
+d1251:     .word 689418749
+d1252:     .word 1196370863
+d1253:     .word 1703322977
+d1254:     .word 62791444
+d1255:     .word 569743558
+d1256:     .word 1076695672
+d1257:     .word 1583647786
+d1258:     .word 2090599900
+d1259:     .word 450068367
+d1260:     .word 957020481
+d1261:     .word 1463972595
+d1262:     .word 1970924709
+d1263:     .word 330393176
+d1264:     .word 837345290
+d1265:     .word 1344297404
+d1266:     .word 1851249518
+d1267:     .word 210717985
+d1268:     .word 717670099
+d1269:     .word 1224622213
+d1270:     .word 1731574327
+d1271:     .word 91042794
+d1272:     .word 597994908
+d1273:     .word 1104947022
+d1274:     .word 1611899136
+d1275:     .word 2118851250
+d1276:     .word 478319717
+d1277:     .word 985271831
+d1278:     .word 1492223945
+d1279:     .word 1999176059
+d1280:     .word 358644526
+d1281:     .word 865596640
+d1282:     .word 1372548754
+d1283:     .word 1879500868
+d1284:     .word 238969335
+d1285:     .word 745921449
+d1286:     .word 1252873563
+d1287:     .word 1759825677
+d1288:     .word 119294144
+d1289:     .word 626246258
+d1290:     .word 1133198372
+d1291:     .word 1640150486
+d1292:     .word 2147102600
+d1293:     .word 506571067
+d1294:     .word 1013523181
+d1295:     .word 1520475295
+d1296:     .word 2027427409
+d1297:     .word 386895876
+d1298:     .word 893847990
+d1299:     .word 1400800104
+d1300:     .word 1907752218
+d1301:     .word 267220685
+d1302:     .word 774172799
+d1303:     .word 1281124913
+d1304:     .word 1788077027
+d1305:     .word 147545494
+d1306:     .word 654497608
+d1307:     .word 1161449722
+d1308:     .word 1668401836
+d1309:     .word 27870303
+d1310:     .word 534822417
+d1311:     .word 1041774531
+d1312:     .word 1548726645
+d1313:     .word 2055678759
+d1314:     .word 415147226
+d1315:     .word 922099340
+d1316:     .word 1429051454
+d1317:     .word 1936003568
+d1318:     .word 295472035
+d1319:     .word 802424149
+d1320:     .word 1309376263
+d1321:     .word 1816328377
+d1322:     .word 175796844
+d1323:     .word 682748958
+d1324:     .word 1189701072
+d1325:     .word 1696653186
+d1326:     .word 56121653
+d1327:     .word 563073767
+d1328:     .word 1070025881
+d1329:     .word 1576977995
+d1330:     .word 2083930109
+d1331:     .word 443398576
+d1332:     .word 950350690
+d1333:     .word 1457302804
+d1334:     .word 1964254918
+d1335:     .word 323723385
+d1336:     .word 830675499
+d1337:     .word 1337627613
+d1338:     .word 1844579727
+d1339:     .word 204048194
+d1340:     .word 711000308
+d1341:     .word 1217952422
+d1342:     .word 1724904536
+d1343:     .word 84373003
+d1344:     .word 591325117
+d1345:     .word 1098277231
+d1346:     .word 1605229345
+d1347:     .word 2112181459
+d1348:     .word 471649926
+d1349:     .word 978602040
+d1350:     .word 1485554154
+d1351:     .word 1992506268
+d1352:     .word 351974735
+d1353:     .word 858926849
+d1354:     .word 1365878963
+d1355:     .word 1872831077
+d1356:     .word 232299544
+d1357:     .word 739251658
+d1358:     .word 1246203772
+d1359:     .word 1753155886
+d1360:     .word 112624353
+d1361:     .word 619576467
+d1362:     .word 1126528581
+d1363:     .word 1633480695
+d1364:     .word 2140432809
+d1365:     .word 499901276
+d1366:     .word 1006853390
+d1367:     .word 1513805504
+d1368:     .word 2020757618
+d1369:     .word 380226085
+d1370:     .word 887178199
+d1371:     .word 1394130313
+d1372:     .word 1901082427
+d1373:     .word 260550894
+d1374:     .word 767503008
+d1375:     .word 1274455122
+d1376:     .word 1781407236
+d1377:     .word 140875703
+d1378:     .word 647827817
+d1379:     .word 1154779931
+d1380:     .word 1661732045
+d1381:     .word 21200512
+d1382:     .word 528152626
+d1383:     .word 1035104740
+d1384:     .word 1542056854
+d1385:     .word 2049008968
+d1386:     .word 408477435
+d1387:     .word 915429549
+d1388:     .word 1422381663
+d1389:     .word 1929333777
+d1390:     .word 288802244
+d1391:     .word 795754358
+d1392:     .word 1302706472
+d1393:     .word 1809658586
+d1394:     .word 169127053
+d1395:     .word 676079167
+d1396:     .word 1183031281
+d1397:     .word 1689983395
+d1398:     .word 49451862
+d1399:     .word 556403976
+d1400:     .word 1063356090
+d1401:     .word 1570308204
+d1402:     .word 2077260318
+d1403:     .word 436728785
+d1404:     .word 943680899
+d1405:     .word 1450633013
+d1406:     .word 1957585127
+d1407:     .word 317053594
+d1408:     .word 824005708
+d1409:     .word 1330957822
+d1410:     .word 1837909936
+d1411:     .word 197378403
+d1412:     .word 704330517
+d1413:     .word 1211282631
+d1414:     .word 1718234745
+d1415:     .word 77703212
+d1416:     .word 584655326
+d1417:     .word 1091607440
+d1418:     .word 1598559554
+d1419:     .word 2105511668
+d1420:     .word 464980135
+d1421:     .word 971932249
+d1422:     .word 1478884363
+d1423:     .word 1985836477
+d1424:     .word 345304944
+d1425:     .word 852257058
+d1426:     .word 1359209172
+d1427:     .word 1866161286
+d1428:     .word 225629753
+d1429:     .word 732581867
+d1430:     .word 1239533981
+d1431:     .word 1746486095
+d1432:     .word 105954562
+d1433:     .word 612906676
+d1434:     .word 1119858790
+d1435:     .word 1626810904
+d1436:     .word 2133763018
+d1437:     .word 493231485
+d1438:     .word 1000183599
+d1439:     .word 1507135713
+d1440:     .word 2014087827
+d1441:     .word 373556294
+d1442:     .word 880508408
+d1443:     .word 1387460522
+d1444:     .word 1894412636
+d1445:     .word 253881103
+d1446:     .word 760833217
+d1447:     .word 1267785331
+d1448:     .word 1774737445
+d1449:     .word 134205912
+d1450:     .word 641158026
+d1451:     .word 1148110140
+d1452:     .word 1655062254
+d1453:     .word 14530721
+d1454:     .word 521482835
+d1455:     .word 1028434949
+d1456:     .word 1535387063
+d1457:     .word 2042339177
+d1458:     .word 401807644
+d1459:     .word 908759758
+d1460:     .word 1415711872
+d1461:     .word 1922663986
+d1462:     .word 282132453
+d1463:     .word 789084567
+d1464:     .word 1296036681
+d1465:     .word 1802988795
+d1466:     .word 162457262
+d1467:     .word 669409376
+d1468:     .word 1176361490
+d1469:     .word 1683313604
+d1470:     .word 42782071
+d1471:     .word 549734185
+d1472:     .word 1056686299
+d1473:     .word 1563638413
+d1474:     .word 2070590527
+d1475:     .word 430058994
+d1476:     .word 937011108
+d1477:     .word 1443963222
+d1478:     .word 1950915336
+d1479:     .word 310383803
+d1480:     .word 817335917
+d1481:     .word 1324288031
+d1482:     .word 1831240145
+d1483:     .word 190708612
+d1484:     .word 697660726
+d1485:     .word 1204612840
+d1486:     .word 1711564954
+d1487:     .word 71033421
+d1488:     .word 577985535
+d1489:     .word 1084937649
+d1490:     .word 1591889763
+d1491:     .word 2098841877
+d1492:     .word 458310344
+d1493:     .word 965262458
+d1494:     .word 1472214572
+d1495:     .word 1979166686
+d1496:     .word 338635153
+d1497:     .word 845587267
+d1498:     .word 1352539381
+d1499:     .word 1859491495
+d1500:     .word 218959962
+d1501:     .word 725912076
+d1502:     .word 1232864190
+d1503:     .word 1739816304
+d1504:     .word 99284771
+d1505:     .word 606236885
+d1506:     .word 1113188999
+d1507:     .word 1620141113
+d1508:     .word 2127093227
+d1509:     .word 486561694
+d1510:     .word 993513808
+d1511:     .word 1500465922
+d1512:     .word 2007418036
+d1513:     .word 366886503
+d1514:     .word 873838617
+d1515:     .word 1380790731
+d1516:     .word 1887742845
+d1517:     .word 247211312
+d1518:     .word 754163426
+d1519:     .word 1261115540
+d1520:     .word 1768067654
+d1521:     .word 127536121
+d1522:     .word 634488235
+d1523:     .word 1141440349
+d1524:     .word 1648392463
+d1525:     .word 7860930
+d1526:     .word 514813044
+d1527:     .word 1021765158
+d1528:     .word 1528717272
+d1529:     .word 2035669386
+d1530:     .word 395137853
+d1531:     .word 902089967
+d1532:     .word 1409042081
+d1533:     .word 1915994195
+d1534:     .word 275462662
+d1535:     .word 782414776
+d1536:     .word 1289366890
+d1537:     .word 1796319004
+d1538:     .word 155787471
+d1539:     .word 662739585
+d1540:     .word 1169691699
+d1541:     .word 1676643813
+d1542:     .word 36112280
+d1543:     .word 543064394
+d1544:     .word 1050016508
+d1545:     .word 1556968622
+d1546:     .word 2063920736
+d1547:     .word 423389203
+d1548:     .word 930341317
+d1549:     .word 1437293431
+d1550:     .word 1944245545
+d1551:     .word 303714012
+d1552:     .word 810666126
+d1553:     .word 1317618240
+d1554:     .word 1824570354
+d1555:     .word 184038821
+d1556:     .word 690990935
+d1557:     .word 1197943049
+d1558:     .word 1704895163
+d1559:     .word 64363630
+d1560:     .word 571315744
+d1561:     .word 1078267858
+d1562:     .word 1585219972
+d1563:     .word 2092172086
+d1564:     .word 451640553
+d1565:     .word 958592667
+d1566:     .word 1465544781
+d1567:     .word 1972496895
+d1568:     .word 331965362
+d1569:     .word 838917476
+d1570:     .word 1345869590
+d1571:     .word 1852821704
+d1572:     .word 212290171
+d1573:     .word 719242285
+d1574:     .word 1226194399
+d1575:     .word 1733146513
+d1576:     .word 92614980
+d1577:     .word 599567094
+d1578:     .word 1106519208
+d1579:     .word 1613471322
+d1580:     .word 2120423436
+d1581:     .word 479891903
+d1582:     .word 986844017
+d1583:     .word 1493796131
+d1584:     .word 2000748245
+d1585:     .word 360216712
+d1586:     .word 867168826
+d1587:     .word 1374120940
+d1588:     .word 1881073054
+d1589:     .word 240541521
+d1590:     .word 747493635
+d1591:     .word 1254445749
+d1592:     .word 1761397863
+d1593:     .word 120866330
+d1594:     .word 627818444
+d1595:     .word 1134770558
+d1596:     .word 1641722672
+d1597:     .word 1191139
+d1598:     .word 508143253
+d1599:     .word 1015095367
+d1600:     .word 1522047481
+d1601:     .word 2028999595
+d1602:     .word 388468062
+d1603:     .word 895420176
+d1604:     .word 1402372290
+d1605:     .word 1909324404
+d1606:     .word 268792871
+d1607:     .word 775744985
+d1608:     .word 1282697099
+d1609:     .word 1789649213
+d1610:     .word 149117680
+d1611:     .word 656069794
+d1612:     .word 1163021908
+d1613:     .word 1669974022
+d1614:     .word 29442489
+d1615:     .word 536394603
+d1616:     .word 1043346717
+d1617:     .word 1550298831
+d1618:     .word 2057250945
+d1619:     .word 416719412
+d1620:     .word 923671526
+d1621:     .word 1430623640
+d1622:     .word 1937575754
+d1623:     .word 297044221
+d1624:     .word 803996335
+d1625:     .word 1310948449
+d1626:     .word 1817900563
+d1627:     .word 177369030
+d1628:     .word 684321144
+d1629:     .word 1191273258
+d1630:     .word 1698225372
+d1631:     .word 57693839
+d1632:     .word 564645953
+d1633:     .word 1071598067
+d1634:     .word 1578550181
+d1635:     .word 2085502295
+d1636:     .word 444970762
+d1637:     .word 951922876
+d1638:     .word 1458874990
+d1639:     .word 1965827104
+d1640:     .word 325295571
+d1641:     .word 832247685
+d1642:     .word 1339199799
+d1643:     .word 1846151913
+d1644:     .word 205620380
+d1645:     .word 712572494
+d1646:     .word 1219524608
+d1647:     .word 1726476722
+d1648:     .word 85945189
+d1649:     .word 592897303
+d1650:     .word 1099849417
+d1651:     .word 1606801531
+d1652:     .word 2113753645
+d1653:     .word 473222112
+d1654:     .word 980174226
+d1655:     .word 1487126340
+d1656:     .word 1994078454
+d1657:     .word 353546921
+d1658:     .word 860499035
+d1659:     .word 1367451149
+d1660:     .word 1874403263
+d1661:     .word 233871730
+d1662:     .word 740823844
+d1663:     .word 1247775958
+d1664:     .word 1754728072
+d1665:     .word 114196539
+d1666:     .word 621148653
+d1667:     .word 1128100767
+d1668:     .word 1635052881
+d1669:     .word 2142004995
+d1670:     .word 501473462
+d1671:     .word 1008425576
+d1672:     .word 1515377690
+d1673:     .word 2022329804
+d1674:     .word 381798271
+d1675:     .word 888750385
+d1676:     .word 1395702499
+d1677:     .word 1902654613
+d1678:     .word 262123080
+d1679:     .word 769075194
+d1680:     .word 1276027308
+d1681:     .word 1782979422
+d1682:     .word 142447889
+d1683:     .word 649400003
+d1684:     .word 1156352117
+d1685:     .word 1663304231
+d1686:     .word 22772698
+d1687:     .word 529724812
+d1688:     .word 1036676926
+d1689:     .word 1543629040
+d1690:     .word 2050581154
+d1691:     .word 410049621
+d1692:     .word 917001735
+d1693:     .word 1423953849
+d1694:     .word 1930905963
+d1695:     .word 290374430
+d1696:     .word 797326544
+d1697:     .word 1304278658
+d1698:     .word 1811230772
+d1699:     .word 170699239
+d1700:     .word 677651353
+d1701:     .word 1184603467
+d1702:     .word 1691555581
+d1703:     .word 51024048
+d1704:     .word 557976162
+d1705:     .word 1064928276
+d1706:     .word 1571880390
+d1707:     .word 2078832504
+d1708:     .word 438300971
+d1709:     .word 945253085
+d1710:     .word 1452205199
+d1711:     .word 1959157313
+d1712:     .word 318625780
+d1713:     .word 825577894
+d1714:     .word 1332530008
+d1715:     .word 1839482122
+d1716:     .word 198950589
+d1717:     .word 705902703
+d1718:     .word 1212854817
+d1719:     .word 1719806931
+d1720:     .word 79275398
+d1721:     .word 586227512
+d1722:     .word 1093179626
+d1723:     .word 1600131740
+d1724:     .word 2107083854
+d1725:     .word 466552321
+d1726:     .word 973504435
+d1727:     .word 1480456549
+d1728:     .word 1987408663
+d1729:     .word 346877130
+d1730:     .word 853829244
+d1731:     .word 1360781358
+d1732:     .word 1867733472
+d1733:     .word 227201939
+d1734:     .word 734154053
+d1735:     .word 1241106167
+d1736:     .word 1748058281
+d1737:     .word 107526748
+d1738:     .word 614478862
+d1739:     .word 1121430976
+d1740:     .word 1628383090
+d1741:     .word 2135335204
+d1742:     .word 494803671
+d1743:     .word 1001755785
+d1744:     .word 1508707899
+d1745:     .word 2015660013
+d1746:     .word 375128480
+d1747:     .word 882080594
+d1748:     .word 1389032708
+d1749:     .word 1895984822
+d1750:     .word 255453289
+d1751:     .word 762405403
+d1752:     .word 1269357517
+d1753:     .word 1776309631
+d1754:     .word 135778098
+d1755:     .word 642730212
+d1756:     .word 1149682326
+d1757:     .word 1656634440
+d1758:     .word 16102907
+d1759:     .word 523055021
+d1760:     .word 1030007135
+d1761:     .word 1536959249
+d1762:     .word 2043911363
+d1763:     .word 403379830
+d1764:     .word 910331944
+d1765:     .word 1417284058
+d1766:     .word 1924236172
+d1767:     .word 283704639
+d1768:     .word 790656753
+d1769:     .word 1297608867
+d1770:     .word 1804560981
+d1771:     .word 164029448
+d1772:     .word 670981562
+d1773:     .word 1177933676
+d1774:     .word 1684885790
+d1775:     .word 44354257
+d1776:     .word 551306371
+d1777:     .word 1058258485
+d1778:     .word 1565210599
+d1779:     .word 2072162713
+d1780:     .word 431631180
+d1781:     .word 938583294
+d1782:     .word 1445535408
+d1783:     .word 1952487522
+d1784:     .word 311955989
+d1785:     .word 818908103
+d1786:     .word 1325860217
+d1787:     .word 1832812331
+d1788:     .word 192280798
+d1789:     .word 699232912
+d1790:     .word 1206185026
+d1791:     .word 1713137140
+d1792:     .word 72605607
+d1793:     .word 579557721
+d1794:     .word 1086509835
+d1795:     .word 1593461949
+d1796:     .word 2100414063
+d1797:     .word 459882530
+d1798:     .word 966834644
+d1799:     .word 1473786758
+d1800:     .word 1980738872
+d1801:     .word 340207339
+d1802:     .word 847159453
+d1803:     .word 1354111567
+d1804:     .word 1861063681
+d1805:     .word 220532148
+d1806:     .word 727484262
+d1807:     .word 1234436376
+d1808:     .word 1741388490
+d1809:     .word 100856957
+d1810:     .word 607809071
+d1811:     .word 1114761185
+d1812:     .word 1621713299
+d1813:     .word 2128665413
+d1814:     .word 488133880
+d1815:     .word 995085994
+d1816:     .word 1502038108
+d1817:     .word 2008990222
+d1818:     .word 368458689
+d1819:     .word 875410803
+d1820:     .word 1382362917
+d1821:     .word 1889315031
+d1822:     .word 248783498
+d1823:     .word 755735612
+d1824:     .word 1262687726
+d1825:     .word 1769639840
+d1826:     .word 129108307
+d1827:     .word 636060421
+d1828:     .word 1143012535
+d1829:     .word 1649964649
+d1830:     .word 9433116
+d1831:     .word 516385230
+d1832:     .word 1023337344
+d1833:     .word 1530289458
+d1834:     .word 2037241572
+d1835:     .word 396710039
+d1836:     .word 903662153
+d1837:     .word 1410614267
+d1838:     .word 1917566381
+d1839:     .word 277034848
+d1840:     .word 783986962
+d1841:     .word 1290939076
+d1842:     .word 1797891190
+d1843:     .word 157359657
+d1844:     .word 664311771
+d1845:     .word 1171263885
+d1846:     .word 1678215999
+d1847:     .word 37684466
+d1848:     .word 544636580
+d1849:     .word 1051588694
+d1850:     .word 1558540808
+d1851:     .word 2065492922
+d1852:     .word 424961389
+d1853:     .word 931913503
+d1854:     .word 1438865617
+d1855:     .word 1945817731
+d1856:     .word 305286198
+d1857:     .word 812238312
+d1858:     .word 1319190426
+d1859:     .word 1826142540
+d1860:     .word 185611007
+d1861:     .word 692563121
+d1862:     .word 1199515235
+d1863:     .word 1706467349
+d1864:     .word 65935816
+d1865:     .word 572887930
+d1866:     .word 1079840044
+d1867:     .word 1586792158
+d1868:     .word 2093744272
+d1869:     .word 453212739
+d1870:     .word 960164853
+d1871:     .word 1467116967
+d1872:     .word 1974069081
+d1873:     .word 333537548
+d1874:     .word 840489662
+d1875:     .word 1347441776
+d1876:     .word 1854393890
+d1877:     .word 213862357
+d1878:     .word 720814471
+d1879:     .word 1227766585
+d1880:     .word 1734718699
+d1881:     .word 94187166
+d1882:     .word 601139280
+d1883:     .word 1108091394
+d1884:     .word 1615043508
+d1885:     .word 2121995622
+d1886:     .word 481464089
+d1887:     .word 988416203
+d1888:     .word 1495368317
+d1889:     .word 2002320431
+d1890:     .word 361788898
+d1891:     .word 868741012
+d1892:     .word 1375693126
+d1893:     .word 1882645240
+d1894:     .word 242113707
+d1895:     .word 749065821
+d1896:     .word 1256017935
+d1897:     .word 1762970049
+d1898:     .word 122438516
+d1899:     .word 629390630
+d1900:     .word 1136342744
+d1901:     .word 1643294858
+d1902:     .word 2763325
+d1903:     .word 509715439
+d1904:     .word 1016667553
+d1905:     .word 1523619667
+d1906:     .word 2030571781
+d1907:     .word 390040248
+d1908:     .word 896992362
+d1909:     .word 1403944476
+d1910:     .word 1910896590
+d1911:     .word 270365057
+d1912:     .word 777317171
+d1913:     .word 1284269285
+d1914:     .word 1791221399
+d1915:     .word 150689866
+d1916:     .word 657641980
+d1917:     .word 1164594094
+d1918:     .word 1671546208
+d1919:     .word 31014675
+d1920:     .word 537966789
+d1921:     .word 1044918903
+d1922:     .word 1551871017
+d1923:     .word 2058823131
+d1924:     .word 418291598
+d1925:     .word 925243712
+d1926:     .word 1432195826
+d1927:     .word 1939147940
+d1928:     .word 298616407
+d1929:     .word 805568521
+d1930:     .word 1312520635
+d1931:     .word 1819472749
+d1932:     .word 178941216
+d1933:     .word 685893330
+d1934:     .word 1192845444
+d1935:     .word 1699797558
+d1936:     .word 59266025
+d1937:     .word 566218139
+d1938:     .word 1073170253
+d1939:     .word 1580122367
+d1940:     .word 2087074481
+d1941:     .word 446542948
+d1942:     .word 953495062
+d1943:     .word 1460447176
+d1944:     .word 1967399290
+d1945:     .word 326867757
+d1946:     .word 833819871
+d1947:     .word 1340771985
+d1948:     .word 1847724099
+d1949:     .word 207192566
+d1950:     .word 714144680
+d1951:     .word 1221096794
+d1952:     .word 1728048908
+d1953:     .word 87517375
+d1954:     .word 594469489
+d1955:     .word 1101421603
+d1956:     .word 1608373717
+d1957:     .word 2115325831
+d1958:     .word 474794298
+d1959:     .word 981746412
+d1960:     .word 1488698526
+d1961:     .word 1995650640
+d1962:     .word 355119107
+d1963:     .word 862071221
+d1964:     .word 1369023335
+d1965:     .word 1875975449
+d1966:     .word 235443916
+d1967:     .word 742396030
+d1968:     .word 1249348144
+d1969:     .word 1756300258
+d1970:     .word 115768725
+d1971:     .word 622720839
+d1972:     .word 1129672953
+d1973:     .word 1636625067
+d1974:     .word 2143577181
+d1975:     .word 503045648
+d1976:     .word 1009997762
+d1977:     .word 1516949876
+d1978:     .word 2023901990
+d1979:     .word 383370457
+d1980:     .word 890322571
+d1981:     .word 1397274685
+d1982:     .word 1904226799
+d1983:     .word 263695266
+d1984:     .word 770647380
+d1985:     .word 1277599494
+d1986:     .word 1784551608
+d1987:     .word 144020075
+d1988:     .word 650972189
+d1989:     .word 1157924303
+d1990:     .word 1664876417
+d1991:     .word 24344884
+d1992:     .word 531296998
+d1993:     .word 1038249112
+d1994:     .word 1545201226
+d1995:     .word 2052153340
+d1996:     .word 411621807
+d1997:     .word 918573921
+d1998:     .word 1425526035
+d1999:     .word 1932478149
+d2000:     .word 291946616
+d2001:     .word 798898730
+d2002:     .word 1305850844
+d2003:     .word 1812802958
+d2004:     .word 172271425
+d2005:     .word 679223539
+d2006:     .word 1186175653
+d2007:     .word 1693127767
+d2008:     .word 52596234
+d2009:     .word 559548348
+d2010:     .word 1066500462
+d2011:     .word 1573452576
+d2012:     .word 2080404690
+d2013:     .word 439873157
+d2014:     .word 946825271
+d2015:     .word 1453777385
+d2016:     .word 1960729499
+d2017:     .word 320197966
+d2018:     .word 827150080
+d2019:     .word 1334102194
+d2020:     .word 1841054308
+d2021:     .word 200522775
+d2022:     .word 707474889
+d2023:     .word 1214427003
+d2024:     .word 1721379117
+d2025:     .word 80847584
+d2026:     .word 587799698
+d2027:     .word 1094751812
+d2028:     .word 1601703926
+d2029:     .word 2108656040
+d2030:     .word 468124507
+d2031:     .word 975076621
+d2032:     .word 1482028735
+d2033:     .word 1988980849
+d2034:     .word 348449316
+d2035:     .word 855401430
+d2036:     .word 1362353544
+d2037:     .word 1869305658
+d2038:     .word 228774125
+d2039:     .word 735726239
+d2040:     .word 1242678353
+d2041:     .word 1749630467
+d2042:     .word 109098934
+d2043:     .word 616051048
+d2044:     .word 1123003162
+d2045:     .word 1629955276
+d2046:     .word 2136907390
+d2047:     .word 496375857
+d2048:     .word 1003327971
+d2049:     .word 1510280085
+d2050:     .word 2017232199
+d2051:     .word 376700666
+d2052:     .word 883652780
+d2053:     .word 1390604894
+d2054:     .word 1897557008
+d2055:     .word 257025475
+d2056:     .word 763977589
+d2057:     .word 1270929703
+d2058:     .word 1777881817
+d2059:     .word 137350284
+d2060:     .word 644302398
+d2061:     .word 1151254512
+d2062:     .word 1658206626
+d2063:     .word 17675093
+d2064:     .word 524627207
+d2065:     .word 1031579321
+d2066:     .word 1538531435
+d2067:     .word 2045483549
+d2068:     .word 404952016
+d2069:     .word 911904130
+d2070:     .word 1418856244
+d2071:     .word 1925808358
+d2072:     .word 285276825
+d2073:     .word 792228939
+d2074:     .word 1299181053
+d2075:     .word 1806133167
+d2076:     .word 165601634
+d2077:     .word 672553748
+d2078:     .word 1179505862
+d2079:     .word 1686457976
+d2080:     .word 45926443
+d2081:     .word 552878557
+d2082:     .word 1059830671
+d2083:     .word 1566782785
+d2084:     .word 2073734899
+d2085:     .word 433203366
+d2086:     .word 940155480
+d2087:     .word 1447107594
+d2088:     .word 1954059708
+d2089:     .word 313528175
+d2090:     .word 820480289
+d2091:     .word 1327432403
+d2092:     .word 1834384517
+d2093:     .word 193852984
+d2094:     .word 700805098
+d2095:     .word 1207757212
+d2096:     .word 1714709326
+d2097:     .word 74177793
+d2098:     .word 581129907
+d2099:     .word 1088082021
+d2100:     .word 1595034135
+d2101:     .word 2101986249
+d2102:     .word 461454716
+d2103:     .word 968406830
+d2104:     .word 1475358944
+d2105:     .word 1982311058
+d2106:     .word 341779525
+d2107:     .word 848731639
+d2108:     .word 1355683753
+d2109:     .word 1862635867
+d2110:     .word 222104334
+d2111:     .word 729056448
+d2112:     .word 1236008562
+d2113:     .word 1742960676
+d2114:     .word 102429143
+d2115:     .word 609381257
+d2116:     .word 1116333371
+d2117:     .word 1623285485
+d2118:     .word 2130237599
+d2119:     .word 489706066
+d2120:     .word 996658180
+d2121:     .word 1503610294
+d2122:     .word 2010562408
+d2123:     .word 370030875
+d2124:     .word 876982989
+d2125:     .word 1383935103
+d2126:     .word 1890887217
+d2127:     .word 250355684
+d2128:     .word 757307798
+d2129:     .word 1264259912
+d2130:     .word 1771212026
+d2131:     .word 130680493
+d2132:     .word 637632607
+d2133:     .word 1144584721
+d2134:     .word 1651536835
+d2135:     .word 11005302
+d2136:     .word 517957416
+d2137:     .word 1024909530
+d2138:     .word 1531861644
+d2139:     .word 2038813758
+d2140:     .word 398282225
+d2141:     .word 905234339
+d2142:     .word 1412186453
+d2143:     .word 1919138567
+d2144:     .word 278607034
+d2145:     .word 785559148
+d2146:     .word 1292511262
+d2147:     .word 1799463376
+d2148:     .word 158931843
+d2149:     .word 665883957
+d2150:     .word 1172836071
+d2151:     .word 1679788185
+d2152:     .word 39256652
+d2153:     .word 546208766
+d2154:     .word 1053160880
+d2155:     .word 1560112994
+d2156:     .word 2067065108
+d2157:     .word 426533575
+d2158:     .word 933485689
+d2159:     .word 1440437803
+d2160:     .word 1947389917
+d2161:     .word 306858384
+d2162:     .word 813810498
+d2163:     .word 1320762612
+d2164:     .word 1827714726
+d2165:     .word 187183193
+d2166:     .word 694135307
+d2167:     .word 1201087421
+d2168:     .word 1708039535
+d2169:     .word 67508002
+d2170:     .word 574460116
+d2171:     .word 1081412230
+d2172:     .word 1588364344
+d2173:     .word 2095316458
+d2174:     .word 454784925
+d2175:     .word 961737039
+d2176:     .word 1468689153
+d2177:     .word 1975641267
+d2178:     .word 335109734
+d2179:     .word 842061848
+d2180:     .word 1349013962
+d2181:     .word 1855966076
+d2182:     .word 215434543
+d2183:     .word 722386657
+d2184:     .word 1229338771
+d2185:     .word 1736290885
+d2186:     .word 95759352
+d2187:     .word 602711466
+d2188:     .word 1109663580
+d2189:     .word 1616615694
+d2190:     .word 2123567808
+d2191:     .word 483036275
+d2192:     .word 989988389
+d2193:     .word 1496940503
+d2194:     .word 2003892617
+d2195:     .word 363361084
+d2196:     .word 870313198
+d2197:     .word 1377265312
+d2198:     .word 1884217426
+d2199:     .word 243685893
+d2200:     .word 750638007
+d2201:     .word 1257590121
+d2202:     .word 1764542235
+d2203:     .word 124010702
+d2204:     .word 630962816
+d2205:     .word 1137914930
+d2206:     .word 1644867044
+d2207:     .word 4335511
+d2208:     .word 511287625
+d2209:     .word 1018239739
+d2210:     .word 1525191853
+d2211:     .word 2032143967
+d2212:     .word 391612434
+d2213:     .word 898564548
+d2214:     .word 1405516662
+d2215:     .word 1912468776
+d2216:     .word 271937243
+d2217:     .word 778889357
+d2218:     .word 1285841471
+d2219:     .word 1792793585
+d2220:     .word 152262052
+d2221:     .word 659214166
+d2222:     .word 1166166280
+d2223:     .word 1673118394
+d2224:     .word 32586861
+d2225:     .word 539538975
+d2226:     .word 1046491089
+d2227:     .word 1553443203
+d2228:     .word 2060395317
+d2229:     .word 419863784
+d2230:     .word 926815898
+d2231:     .word 1433768012
+d2232:     .word 1940720126
+d2233:     .word 300188593
+d2234:     .word 807140707
+d2235:     .word 1314092821
+d2236:     .word 1821044935
+d2237:     .word 180513402
+d2238:     .word 687465516
+d2239:     .word 1194417630
+d2240:     .word 1701369744
+d2241:     .word 60838211
+d2242:     .word 567790325
+d2243:     .word 1074742439
+d2244:     .word 1581694553
+d2245:     .word 2088646667
+d2246:     .word 448115134
+d2247:     .word 955067248
+d2248:     .word 1462019362
+d2249:     .word 1968971476
+d2250:     .word 328439943
+d2251:     .word 835392057
+d2252:     .word 1342344171
+d2253:     .word 1849296285
+d2254:     .word 208764752
+d2255:     .word 715716866
+d2256:     .word 1222668980
+d2257:     .word 1729621094
+d2258:     .word 89089561
+d2259:     .word 596041675
+d2260:     .word 1102993789
+d2261:     .word 1609945903
+d2262:     .word 2116898017
+d2263:     .word 476366484
+d2264:     .word 983318598
+d2265:     .word 1490270712
+d2266:     .word 1997222826
+d2267:     .word 356691293
+d2268:     .word 863643407
+d2269:     .word 1370595521
+d2270:     .word 1877547635
+d2271:     .word 237016102
+d2272:     .word 743968216
+d2273:     .word 1250920330
+d2274:     .word 1757872444
+d2275:     .word 117340911
+d2276:     .word 624293025
+d2277:     .word 1131245139
+d2278:     .word 1638197253
+d2279:     .word 2145149367
+d2280:     .word 504617834
+d2281:     .word 1011569948
+d2282:     .word 1518522062
+d2283:     .word 2025474176
+d2284:     .word 384942643
+d2285:     .word 891894757
+d2286:     .word 1398846871
+d2287:     .word 1905798985
+d2288:     .word 265267452
+d2289:     .word 772219566
+d2290:     .word 1279171680
+d2291:     .word 1786123794
+d2292:     .word 145592261
+d2293:     .word 652544375
+d2294:     .word 1159496489
+d2295:     .word 1666448603
+d2296:     .word 25917070
+d2297:     .word 532869184
+d2298:     .word 1039821298
+d2299:     .word 1546773412
+d2300:     .word 2053725526
+d2301:     .word 413193993
+d2302:     .word 920146107
+d2303:     .word 1427098221
+d2304:     .word 1934050335
+d2305:     .word 293518802
+d2306:     .word 800470916
+d2307:     .word 1307423030
+d2308:     .word 1814375144
+d2309:     .word 173843611
+d2310:     .word 680795725
+d2311:     .word 1187747839
+d2312:     .word 1694699953
+d2313:     .word 54168420
+d2314:     .word 561120534
+d2315:     .word 1068072648
+d2316:     .word 1575024762
+d2317:     .word 2081976876
+d2318:     .word 441445343
+d2319:     .word 948397457
+d2320:     .word 1455349571
+d2321:     .word 1962301685
+d2322:     .word 321770152
+d2323:     .word 828722266
+d2324:     .word 1335674380
+d2325:     .word 1842626494
+d2326:     .word 202094961
+d2327:     .word 709047075
+d2328:     .word 1215999189
+d2329:     .word 1722951303
+d2330:     .word 82419770
+d2331:     .word 589371884
+d2332:     .word 1096323998
+d2333:     .word 1603276112
+d2334:     .word 2110228226
+d2335:     .word 469696693
+d2336:     .word 976648807
+d2337:     .word 1483600921
+d2338:     .word 1990553035
+d2339:     .word 350021502
+d2340:     .word 856973616
+d2341:     .word 1363925730
+d2342:     .word 1870877844
+d2343:     .word 230346311
+d2344:     .word 737298425
+d2345:     .word 1244250539
+d2346:     .word 1751202653
+d2347:     .word 110671120
+d2348:     .word 617623234
+d2349:     .word 1124575348
+d2350:     .word 1631527462
+d2351:     .word 2138479576
+d2352:     .word 497948043
+d2353:     .word 1004900157
+d2354:     .word 1511852271
+d2355:     .word 2018804385
+d2356:     .word 378272852
+d2357:     .word 885224966
+d2358:     .word 1392177080
+d2359:     .word 1899129194
+d2360:     .word 258597661
+d2361:     .word 765549775
+d2362:     .word 1272501889
+d2363:     .word 1779454003
+d2364:     .word 138922470
+d2365:     .word 645874584
+d2366:     .word 1152826698
+d2367:     .word 1659778812
+d2368:     .word 19247279
+d2369:     .word 526199393
+d2370:     .word 1033151507
+d2371:     .word 1540103621
+d2372:     .word 2047055735
+d2373:     .word 406524202
+d2374:     .word 913476316
+d2375:     .word 1420428430
+d2376:     .word 1927380544
+d2377:     .word 286849011
+d2378:     .word 793801125
+d2379:     .word 1300753239
+d2380:     .word 1807705353
+d2381:     .word 167173820
+d2382:     .word 674125934
+d2383:     .word 1181078048
+d2384:     .word 1688030162
+d2385:     .word 47498629
+d2386:     .word 554450743
+d2387:     .word 1061402857
+d2388:     .word 1568354971
+d2389:     .word 2075307085
+d2390:     .word 434775552
+d2391:     .word 941727666
+d2392:     .word 1448679780
+d2393:     .word 1955631894
+d2394:     .word 315100361
+d2395:     .word 822052475
+d2396:     .word 1329004589
+d2397:     .word 1835956703
+d2398:     .word 195425170
+d2399:     .word 702377284
+d2400:     .word 1209329398
+d2401:     .word 1716281512
+d2402:     .word 75749979
+d2403:     .word 582702093
+d2404:     .word 1089654207
+d2405:     .word 1596606321
+d2406:     .word 2103558435
+d2407:     .word 463026902
+d2408:     .word 969979016
+d2409:     .word 1476931130
+d2410:     .word 1983883244
+d2411:     .word 343351711
+d2412:     .word 850303825
+d2413:     .word 1357255939
+d2414:     .word 1864208053
+d2415:     .word 223676520
+d2416:     .word 730628634
+d2417:     .word 1237580748
+d2418:     .word 1744532862
+d2419:     .word 104001329
+d2420:     .word 610953443
+d2421:     .word 1117905557
+d2422:     .word 1624857671
+d2423:     .word 2131809785
+d2424:     .word 491278252
+d2425:     .word 998230366
+d2426:     .word 1505182480
+d2427:     .word 2012134594
+d2428:     .word 371603061
+d2429:     .word 878555175
+d2430:     .word 1385507289
+d2431:     .word 1892459403
+d2432:     .word 251927870
+d2433:     .word 758879984
+d2434:     .word 1265832098
+d2435:     .word 1772784212
+d2436:     .word 132252679
+d2437:     .word 639204793
+d2438:     .word 1146156907
+d2439:     .word 1653109021
+d2440:     .word 12577488
+d2441:     .word 519529602
+d2442:     .word 1026481716
+d2443:     .word 1533433830
+d2444:     .word 2040385944
+d2445:     .word 399854411
+d2446:     .word 906806525
+d2447:     .word 1413758639
+d2448:     .word 1920710753
+d2449:     .word 280179220
+d2450:     .word 787131334
+d2451:     .word 1294083448
+d2452:     .word 1801035562
+d2453:     .word 160504029
+d2454:     .word 667456143
+d2455:     .word 1174408257
+d2456:     .word 1681360371
+d2457:     .word 40828838
+d2458:     .word 547780952
+d2459:     .word 1054733066
+d2460:     .word 1561685180
+d2461:     .word 2068637294
+d2462:     .word 428105761
+d2463:     .word 935057875
+d2464:     .word 1442009989
+d2465:     .word 1948962103
+d2466:     .word 308430570
+d2467:     .word 815382684
+d2468:     .word 1322334798
+d2469:     .word 1829286912
+d2470:     .word 188755379
+d2471:     .word 695707493
+d2472:     .word 1202659607
+d2473:     .word 1709611721
+d2474:     .word 69080188
+d2475:     .word 576032302
+d2476:     .word 1082984416
+d2477:     .word 1589936530
+d2478:     .word 2096888644
+d2479:     .word 456357111
+d2480:     .word 963309225
+d2481:     .word 1470261339
+d2482:     .word 1977213453
+d2483:     .word 336681920
+d2484:     .word 843634034
+d2485:     .word 1350586148
+d2486:     .word 1857538262
+d2487:     .word 217006729
+d2488:     .word 723958843
+d2489:     .word 1230910957
+d2490:     .word 1737863071
+d2491:     .word 97331538
+d2492:     .word 604283652
+d2493:     .word 1111235766
+d2494:     .word 1618187880
+d2495:     .word 2125139994
+d2496:     .word 484608461
+d2497:     .word 991560575
+d2498:     .word 1498512689
+d2499:     .word 2005464803
+d2500:     .word 364933270
+d2501:     .word 871885384
+d2502:     .word 1378837498
+d2503:     .word 1885789612
+d2504:     .word 245258079
+d2505:     .word 752210193
+d2506:     .word 1259162307
+d2507:     .word 1766114421
+d2508:     .word 125582888
+d2509:     .word 632535002
+d2510:     .word 1139487116
+d2511:     .word 1646439230
+d2512:     .word 5907697
+d2513:     .word 512859811
+d2514:     .word 1019811925
+d2515:     .word 1526764039
+d2516:     .word 2033716153
+d2517:     .word 393184620
+d2518:     .word 900136734
+d2519:     .word 1407088848
+d2520:     .word 1914040962
+d2521:     .word 273509429
+d2522:     .word 780461543
+d2523:     .word 1287413657
+d2524:     .word 1794365771
+d2525:     .word 153834238
+d2526:     .word 660786352
+d2527:     .word 1167738466
+d2528:     .word 1674690580
+d2529:     .word 34159047
+d2530:     .word 541111161
+d2531:     .word 1048063275
+d2532:     .word 1555015389
+d2533:     .word 2061967503
+d2534:     .word 421435970
+d2535:     .word 928388084
+d2536:     .word 1435340198
+d2537:     .word 1942292312
+d2538:     .word 301760779
+d2539:     .word 808712893
+d2540:     .word 1315665007
+d2541:     .word 1822617121
+d2542:     .word 182085588
+d2543:     .word 689037702
+d2544:     .word 1195989816
+d2545:     .word 1702941930
+d2546:     .word 62410397
+d2547:     .word 569362511
+d2548:     .word 1076314625
+d2549:     .word 1583266739
+d2550:     .word 2090218853
+d2551:     .word 449687320
+d2552:     .word 956639434
+d2553:     .word 1463591548
+d2554:     .word 1970543662
+d2555:     .word 330012129
+d2556:     .word 836964243
+d2557:     .word 1343916357
+d2558:     .word 1850868471
+d2559:     .word 210336938
+d2560:     .word 717289052
+d2561:     .word 1224241166
+d2562:     .word 1731193280
+d2563:     .word 90661747
+d2564:     .word 597613861
+d2565:     .word 1104565975
+d2566:     .word 1611518089
+d2567:     .word 2118470203
+d2568:     .word 477938670
+d2569:     .word 984890784
+d2570:     .word 1491842898
+d2571:     .word 1998795012
+d2572:     .word 358263479
+d2573:     .word 865215593
+d2574:     .word 1372167707
+d2575:     .word 1879119821
+d2576:     .word 238588288
+d2577:     .word 745540402
+d2578:     .word 1252492516
+d2579:     .word 1759444630
+d2580:     .word 118913097
+d2581:     .word 625865211
+d2582:     .word 1132817325
+d2583:     .word 1639769439
+d2584:     .word 2146721553
+d2585:     .word 506190020
+d2586:     .word 1013142134
+d2587:     .word 1520094248
+d2588:     .word 2027046362
+d2589:     .word 386514829
+d2590:     .word 893466943
+d2591:     .word 1400419057
+d2592:     .word 1907371171
+d2593:     .word 266839638
+d2594:     .word 773791752
+d2595:     .word 1280743866
+d2596:     .word 1787695980
+d2597:     .word 147164447
+d2598:     .word 654116561
+d2599:     .word 1161068675
+d2600:     .word 1668020789
+d2601:     .word 27489256
+d2602:     .word 534441370
+d2603:     .word 1041393484
+d2604:     .word 1548345598
+d2605:     .word 2055297712
+d2606:     .word 414766179
+d2607:     .word 921718293
+d2608:     .word 1428670407
+d2609:     .word 1935622521
+d2610:     .word 295090988
+d2611:     .word 802043102
+d2612:     .word 1308995216
+d2613:     .word 1815947330
+d2614:     .word 175415797
+d2615:     .word 682367911
+d2616:     .word 1189320025
+d2617:     .word 1696272139
+d2618:     .word 55740606
+d2619:     .word 562692720
+d2620:     .word 1069644834
+d2621:     .word 1576596948
+d2622:     .word 2083549062
+d2623:     .word 443017529
+d2624:     .word 949969643
+d2625:     .word 1456921757
+d2626:     .word 1963873871
+d2627:     .word 323342338
+d2628:     .word 830294452
+d2629:     .word 1337246566
+d2630:     .word 1844198680
+d2631:     .word 203667147
+d2632:     .word 710619261
+d2633:     .word 1217571375
+d2634:     .word 1724523489
+d2635:     .word 83991956
+d2636:     .word 590944070
+d2637:     .word 1097896184
+d2638:     .word 1604848298
+d2639:     .word 2111800412
+d2640:     .word 471268879
+d2641:     .word 978220993
+d2642:     .word 1485173107
+d2643:     .word 1992125221
+d2644:     .word 351593688
+d2645:     .word 858545802
+d2646:     .word 1365497916
+d2647:     .word 1872450030
+d2648:     .word 231918497
+d2649:     .word 738870611
+d2650:     .word 1245822725
+d2651:     .word 1752774839
+d2652:     .word 112243306
+d2653:     .word 619195420
+d2654:     .word 1126147534
+d2655:     .word 1633099648
+d2656:     .word 2140051762
+d2657:     .word 499520229
+d2658:     .word 1006472343
+d2659:     .word 1513424457
+d2660:     .word 2020376571
+d2661:     .word 379845038
+d2662:     .word 886797152
+d2663:     .word 1393749266
+d2664:     .word 1900701380
+d2665:     .word 260169847
+d2666:     .word 767121961
+d2667:     .word 1274074075
+d2668:     .word 1781026189
+d2669:     .word 140494656
+d2670:     .word 647446770
+d2671:     .word 1154398884
+d2672:     .word 1661350998
+d2673:     .word 20819465
+d2674:     .word 527771579
+d2675:     .word 1034723693
+d2676:     .word 1541675807
+d2677:     .word 2048627921
+d2678:     .word 408096388
+d2679:     .word 915048502
+d2680:     .word 1422000616
+d2681:     .word 1928952730
+d2682:     .word 288421197
+d2683:     .word 795373311
+d2684:     .word 1302325425
+d2685:     .word 1809277539
+d2686:     .word 168746006
+d2687:     .word 675698120
+d2688:     .word 1182650234
+d2689:     .word 1689602348
+d2690:     .word 49070815
+d2691:     .word 556022929
+d2692:     .word 1062975043
+d2693:     .word 1569927157
+d2694:     .word 2076879271
+d2695:     .word 436347738
+d2696:     .word 943299852
+d2697:     .word 1450251966
+d2698:     .word 1957204080
+d2699:     .word 316672547
+d2700:     .word 823624661
+d2701:     .word 1330576775
+d2702:     .word 1837528889
+d2703:     .word 196997356
+d2704:     .word 703949470
+d2705:     .word 1210901584
+d2706:     .word 1717853698
+d2707:     .word 77322165
+d2708:     .word 584274279
+d2709:     .word 1091226393
+d2710:     .word 1598178507
+d2711:     .word 2105130621
+d2712:     .word 464599088
+d2713:     .word 971551202
+d2714:     .word 1478503316
+d2715:     .word 1985455430
+d2716:     .word 344923897
+d2717:     .word 851876011
+d2718:     .word 1358828125
+d2719:     .word 1865780239
+d2720:     .word 225248706
+d2721:     .word 732200820
+d2722:     .word 1239152934
+d2723:     .word 1746105048
+d2724:     .word 105573515
+d2725:     .word 612525629
+d2726:     .word 1119477743
+d2727:     .word 1626429857
+d2728:     .word 2133381971
+d2729:     .word 492850438
+d2730:     .word 999802552
+d2731:     .word 1506754666
+d2732:     .word 2013706780
+d2733:     .word 373175247
+d2734:     .word 880127361
+d2735:     .word 1387079475
+d2736:     .word 1894031589
+d2737:     .word 253500056
+d2738:     .word 760452170
+d2739:     .word 1267404284
+d2740:     .word 1774356398
+d2741:     .word 133824865
+d2742:     .word 640776979
+d2743:     .word 1147729093
+d2744:     .word 1654681207
+d2745:     .word 14149674
+d2746:     .word 521101788
+d2747:     .word 1028053902
+d2748:     .word 1535006016
+d2749:     .word 2041958130
+d2750:     .word 401426597
+d2751:     .word 908378711
+d2752:     .word 1415330825
+d2753:     .word 1922282939
+d2754:     .word 281751406
+d2755:     .word 788703520
+d2756:     .word 1295655634
+d2757:     .word 1802607748
+d2758:     .word 162076215
+d2759:     .word 669028329
+d2760:     .word 1175980443
+d2761:     .word 1682932557
+d2762:     .word 42401024
+d2763:     .word 549353138
+d2764:     .word 1056305252
+d2765:     .word 1563257366
+d2766:     .word 2070209480
+d2767:     .word 429677947
+d2768:     .word 936630061
+d2769:     .word 1443582175
+d2770:     .word 1950534289
+d2771:     .word 310002756
+d2772:     .word 816954870
+d2773:     .word 1323906984
+d2774:     .word 1830859098
+d2775:     .word 190327565
+d2776:     .word 697279679
+d2777:     .word 1204231793
+d2778:     .word 1711183907
+d2779:     .word 70652374
+d2780:     .word 577604488
+d2781:     .word 1084556602
+d2782:     .word 1591508716
+d2783:     .word 2098460830
+d2784:     .word 457929297
+d2785:     .word 964881411
+d2786:     .word 1471833525
+d2787:     .word 1978785639
+d2788:     .word 338254106
+d2789:     .word 845206220
+d2790:     .word 1352158334
+d2791:     .word 1859110448
+d2792:     .word 218578915
+d2793:     .word 725531029
+d2794:     .word 1232483143
+d2795:     .word 1739435257
+d2796:     .word 98903724
+d2797:     .word 605855838
+d2798:     .word 1112807952
+d2799:     .word 1619760066
+d2800:     .word 2126712180
+d2801:     .word 486180647
+d2802:     .word 993132761
+d2803:     .word 1500084875
+d2804:     .word 2007036989
+d2805:     .word 366505456
+d2806:     .word 873457570
+d2807:     .word 1380409684
+d2808:     .word 1887361798
+d2809:     .word 246830265
+d2810:     .word 753782379
+d2811:     .word 1260734493
+d2812:     .word 1767686607
+d2813:     .word 127155074
+d2814:     .word 634107188
+d2815:     .word 1141059302
+d2816:     .word 1648011416
+d2817:     .word 7479883
+d2818:     .word 514431997
+d2819:     .word 1021384111
+d2820:     .word 1528336225
+d2821:     .word 2035288339
+d2822:     .word 394756806
+d2823:     .word 901708920
+d2824:     .word 1408661034
+d2825:     .word 1915613148
+d2826:     .word 275081615
+d2827:     .word 782033729
+d2828:     .word 1288985843
+d2829:     .word 1795937957
+d2830:     .word 155406424
+d2831:     .word 662358538
+d2832:     .word 1169310652
+d2833:     .word 1676262766
+d2834:     .word 35731233
+d2835:     .word 542683347
+d2836:     .word 1049635461
+d2837:     .word 1556587575
+d2838:     .word 2063539689
+d2839:     .word 423008156
+d2840:     .word 929960270
+d2841:     .word 1436912384
+d2842:     .word 1943864498
+d2843:     .word 303332965
+d2844:     .word 810285079
+d2845:     .word 1317237193
+d2846:     .word 1824189307
+d2847:     .word 183657774
+d2848:     .word 690609888
+d2849:     .word 1197562002
+d2850:     .word 1704514116
+d2851:     .word 63982583
+d2852:     .word 570934697
+d2853:     .word 1077886811
+d2854:     .word 1584838925
+d2855:     .word 2091791039
+d2856:     .word 451259506
+d2857:     .word 958211620
+d2858:     .word 1465163734
+d2859:     .word 1972115848
+d2860:     .word 331584315
+d2861:     .word 838536429
+d2862:     .word 1345488543
+d2863:     .word 1852440657
+d2864:     .word 211909124
+d2865:     .word 718861238
+d2866:     .word 1225813352
+d2867:     .word 1732765466
+d2868:     .word 92233933
+d2869:     .word 599186047
+d2870:     .word 1106138161
+d2871:     .word 1613090275
+d2872:     .word 2120042389
+d2873:     .word 479510856
+d2874:     .word 986462970
+d2875:     .word 1493415084
+d2876:     .word 2000367198
+d2877:     .word 359835665
+d2878:     .word 866787779
+d2879:     .word 1373739893
+d2880:     .word 1880692007
+d2881:     .word 240160474
+d2882:     .word 747112588
+d2883:     .word 1254064702
+d2884:     .word 1761016816
+d2885:     .word 120485283
+d2886:     .word 627437397
+d2887:     .word 1134389511
+d2888:     .word 1641341625
+d2889:     .word 810092
+d2890:     .word 507762206
+d2891:     .word 1014714320
+d2892:     .word 1521666434
+d2893:     .word 2028618548
+d2894:     .word 388087015
+d2895:     .word 895039129
+d2896:     .word 1401991243
+d2897:     .word 1908943357
+d2898:     .word 268411824
+d2899:     .word 775363938
+d2900:     .word 1282316052
+d2901:     .word 1789268166
+d2902:     .word 148736633
+d2903:     .word 655688747
+d2904:     .word 1162640861
+d2905:     .word 1669592975
+d2906:     .word 29061442
+d2907:     .word 536013556
+d2908:     .word 1042965670
+d2909:     .word 1549917784
+d2910:     .word 2056869898
+d2911:     .word 416338365
+d2912:     .word 923290479
+d2913:     .word 1430242593
+d2914:     .word 1937194707
+d2915:     .word 296663174
+d2916:     .word 803615288
+d2917:     .word 1310567402
+d2918:     .word 1817519516
+d2919:     .word 176987983
+d2920:     .word 683940097
+d2921:     .word 1190892211
+d2922:     .word 1697844325
+d2923:     .word 57312792
+d2924:     .word 564264906
+d2925:     .word 1071217020
+d2926:     .word 1578169134
+d2927:     .word 2085121248
+d2928:     .word 444589715
+d2929:     .word 951541829
+d2930:     .word 1458493943
+d2931:     .word 1965446057
+d2932:     .word 324914524
+d2933:     .word 831866638
+d2934:     .word 1338818752
+d2935:     .word 1845770866
+d2936:     .word 205239333
+d2937:     .word 712191447
+d2938:     .word 1219143561
+d2939:     .word 1726095675
+d2940:     .word 85564142
+d2941:     .word 592516256
+d2942:     .word 1099468370
+d2943:     .word 1606420484
+d2944:     .word 2113372598
+d2945:     .word 472841065
+d2946:     .word 979793179
+d2947:     .word 1486745293
+d2948:     .word 1993697407
+d2949:     .word 353165874
+d2950:     .word 860117988
+d2951:     .word 1367070102
+d2952:     .word 1874022216
+d2953:     .word 233490683
+d2954:     .word 740442797
+d2955:     .word 1247394911
+d2956:     .word 1754347025
+d2957:     .word 113815492
+d2958:     .word 620767606
+d2959:     .word 1127719720
+d2960:     .word 1634671834
+d2961:     .word 2141623948
+d2962:     .word 501092415
+d2963:     .word 1008044529
+d2964:     .word 1514996643
+d2965:     .word 2021948757
+d2966:     .word 381417224
+d2967:     .word 888369338
+d2968:     .word 1395321452
+d2969:     .word 1902273566
+d2970:     .word 261742033
+d2971:     .word 768694147
+d2972:     .word 1275646261
+d2973:     .word 1782598375
+d2974:     .word 142066842
+d2975:     .word 649018956
+d2976:     .word 1155971070
+d2977:     .word 1662923184
+d2978:     .word 22391651
+d2979:     .word 529343765
+d2980:     .word 1036295879
+d2981:     .word 1543247993
+d2982:     .word 2050200107
+d2983:     .word 409668574
+d2984:     .word 916620688
+d2985:     .word 1423572802
+d2986:     .word 1930524916
+d2987:     .word 289993383
+d2988:     .word 796945497
+d2989:     .word 1303897611
+d2990:     .word 1810849725
+d2991:     .word 170318192
+d2992:     .word 677270306
+d2993:     .word 1184222420
+d2994:     .word 1691174534
+d2995:     .word 50643001
+d2996:     .word 557595115
+d2997:     .word 1064547229
+d2998:     .word 1571499343
+d2999:     .word 2078451457
+d3000:     .word 437919924
+d3001:     .word 944872038
+d3002:     .word 1451824152
+d3003:     .word 1958776266
+d3004:     .word 318244733
+d3005:     .word 825196847
+d3006:     .word 1332148961
+d3007:     .word 1839101075
+d3008:     .word 198569542
+d3009:     .word 705521656
+d3010:     .word 1212473770
+d3011:     .word 1719425884
+d3012:     .word 78894351
+d3013:     .word 585846465
+d3014:     .word 1092798579
+d3015:     .word 1599750693
+d3016:     .word 2106702807
+d3017:     .word 466171274
+d3018:     .word 973123388
+d3019:     .word 1480075502
+d3020:     .word 1987027616
+d3021:     .word 346496083
+d3022:     .word 853448197
+d3023:     .word 1360400311
+d3024:     .word 1867352425
+d3025:     .word 226820892
+d3026:     .word 733773006
+d3027:     .word 1240725120
+d3028:     .word 1747677234
+d3029:     .word 107145701
+d3030:     .word 614097815
+d3031:     .word 1121049929
+d3032:     .word 1628002043
+d3033:     .word 2134954157
+d3034:     .word 494422624
+d3035:     .word 1001374738
+d3036:     .word 1508326852
+d3037:     .word 2015278966
+d3038:     .word 374747433
+d3039:     .word 881699547
+d3040:     .word 1388651661
+d3041:     .word 1895603775
+d3042:     .word 255072242
+d3043:     .word 762024356
+d3044:     .word 1268976470
+d3045:     .word 1775928584
+d3046:     .word 135397051
+d3047:     .word 642349165
+d3048:     .word 1149301279
+d3049:     .word 1656253393
+d3050:     .word 15721860
+d3051:     .word 522673974
+d3052:     .word 1029626088
+d3053:     .word 1536578202
+d3054:     .word 2043530316
+d3055:     .word 402998783
+d3056:     .word 909950897
+d3057:     .word 1416903011
+d3058:     .word 1923855125
+d3059:     .word 283323592
+d3060:     .word 790275706
+d3061:     .word 1297227820
+d3062:     .word 1804179934
+d3063:     .word 163648401
+d3064:     .word 670600515
+d3065:     .word 1177552629
+d3066:     .word 1684504743
+d3067:     .word 43973210
+d3068:     .word 550925324
+d3069:     .word 1057877438
+d3070:     .word 1564829552
+d3071:     .word 2071781666
+d3072:     .word 431250133
+d3073:     .word 938202247
+d3074:     .word 1445154361
+d3075:     .word 1952106475
+d3076:     .word 311574942
+d3077:     .word 818527056
+d3078:     .word 1325479170
+d3079:     .word 1832431284
+d3080:     .word 191899751
+d3081:     .word 698851865
+d3082:     .word 1205803979
+d3083:     .word 1712756093
+d3084:     .word 72224560
+d3085:     .word 579176674
+d3086:     .word 1086128788
+d3087:     .word 1593080902
+d3088:     .word 2100033016
+d3089:     .word 459501483
+d3090:     .word 966453597
+d3091:     .word 1473405711
+d3092:     .word 1980357825
+d3093:     .word 339826292
+d3094:     .word 846778406
+d3095:     .word 1353730520
+d3096:     .word 1860682634
+d3097:     .word 220151101
+d3098:     .word 727103215
+d3099:     .word 1234055329
+d3100:     .word 1741007443
+d3101:     .word 100475910
+d3102:     .word 607428024
+d3103:     .word 1114380138
+d3104:     .word 1621332252
+d3105:     .word 2128284366
+d3106:     .word 487752833
+d3107:     .word 994704947
+d3108:     .word 1501657061
+d3109:     .word 2008609175
+d3110:     .word 368077642
+d3111:     .word 875029756
+d3112:     .word 1381981870
+d3113:     .word 1888933984
+d3114:     .word 248402451
+d3115:     .word 755354565
+d3116:     .word 1262306679
+d3117:     .word 1769258793
+d3118:     .word 128727260
+d3119:     .word 635679374
+d3120:     .word 1142631488
+d3121:     .word 1649583602
+d3122:     .word 9052069
+d3123:     .word 516004183
+d3124:     .word 1022956297
+d3125:     .word 1529908411
+d3126:     .word 2036860525
+d3127:     .word 396328992
+d3128:     .word 903281106
+d3129:     .word 1410233220
+d3130:     .word 1917185334
+d3131:     .word 276653801
+d3132:     .word 783605915
+d3133:     .word 1290558029
+d3134:     .word 1797510143
+d3135:     .word 156978610
+d3136:     .word 663930724
+d3137:     .word 1170882838
+d3138:     .word 1677834952
+d3139:     .word 37303419
+d3140:     .word 544255533
+d3141:     .word 1051207647
+d3142:     .word 1558159761
+d3143:     .word 2065111875
+d3144:     .word 424580342
+d3145:     .word 931532456
+d3146:     .word 1438484570
+d3147:     .word 1945436684
+d3148:     .word 304905151
+d3149:     .word 811857265
+d3150:     .word 1318809379
+d3151:     .word 1825761493
+d3152:     .word 185229960
+d3153:     .word 692182074
+d3154:     .word 1199134188
+d3155:     .word 1706086302
+d3156:     .word 65554769
+d3157:     .word 572506883
+d3158:     .word 1079458997
+d3159:     .word 1586411111
+d3160:     .word 2093363225
+d3161:     .word 452831692
+d3162:     .word 959783806
+d3163:     .word 1466735920
+d3164:     .word 1973688034
+d3165:     .word 333156501
+d3166:     .word 840108615
+d3167:     .word 1347060729
+d3168:     .word 1854012843
+d3169:     .word 213481310
+d3170:     .word 720433424
+d3171:     .word 1227385538
+d3172:     .word 1734337652
+d3173:     .word 93806119
+d3174:     .word 600758233
+d3175:     .word 1107710347
+d3176:     .word 1614662461
+d3177:     .word 2121614575
+d3178:     .word 481083042
+d3179:     .word 988035156
+d3180:     .word 1494987270
+d3181:     .word 2001939384
+d3182:     .word 361407851
+d3183:     .word 868359965
+d3184:     .word 1375312079
+d3185:     .word 1882264193
+d3186:     .word 241732660
+d3187:     .word 748684774
+d3188:     .word 1255636888
+d3189:     .word 1762589002
+d3190:     .word 122057469
+d3191:     .word 629009583
+d3192:     .word 1135961697
+d3193:     .word 1642913811
+d3194:     .word 2382278
+d3195:     .word 509334392
+d3196:     .word 1016286506
+d3197:     .word 1523238620
+d3198:     .word 2030190734
+d3199:     .word 389659201
+d3200:     .word 896611315
+d3201:     .word 1403563429
+d3202:     .word 1910515543
+d3203:     .word 269984010
+d3204:     .word 776936124
+d3205:     .word 1283888238
+d3206:     .word 1790840352
+d3207:     .word 150308819
+d3208:     .word 657260933
+d3209:     .word 1164213047
+d3210:     .word 1671165161
+d3211:     .word 30633628
+d3212:     .word 537585742
+d3213:     .word 1044537856
+d3214:     .word 1551489970
+d3215:     .word 2058442084
+d3216:     .word 417910551
+d3217:     .word 924862665
+d3218:     .word 1431814779
+d3219:     .word 1938766893
+d3220:     .word 298235360
+d3221:     .word 805187474
+d3222:     .word 1312139588
+d3223:     .word 1819091702
+d3224:     .word 178560169
+d3225:     .word 685512283
+d3226:     .word 1192464397
+d3227:     .word 1699416511
+d3228:     .word 58884978
+d3229:     .word 565837092
+d3230:     .word 1072789206
+d3231:     .word 1579741320
+d3232:     .word 2086693434
+d3233:     .word 446161901
+d3234:     .word 953114015
+d3235:     .word 1460066129
+d3236:     .word 1967018243
+d3237:     .word 326486710
+d3238:     .word 833438824
+d3239:     .word 1340390938
+d3240:     .word 1847343052
+d3241:     .word 206811519
+d3242:     .word 713763633
+d3243:     .word 1220715747
+d3244:     .word 1727667861
+d3245:     .word 87136328
+d3246:     .word 594088442
+d3247:     .word 1101040556
+d3248:     .word 1607992670
+d3249:     .word 2114944784
+d3250:     .word 474413251
+d3251:     .word 981365365
+d3252:     .word 1488317479
+d3253:     .word 1995269593
+d3254:     .word 354738060
+d3255:     .word 861690174
+d3256:     .word 1368642288
+d3257:     .word 1875594402
+d3258:     .word 235062869
+d3259:     .word 742014983
+d3260:     .word 1248967097
+d3261:     .word 1755919211
+d3262:     .word 115387678
+d3263:     .word 622339792
+d3264:     .word 1129291906
+d3265:     .word 1636244020
+d3266:     .word 2143196134
+d3267:     .word 502664601
+d3268:     .word 1009616715
+d3269:     .word 1516568829
+d3270:     .word 2023520943
+d3271:     .word 382989410
+d3272:     .word 889941524
+d3273:     .word 1396893638
+d3274:     .word 1903845752
+d3275:     .word 263314219
+d3276:     .word 770266333
+d3277:     .word 1277218447
+d3278:     .word 1784170561
+d3279:     .word 143639028
+d3280:     .word 650591142
+d3281:     .word 1157543256
+d3282:     .word 1664495370
+d3283:     .word 23963837
+d3284:     .word 530915951
+d3285:     .word 1037868065
+d3286:     .word 1544820179
+d3287:     .word 2051772293
+d3288:     .word 411240760
+d3289:     .word 918192874
+d3290:     .word 1425144988
+d3291:     .word 1932097102
+d3292:     .word 291565569
+d3293:     .word 798517683
+d3294:     .word 1305469797
+d3295:     .word 1812421911
+d3296:     .word 171890378
+d3297:     .word 678842492
+d3298:     .word 1185794606
+d3299:     .word 1692746720
+d3300:     .word 52215187
+d3301:     .word 559167301
+d3302:     .word 1066119415
+d3303:     .word 1573071529
+d3304:     .word 2080023643
+d3305:     .word 439492110
+d3306:     .word 946444224
+d3307:     .word 1453396338
+d3308:     .word 1960348452
+d3309:     .word 319816919
+d3310:     .word 826769033
+d3311:     .word 1333721147
+d3312:     .word 1840673261
+d3313:     .word 200141728
+d3314:     .word 707093842
+d3315:     .word 1214045956
+d3316:     .word 1720998070
+d3317:     .word 80466537
+d3318:     .word 587418651
+d3319:     .word 1094370765
+d3320:     .word 1601322879
+d3321:     .word 2108274993
+d3322:     .word 467743460
+d3323:     .word 974695574
+d3324:     .word 1481647688
+d3325:     .word 1988599802
+d3326:     .word 348068269
+d3327:     .word 855020383
+d3328:     .word 1361972497
+d3329:     .word 1868924611
+d3330:     .word 228393078
+d3331:     .word 735345192
+d3332:     .word 1242297306
+d3333:     .word 1749249420
+d3334:     .word 108717887
+d3335:     .word 615670001
+d3336:     .word 1122622115
+d3337:     .word 1629574229
+d3338:     .word 2136526343
+d3339:     .word 495994810
+d3340:     .word 1002946924
+d3341:     .word 1509899038
+d3342:     .word 2016851152
+d3343:     .word 376319619
+d3344:     .word 883271733
+d3345:     .word 1390223847
+d3346:     .word 1897175961
+d3347:     .word 256644428
+d3348:     .word 763596542
+d3349:     .word 1270548656
+d3350:     .word 1777500770
+d3351:     .word 136969237
+d3352:     .word 643921351
+d3353:     .word 1150873465
+d3354:     .word 1657825579
+d3355:     .word 17294046
+d3356:     .word 524246160
+d3357:     .word 1031198274
+d3358:     .word 1538150388
+d3359:     .word 2045102502
+d3360:     .word 404570969
+d3361:     .word 911523083
+d3362:     .word 1418475197
+d3363:     .word 1925427311
+d3364:     .word 284895778
+d3365:     .word 791847892
+d3366:     .word 1298800006
+d3367:     .word 1805752120
+d3368:     .word 165220587
+d3369:     .word 672172701
+d3370:     .word 1179124815
+d3371:     .word 1686076929
+d3372:     .word 45545396
+d3373:     .word 552497510
+d3374:     .word 1059449624
+d3375:     .word 1566401738
+d3376:     .word 2073353852
+d3377:     .word 432822319
+d3378:     .word 939774433
+d3379:     .word 1446726547
+d3380:     .word 1953678661
+d3381:     .word 313147128
+d3382:     .word 820099242
+d3383:     .word 1327051356
+d3384:     .word 1834003470
+d3385:     .word 193471937
+d3386:     .word 700424051
+d3387:     .word 1207376165
+d3388:     .word 1714328279
+d3389:     .word 73796746
+d3390:     .word 580748860
+d3391:     .word 1087700974
+d3392:     .word 1594653088
+d3393:     .word 2101605202
+d3394:     .word 461073669
+d3395:     .word 968025783
+d3396:     .word 1474977897
+d3397:     .word 1981930011
+d3398:     .word 341398478
+d3399:     .word 848350592
+d3400:     .word 1355302706
+d3401:     .word 1862254820
+d3402:     .word 221723287
+d3403:     .word 728675401
+d3404:     .word 1235627515
+d3405:     .word 1742579629
+d3406:     .word 102048096
+d3407:     .word 609000210
+d3408:     .word 1115952324
+d3409:     .word 1622904438
+d3410:     .word 2129856552
+d3411:     .word 489325019
+d3412:     .word 996277133
+d3413:     .word 1503229247
+d3414:     .word 2010181361
+d3415:     .word 369649828
+d3416:     .word 876601942
+d3417:     .word 1383554056
+d3418:     .word 1890506170
+d3419:     .word 249974637
+d3420:     .word 756926751
+d3421:     .word 1263878865
+d3422:     .word 1770830979
+d3423:     .word 130299446
+d3424:     .word 637251560
+d3425:     .word 1144203674
+d3426:     .word 1651155788
+d3427:     .word 10624255
+d3428:     .word 517576369
+d3429:     .word 1024528483
+d3430:     .word 1531480597
+d3431:     .word 2038432711
+d3432:     .word 397901178
+d3433:     .word 904853292
+d3434:     .word 1411805406
+d3435:     .word 1918757520
+d3436:     .word 278225987
+d3437:     .word 785178101
+d3438:     .word 1292130215
+d3439:     .word 1799082329
+d3440:     .word 158550796
+d3441:     .word 665502910
+d3442:     .word 1172455024
+d3443:     .word 1679407138
+d3444:     .word 38875605
+d3445:     .word 545827719
+d3446:     .word 1052779833
+d3447:     .word 1559731947
+d3448:     .word 2066684061
+d3449:     .word 426152528
+d3450:     .word 933104642
+d3451:     .word 1440056756
+d3452:     .word 1947008870
+d3453:     .word 306477337
+d3454:     .word 813429451
+d3455:     .word 1320381565
+d3456:     .word 1827333679
+d3457:     .word 186802146
+d3458:     .word 693754260
+d3459:     .word 1200706374
+d3460:     .word 1707658488
+d3461:     .word 67126955
+d3462:     .word 574079069
+d3463:     .word 1081031183
+d3464:     .word 1587983297
+d3465:     .word 2094935411
+d3466:     .word 454403878
+d3467:     .word 961355992
+d3468:     .word 1468308106
+d3469:     .word 1975260220
+d3470:     .word 334728687
+d3471:     .word 841680801
+d3472:     .word 1348632915
+d3473:     .word 1855585029
+d3474:     .word 215053496
+d3475:     .word 722005610
+d3476:     .word 1228957724
+d3477:     .word 1735909838
+d3478:     .word 95378305
+d3479:     .word 602330419
+d3480:     .word 1109282533
+d3481:     .word 1616234647
+d3482:     .word 2123186761
+d3483:     .word 482655228
+d3484:     .word 989607342
+d3485:     .word 1496559456
+d3486:     .word 2003511570
+d3487:     .word 362980037
+d3488:     .word 869932151
+d3489:     .word 1376884265
+d3490:     .word 1883836379
+d3491:     .word 243304846
+d3492:     .word 750256960
+d3493:     .word 1257209074
+d3494:     .word 1764161188
+d3495:     .word 123629655
+d3496:     .word 630581769
+d3497:     .word 1137533883
+d3498:     .word 1644485997
+d3499:     .word 3954464
+d3500:     .word 510906578
+d3501:     .word 1017858692
+d3502:     .word 1524810806
+d3503:     .word 2031762920
+d3504:     .word 391231387
+d3505:     .word 898183501
+d3506:     .word 1405135615
+d3507:     .word 1912087729
+d3508:     .word 271556196
+d3509:     .word 778508310
+d3510:     .word 1285460424
+d3511:     .word 1792412538
+d3512:     .word 151881005
+d3513:     .word 658833119
+d3514:     .word 1165785233
+d3515:     .word 1672737347
+d3516:     .word 32205814
+d3517:     .word 539157928
+d3518:     .word 1046110042
+d3519:     .word 1553062156
+d3520:     .word 2060014270
+d3521:     .word 419482737
+d3522:     .word 926434851
+d3523:     .word 1433386965
+d3524:     .word 1940339079
+d3525:     .word 299807546
+d3526:     .word 806759660
+d3527:     .word 1313711774
+d3528:     .word 1820663888
+d3529:     .word 180132355
+d3530:     .word 687084469
+d3531:     .word 1194036583
+d3532:     .word 1700988697
+d3533:     .word 60457164
+d3534:     .word 567409278
+d3535:     .word 1074361392
+d3536:     .word 1581313506
+d3537:     .word 2088265620
+d3538:     .word 447734087
+d3539:     .word 954686201
+d3540:     .word 1461638315
+d3541:     .word 1968590429
+d3542:     .word 328058896
+d3543:     .word 835011010
+d3544:     .word 1341963124
+d3545:     .word 1848915238
+d3546:     .word 208383705
+d3547:     .word 715335819
+d3548:     .word 1222287933
+d3549:     .word 1729240047
+d3550:     .word 88708514
+d3551:     .word 595660628
+d3552:     .word 1102612742
+d3553:     .word 1609564856
+d3554:     .word 2116516970
+d3555:     .word 475985437
+d3556:     .word 982937551
+d3557:     .word 1489889665
+d3558:     .word 1996841779
+d3559:     .word 356310246
+d3560:     .word 863262360
+d3561:     .word 1370214474
+d3562:     .word 1877166588
+d3563:     .word 236635055
+d3564:     .word 743587169
+d3565:     .word 1250539283
+d3566:     .word 1757491397
+d3567:     .word 116959864
+d3568:     .word 623911978
+d3569:     .word 1130864092
+d3570:     .word 1637816206
+d3571:     .word 2144768320
+d3572:     .word 504236787
+d3573:     .word 1011188901
+d3574:     .word 1518141015
+d3575:     .word 2025093129
+d3576:     .word 384561596
+d3577:     .word 891513710
+d3578:     .word 1398465824
+d3579:     .word 1905417938
+d3580:     .word 264886405
+d3581:     .word 771838519
+d3582:     .word 1278790633
+d3583:     .word 1785742747
+d3584:     .word 145211214
+d3585:     .word 652163328
+d3586:     .word 1159115442
+d3587:     .word 1666067556
+d3588:     .word 25536023
+d3589:     .word 532488137
+d3590:     .word 1039440251
+d3591:     .word 1546392365
+d3592:     .word 2053344479
+d3593:     .word 412812946
+d3594:     .word 919765060
+d3595:     .word 1426717174
+d3596:     .word 1933669288
+d3597:     .word 293137755
+d3598:     .word 800089869
+d3599:     .word 1307041983
+d3600:     .word 1813994097
+d3601:     .word 173462564
+d3602:     .word 680414678
+d3603:     .word 1187366792
+d3604:     .word 1694318906
+d3605:     .word 53787373
+d3606:     .word 560739487
+d3607:     .word 1067691601
+d3608:     .word 1574643715
+d3609:     .word 2081595829
+d3610:     .word 441064296
+d3611:     .word 948016410
+d3612:     .word 1454968524
+d3613:     .word 1961920638
+d3614:     .word 321389105
+d3615:     .word 828341219
+d3616:     .word 1335293333
+d3617:     .word 1842245447
+d3618:     .word 201713914
+d3619:     .word 708666028
+d3620:     .word 1215618142
+d3621:     .word 1722570256
+d3622:     .word 82038723
+d3623:     .word 588990837
+d3624:     .word 1095942951
+d3625:     .word 1602895065
+d3626:     .word 2109847179
+d3627:     .word 469315646
+d3628:     .word 976267760
+d3629:     .word 1483219874
+d3630:     .word 1990171988
+d3631:     .word 349640455
+d3632:     .word 856592569
+d3633:     .word 1363544683
+d3634:     .word 1870496797
+d3635:     .word 229965264
+d3636:     .word 736917378
+d3637:     .word 1243869492
+d3638:     .word 1750821606
+d3639:     .word 110290073
+d3640:     .word 617242187
+d3641:     .word 1124194301
+d3642:     .word 1631146415
+d3643:     .word 2138098529
+d3644:     .word 497566996
+d3645:     .word 1004519110
+d3646:     .word 1511471224
+d3647:     .word 2018423338
+d3648:     .word 377891805
+d3649:     .word 884843919
+d3650:     .word 1391796033
+d3651:     .word 1898748147
+d3652:     .word 258216614
+d3653:     .word 765168728
+d3654:     .word 1272120842
+d3655:     .word 1779072956
+d3656:     .word 138541423
+d3657:     .word 645493537
+d3658:     .word 1152445651
+d3659:     .word 1659397765
+d3660:     .word 18866232
+d3661:     .word 525818346
+d3662:     .word 1032770460
+d3663:     .word 1539722574
+d3664:     .word 2046674688
+d3665:     .word 406143155
+d3666:     .word 913095269
+d3667:     .word 1420047383
+d3668:     .word 1926999497
+d3669:     .word 286467964
+d3670:     .word 793420078
+d3671:     .word 1300372192
+d3672:     .word 1807324306
+d3673:     .word 166792773
+d3674:     .word 673744887
+d3675:     .word 1180697001
+d3676:     .word 1687649115
+d3677:     .word 47117582
+d3678:     .word 554069696
+d3679:     .word 1061021810
+d3680:     .word 1567973924
+d3681:     .word 2074926038
+d3682:     .word 434394505
+d3683:     .word 941346619
+d3684:     .word 1448298733
+d3685:     .word 1955250847
+d3686:     .word 314719314
+d3687:     .word 821671428
+d3688:     .word 1328623542
+d3689:     .word 1835575656
+d3690:     .word 195044123
+d3691:     .word 701996237
+d3692:     .word 1208948351
+d3693:     .word 1715900465
+d3694:     .word 75368932
+d3695:     .word 582321046
+d3696:     .word 1089273160
+d3697:     .word 1596225274
+d3698:     .word 2103177388
+d3699:     .word 462645855
+d3700:     .word 969597969
+d3701:     .word 1476550083
+d3702:     .word 1983502197
+d3703:     .word 342970664
+d3704:     .word 849922778
+d3705:     .word 1356874892
+d3706:     .word 1863827006
+d3707:     .word 223295473
+d3708:     .word 730247587
+d3709:     .word 1237199701
+d3710:     .word 1744151815
+d3711:     .word 103620282
+d3712:     .word 610572396
+d3713:     .word 1117524510
+d3714:     .word 1624476624
+d3715:     .word 2131428738
+d3716:     .word 490897205
+d3717:     .word 997849319
+d3718:     .word 1504801433
+d3719:     .word 2011753547
+d3720:     .word 371222014
+d3721:     .word 878174128
+d3722:     .word 1385126242
+d3723:     .word 1892078356
+d3724:     .word 251546823
+d3725:     .word 758498937
+d3726:     .word 1265451051
+d3727:     .word 1772403165
+d3728:     .word 131871632
+d3729:     .word 638823746
+d3730:     .word 1145775860
+d3731:     .word 1652727974
+d3732:     .word 12196441
+d3733:     .word 519148555
+d3734:     .word 1026100669
+d3735:     .word 1533052783
+d3736:     .word 2040004897
+d3737:     .word 399473364
+d3738:     .word 906425478
+d3739:     .word 1413377592
+d3740:     .word 1920329706
+d3741:     .word 279798173
+d3742:     .word 786750287
+d3743:     .word 1293702401
+d3744:     .word 1800654515
+d3745:     .word 160122982
+d3746:     .word 667075096
+d3747:     .word 1174027210
+d3748:     .word 1680979324
+d3749:     .word 40447791
+d3750:     .word 547399905
+d3751:     .word 1054352019
+d3752:     .word 1561304133
+d3753:     .word 2068256247
+d3754:     .word 427724714
+d3755:     .word 934676828
+d3756:     .word 1441628942
+d3757:     .word 1948581056
+d3758:     .word 308049523
+d3759:     .word 815001637
+d3760:     .word 1321953751
+d3761:     .word 1828905865
+d3762:     .word 188374332
+d3763:     .word 695326446
+d3764:     .word 1202278560
+d3765:     .word 1709230674
+d3766:     .word 68699141
+d3767:     .word 575651255
+d3768:     .word 1082603369
+d3769:     .word 1589555483
+d3770:     .word 2096507597
+d3771:     .word 455976064
+d3772:     .word 962928178
+d3773:     .word 1469880292
+d3774:     .word 1976832406
+d3775:     .word 336300873
+d3776:     .word 843252987
+d3777:     .word 1350205101
+d3778:     .word 1857157215
+d3779:     .word 216625682
+d3780:     .word 723577796
+d3781:     .word 1230529910
+d3782:     .word 1737482024
+d3783:     .word 96950491
+d3784:     .word 603902605
+d3785:     .word 1110854719
+d3786:     .word 1617806833
+d3787:     .word 2124758947
+d3788:     .word 484227414
+d3789:     .word 991179528
+d3790:     .word 1498131642
+d3791:     .word 2005083756
+d3792:     .word 364552223
+d3793:     .word 871504337
+d3794:     .word 1378456451
+d3795:     .word 1885408565
+d3796:     .word 244877032
+d3797:     .word 751829146
+d3798:     .word 1258781260
+d3799:     .word 1765733374
+d3800:     .word 125201841
+d3801:     .word 632153955
+d3802:     .word 1139106069
+d3803:     .word 1646058183
+d3804:     .word 5526650
+d3805:     .word 512478764
+d3806:     .word 1019430878
+d3807:     .word 1526382992
+d3808:     .word 2033335106
+d3809:     .word 392803573
+d3810:     .word 899755687
+d3811:     .word 1406707801
+d3812:     .word 1913659915
+d3813:     .word 273128382
+d3814:     .word 780080496
+d3815:     .word 1287032610
+d3816:     .word 1793984724
+d3817:     .word 153453191
+d3818:     .word 660405305
+d3819:     .word 1167357419
+d3820:     .word 1674309533
+d3821:     .word 33778000
+d3822:     .word 540730114
+d3823:     .word 1047682228
+d3824:     .word 1554634342
+d3825:     .word 2061586456
+d3826:     .word 421054923
+d3827:     .word 928007037
+d3828:     .word 1434959151
+d3829:     .word 1941911265
+d3830:     .word 301379732
+d3831:     .word 808331846
+d3832:     .word 1315283960
+d3833:     .word 1822236074
+d3834:     .word 181704541
+d3835:     .word 688656655
+d3836:     .word 1195608769
+d3837:     .word 1702560883
+d3838:     .word 62029350
+d3839:     .word 568981464
+d3840:     .word 1075933578
+d3841:     .word 1582885692
+d3842:     .word 2089837806
+d3843:     .word 449306273
+d3844:     .word 956258387
+d3845:     .word 1463210501
+d3846:     .word 1970162615
+d3847:     .word 329631082
+d3848:     .word 836583196
+d3849:     .word 1343535310
+d3850:     .word 1850487424
+d3851:     .word 209955891
+d3852:     .word 716908005
+d3853:     .word 1223860119
+d3854:     .word 1730812233
+d3855:     .word 90280700
+d3856:     .word 597232814
+d3857:     .word 1104184928
+d3858:     .word 1611137042
+d3859:     .word 2118089156
+d3860:     .word 477557623
+d3861:     .word 984509737
+d3862:     .word 1491461851
+d3863:     .word 1998413965
+d3864:     .word 357882432
+d3865:     .word 864834546
+d3866:     .word 1371786660
+d3867:     .word 1878738774
+d3868:     .word 238207241
+d3869:     .word 745159355
+d3870:     .word 1252111469
+d3871:     .word 1759063583
+d3872:     .word 118532050
+d3873:     .word 625484164
+d3874:     .word 1132436278
+d3875:     .word 1639388392
+d3876:     .word 2146340506
+d3877:     .word 505808973
+d3878:     .word 1012761087
+d3879:     .word 1519713201
+d3880:     .word 2026665315
+d3881:     .word 386133782
+d3882:     .word 893085896
+d3883:     .word 1400038010
+d3884:     .word 1906990124
+d3885:     .word 266458591
+d3886:     .word 773410705
+d3887:     .word 1280362819
+d3888:     .word 1787314933
+d3889:     .word 146783400
+d3890:     .word 653735514
+d3891:     .word 1160687628
+d3892:     .word 1667639742
+d3893:     .word 27108209
+d3894:     .word 534060323
+d3895:     .word 1041012437
+d3896:     .word 1547964551
+d3897:     .word 2054916665
+d3898:     .word 414385132
+d3899:     .word 921337246
+d3900:     .word 1428289360
+d3901:     .word 1935241474
+d3902:     .word 294709941
+d3903:     .word 801662055
+d3904:     .word 1308614169
+d3905:     .word 1815566283
+d3906:     .word 175034750
+d3907:     .word 681986864
+d3908:     .word 1188938978
+d3909:     .word 1695891092
+d3910:     .word 55359559
+d3911:     .word 562311673
+d3912:     .word 1069263787
+d3913:     .word 1576215901
+d3914:     .word 2083168015
+d3915:     .word 442636482
+d3916:     .word 949588596
+d3917:     .word 1456540710
+d3918:     .word 1963492824
+d3919:     .word 322961291
+d3920:     .word 829913405
+d3921:     .word 1336865519
+d3922:     .word 1843817633
+d3923:     .word 203286100
+d3924:     .word 710238214
+d3925:     .word 1217190328
+d3926:     .word 1724142442
+d3927:     .word 83610909
+d3928:     .word 590563023
+d3929:     .word 1097515137
+d3930:     .word 1604467251
+d3931:     .word 2111419365
+d3932:     .word 470887832
+d3933:     .word 977839946
+d3934:     .word 1484792060
+d3935:     .word 1991744174
+d3936:     .word 351212641
+d3937:     .word 858164755
+d3938:     .word 1365116869
+d3939:     .word 1872068983
+d3940:     .word 231537450
+d3941:     .word 738489564
+d3942:     .word 1245441678
+d3943:     .word 1752393792
+d3944:     .word 111862259
+d3945:     .word 618814373
+d3946:     .word 1125766487
+d3947:     .word 1632718601
+d3948:     .word 2139670715
+d3949:     .word 499139182
+d3950:     .word 1006091296
+d3951:     .word 1513043410
+d3952:     .word 2019995524
+d3953:     .word 379463991
+d3954:     .word 886416105
+d3955:     .word 1393368219
+d3956:     .word 1900320333
+d3957:     .word 259788800
+d3958:     .word 766740914
+d3959:     .word 1273693028
+d3960:     .word 1780645142
+d3961:     .word 140113609
+d3962:     .word 647065723
+d3963:     .word 1154017837
+d3964:     .word 1660969951
+d3965:     .word 20438418
+d3966:     .word 527390532
+d3967:     .word 1034342646
+d3968:     .word 1541294760
+d3969:     .word 2048246874
+d3970:     .word 407715341
+d3971:     .word 914667455
+d3972:     .word 1421619569
+d3973:     .word 1928571683
+d3974:     .word 288040150
+d3975:     .word 794992264
+d3976:     .word 1301944378
+d3977:     .word 1808896492
+d3978:     .word 168364959
+d3979:     .word 675317073
+d3980:     .word 1182269187
+d3981:     .word 1689221301
+d3982:     .word 48689768
+d3983:     .word 555641882
+d3984:     .word 1062593996
+d3985:     .word 1569546110
+d3986:     .word 2076498224
+d3987:     .word 435966691
+d3988:     .word 942918805
+d3989:     .word 1449870919
+d3990:     .word 1956823033
+d3991:     .word 316291500
+d3992:     .word 823243614
+d3993:     .word 1330195728
+d3994:     .word 1837147842
+d3995:     .word 196616309
+d3996:     .word 703568423
+d3997:     .word 1210520537
+d3998:     .word 1717472651
+d3999:     .word 76941118
+d4000:     .word 583893232
+d4001:     .word 1090845346
+d4002:     .word 1597797460
+d4003:     .word 2104749574
+d4004:     .word 464218041
+d4005:     .word 971170155
+d4006:     .word 1478122269
+d4007:     .word 1985074383
+d4008:     .word 344542850
+d4009:     .word 851494964
+d4010:     .word 1358447078
+d4011:     .word 1865399192
+d4012:     .word 224867659
+d4013:     .word 731819773
+d4014:     .word 1238771887
+d4015:     .word 1745724001
+d4016:     .word 105192468
+d4017:     .word 612144582
+d4018:     .word 1119096696
+d4019:     .word 1626048810
+d4020:     .word 2133000924
+d4021:     .word 492469391
+d4022:     .word 999421505
+d4023:     .word 1506373619
+d4024:     .word 2013325733
+d4025:     .word 372794200
+d4026:     .word 879746314
+d4027:     .word 1386698428
+d4028:     .word 1893650542
+d4029:     .word 253119009
+d4030:     .word 760071123
+d4031:     .word 1267023237
+d4032:     .word 1773975351
+d4033:     .word 133443818
+d4034:     .word 640395932
+d4035:     .word 1147348046
+d4036:     .word 1654300160
+d4037:     .word 13768627
+d4038:     .word 520720741
+d4039:     .word 1027672855
+d4040:     .word 1534624969
+d4041:     .word 2041577083
+d4042:     .word 401045550
+d4043:     .word 907997664
+d4044:     .word 1414949778
+d4045:     .word 1921901892
+d4046:     .word 281370359
+d4047:     .word 788322473
+d4048:     .word 1295274587
+d4049:     .word 1802226701
+d4050:     .word 161695168
+d4051:     .word 668647282
+d4052:     .word 1175599396
+d4053:     .word 1682551510
+d4054:     .word 42019977
+d4055:     .word 548972091
+d4056:     .word 1055924205
+d4057:     .word 1562876319
+d4058:     .word 2069828433
+d4059:     .word 429296900
+d4060:     .word 936249014
+d4061:     .word 1443201128
+d4062:     .word 1950153242
+d4063:     .word 309621709
+d4064:     .word 816573823
+d4065:     .word 1323525937
+d4066:     .word 1830478051
+d4067:     .word 189946518
+d4068:     .word 696898632
+d4069:     .word 1203850746
+d4070:     .word 1710802860
+d4071:     .word 70271327
+d4072:     .word 577223441
+d4073:     .word 1084175555
+d4074:     .word 1591127669
+d4075:     .word 2098079783
+d4076:     .word 457548250
+d4077:     .word 964500364
+d4078:     .word 1471452478
+d4079:     .word 1978404592
+d4080:     .word 337873059
+d4081:     .word 844825173
+d4082:     .word 1351777287
+d4083:     .word 1858729401
+d4084:     .word 218197868
+d4085:     .word 725149982
+d4086:     .word 1232102096
+d4087:     .word 1739054210
+d4088:     .word 98522677
+d4089:     .word 605474791
+d4090:     .word 1112426905
+d4091:     .word 1619379019
+d4092:     .word 2126331133
+d4093:     .word 485799600
+d4094:     .word 992751714
+d4095:     .word 1499703828
+        .text
+l0:     beq $t0, $s0, l0
+l1:     j l3823
+l2:     lui $a2, %hi(d3550)
+l3:     ori $a3, $a3, %lo(d3277)
+l4:     beq $t4, $s4, l3004
+l5:     j l2731
+l6:     lui $a2, %hi(d2458)
+l7:     ori $a3, $a3, %lo(d2185)
+l8:     beq $t8, $s0, l1912
+l9:     j l1639
+l10:     lui $a2, %hi(d1366)
+l11:     ori $a3, $a3, %lo(d1093)
+l12:     beq $t2, $s4, l820
+l13:     j l547
+l14:     lui $a2, %hi(d274)
+l15:     ori $a3, $a3, %lo(d1)
+l16:     beq $t6, $s0, l3824
+l17:     j l3551
+l18:     lui $a2, %hi(d3278)
+l19:     ori $a3, $a3, %lo(d3005)
+l20:     beq $t0, $s4, l2732
+l21:     j l2459
+l22:     lui $a2, %hi(d2186)
+l23:     ori $a3, $a3, %lo(d1913)
+l24:     beq $t4, $s0, l1640
+l25:     j l1367
+l26:     lui $a2, %hi(d1094)
+l27:     ori $a3, $a3, %lo(d821)
+l28:     beq $t8, $s4, l548
+l29:     j l275
+l30:     lui $a2, %hi(d2)
+l31:     ori $a3, $a3, %lo(d3825)
+l32:     beq $t2, $s0, l3552
+l33:     j l3279
+l34:     lui $a2, %hi(d3006)
+l35:     ori $a3, $a3, %lo(d2733)
+l36:     beq $t6, $s4, l2460
+l37:     j l2187
+l38:     lui $a2, %hi(d1914)
+l39:     ori $a3, $a3, %lo(d1641)
+l40:     beq $t0, $s0, l1368
+l41:     j l1095
+l42:     lui $a2, %hi(d822)
+l43:     ori $a3, $a3, %lo(d549)
+l44:     beq $t4, $s4, l276
+l45:     j l3
+l46:     lui $a2, %hi(d3826)
+l47:     ori $a3, $a3, %lo(d3553)
+l48:     beq $t8, $s0, l3280
+l49:     j l3007
+l50:     lui $a2, %hi(d2734)
+l51:     ori $a3, $a3, %lo(d2461)
+l52:     beq $t2, $s4, l2188
+l53:     j l1915
+l54:     lui $a2, %hi(d1642)
+l55:     ori $a3, $a3, %lo(d1369)
+l56:     beq $t6, $s0, l1096
+l57:     j l823
+l58:     lui $a2, %hi(d550)
+l59:     ori $a3, $a3, %lo(d277)
+l60:     beq $t0, $s4, l4
+l61:     j l3827
+l62:     lui $a2, %hi(d3554)
+l63:     ori $a3, $a3, %lo(d3281)
+l64:     beq $t4, $s0, l3008
+l65:     j l2735
+l66:     lui $a2, %hi(d2462)
+l67:     ori $a3, $a3, %lo(d2189)
+l68:     beq $t8, $s4, l1916
+l69:     j l1643
+l70:     lui $a2, %hi(d1370)
+l71:     ori $a3, $a3, %lo(d1097)
+l72:     beq $t2, $s0, l824
+l73:     j l551
+l74:     lui $a2, %hi(d278)
+l75:     ori $a3, $a3, %lo(d5)
+l76:     beq $t6, $s4, l3828
+l77:     j l3555
+l78:     lui $a2, %hi(d3282)
+l79:     ori $a3, $a3, %lo(d3009)
+l80:     beq $t0, $s0, l2736
+l81:     j l2463
+l82:     lui $a2, %hi(d2190)
+l83:     ori $a3, $a3, %lo(d1917)
+l84:     beq $t4, $s4, l1644
+l85:     j l1371
+l86:     lui $a2, %hi(d1098)
+l87:     ori $a3, $a3, %lo(d825)
+l88:     beq $t8, $s0, l552
+l89:     j l279
+l90:     lui $a2, %hi(d6)
+l91:     ori $a3, $a3, %lo(d3829)
+l92:     beq $t2, $s4, l3556
+l93:     j l3283
+l94:     lui $a2, %hi(d3010)
+l95:     ori $a3, $a3, %lo(d2737)
+l96:     beq $t6, $s0, l2464
+l97:     j l2191
+l98:     lui $a2, %hi(d1918)
+l99:     ori $a3, $a3, %lo(d1645)
+l100:     beq $t0, $s4, l1372
+l101:     j l1099
+l102:     lui $a2, %hi(d826)
+l103:     ori $a3, $a3, %lo(d553)
+l104:     beq $t4, $s0, l280
+l105:     j l7
+l106:     lui $a2, %hi(d3830)
+l107:     ori $a3, $a3, %lo(d3557)
+l108:     beq $t8, $s4, l3284
+l109:     j l3011
+l110:     lui $a2, %hi(d2738)
+l111:     ori $a3, $a3, %lo(d2465)
+l112:     beq $t2, $s0, l2192
+l113:     j l1919
+l114:     lui $a2, %hi(d1646)
+l115:     ori $a3, $a3, %lo(d1373)
+l116:     beq $t6, $s4, l1100
+l117:     j l827
+l118:     lui $a2, %hi(d554)
+l119:     ori $a3, $a3, %lo(d281)
+l120:     beq $t0, $s0, l8
+l121:     j l3831
+l122:     lui $a2, %hi(d3558)
+l123:     ori $a3, $a3, %lo(d3285)
+l124:     beq $t4, $s4, l3012
+l125:     j l2739
+l126:     lui $a2, %hi(d2466)
+l127:     ori $a3, $a3, %lo(d2193)
+l128:     beq $t8, $s0, l1920
+l129:     j l1647
+l130:     lui $a2, %hi(d1374)
+l131:     ori $a3, $a3, %lo(d1101)
+l132:     beq $t2, $s4, l828
+l133:     j l555
+l134:     lui $a2, %hi(d282)
+l135:     ori $a3, $a3, %lo(d9)
+l136:     beq $t6, $s0, l3832
+l137:     j l3559
+l138:     lui $a2, %hi(d3286)
+l139:     ori $a3, $a3, %lo(d3013)
+l140:     beq $t0, $s4, l2740
+l141:     j l2467
+l142:     lui $a2, %hi(d2194)
+l143:     ori $a3, $a3, %lo(d1921)
+l144:     beq $t4, $s0, l1648
+l145:     j l1375
+l146:     lui $a2, %hi(d1102)
+l147:     ori $a3, $a3, %lo(d829)
+l148:     beq $t8, $s4, l556
+l149:     j l283
+l150:     lui $a2, %hi(d10)
+l151:     ori $a3, $a3, %lo(d3833)
+l152:     beq $t2, $s0, l3560
+l153:     j l3287
+l154:     lui $a2, %hi(d3014)
+l155:     ori $a3, $a3, %lo(d2741)
+l156:     beq $t6, $s4, l2468
+l157:     j l2195
+l158:     lui $a2, %hi(d1922)
+l159:     ori $a3, $a3, %lo(d1649)
+l160:     beq $t0, $s0, l1376
+l161:     j l1103
+l162:     lui $a2, %hi(d830)
+l163:     ori $a3, $a3, %lo(d557)
+l164:     beq $t4, $s4, l284
+l165:     j l11
+l166:     lui $a2, %hi(d3834)
+l167:     ori $a3, $a3, %lo(d3561)
+l168:     beq $t8, $s0, l3288
+l169:     j l3015
+l170:     lui $a2, %hi(d2742)
+l171:     ori $a3, $a3, %lo(d2469)
+l172:     beq $t2, $s4, l2196
+l173:     j l1923
+l174:     lui $a2, %hi(d1650)
+l175:     ori $a3, $a3, %lo(d1377)
+l176:     beq $t6, $s0, l1104
+l177:     j l831
+l178:     lui $a2, %hi(d558)
+l179:     ori $a3, $a3, %lo(d285)
+l180:     beq $t0, $s4, l12
+l181:     j l3835
+l182:     lui $a2, %hi(d3562)
+l183:     ori $a3, $a3, %lo(d3289)
+l184:     beq $t4, $s0, l3016
+l185:     j l2743
+l186:     lui $a2, %hi(d2470)
+l187:     ori $a3, $a3, %lo(d2197)
+l188:     beq $t8, $s4, l1924
+l189:     j l1651
+l190:     lui $a2, %hi(d1378)
+l191:     ori $a3, $a3, %lo(d1105)
+l192:     beq $t2, $s0, l832
+l193:     j l559
+l194:     lui $a2, %hi(d286)
+l195:     ori $a3, $a3, %lo(d13)
+l196:     beq $t6, $s4, l3836
+l197:     j l3563
+l198:     lui $a2, %hi(d3290)
+l199:     ori $a3, $a3, %lo(d3017)
+l200:     beq $t0, $s0, l2744
+l201:     j l2471
+l202:     lui $a2, %hi(d2198)
+l203:     ori $a3, $a3, %lo(d1925)
+l204:     beq $t4, $s4, l1652
+l205:     j l1379
+l206:     lui $a2, %hi(d1106)
+l207:     ori $a3, $a3, %lo(d833)
+l208:     beq $t8, $s0, l560
+l209:     j l287
+l210:     lui $a2, %hi(d14)
+l211:     ori $a3, $a3, %lo(d3837)
+l212:     beq $t2, $s4, l3564
+l213:     j l3291
+l214:     lui $a2, %hi(d3018)
+l215:     ori $a3, $a3, %lo(d2745)
+l216:     beq $t6, $s0, l2472
+l217:     j l2199
+l218:     lui $a2, %hi(d1926)
+l219:     ori $a3, $a3, %lo(d1653)
+l220:     beq $t0, $s4, l1380
+l221:     j l1107
+l222:     lui $a2, %hi(d834)
+l223:     ori $a3, $a3, %lo(d561)
+l224:     beq $t4, $s0, l288
+l225:     j l15
+l226:     lui $a2, %hi(d3838)
+l227:     ori $a3, $a3, %lo(d3565)
+l228:     beq $t8, $s4, l3292
+l229:     j l3019
+l230:     lui $a2, %hi(d2746)
+l231:     ori $a3, $a3, %lo(d2473)
+l232:     beq $t2, $s0, l2200
+l233:     j l1927
+l234:     lui $a2, %hi(d1654)
+l235:     ori $a3, $a3, %lo(d1381)
+l236:     beq $t6, $s4, l1108
+l237:     j l835
+l238:     lui $a2, %hi(d562)
+l239:     ori $a3, $a3, %lo(d289)
+l240:     beq $t0, $s0, l16
+l241:     j l3839
+l242:     lui $a2, %hi(d3566)
+l243:     ori $a3, $a3, %lo(d3293)
+l244:     beq $t4, $s4, l3020
+l245:     j l2747
+l246:     lui $a2, %hi(d2474)
+l247:     ori $a3, $a3, %lo(d2201)
+l248:     beq $t8, $s0, l1928
+l249:     j l1655
+l250:     lui $a2, %hi(d1382)
+l251:     ori $a3, $a3, %lo(d1109)
+l252:     beq $t2, $s4, l836
+l253:     j l563
+l254:     lui $a2, %hi(d290)
+l255:     ori $a3, $a3, %lo(d17)
+l256:     beq $t6, $s0, l3840
+l257:     j l3567
+l258:     lui $a2, %hi(d3294)
+l259:     ori $a3, $a3, %lo(d3021)
+l260:     beq $t0, $s4, l2748
+l261:     j l2475
+l262:     lui $a2, %hi(d2202)
+l263:     ori $a3, $a3, %lo(d1929)
+l264:     beq $t4, $s0, l1656
+l265:     j l1383
+l266:     lui $a2, %hi(d1110)
+l267:     ori $a3, $a3, %lo(d837)
+l268:     beq $t8, $s4, l564
+l269:     j l291
+l270:     lui $a2, %hi(d18)
+l271:     ori $a3, $a3, %lo(d3841)
+l272:     beq $t2, $s0, l3568
+l273:     j l3295
+l274:     lui $a2, %hi(d3022)
+l275:     ori $a3, $a3, %lo(d2749)
+l276:     beq $t6, $s4, l2476
+l277:     j l2203
+l278:     lui $a2, %hi(d1930)
+l279:     ori $a3, $a3, %lo(d1657)
+l280:     beq $t0, $s0, l1384
+l281:     j l1111
+l282:     lui $a2, %hi(d838)
+l283:     ori $a3, $a3, %lo(d565)
+l284:     beq $t4, $s4, l292
+l285:     j l19
+l286:     lui $a2, %hi(d3842)
+l287:     ori $a3, $a3, %lo(d3569)
+l288:     beq $t8, $s0, l3296
+l289:     j l3023
+l290:     lui $a2, %hi(d2750)
+l291:     ori $a3, $a3, %lo(d2477)
+l292:     beq $t2, $s4, l2204
+l293:     j l1931
+l294:     lui $a2, %hi(d1658)
+l295:     ori $a3, $a3, %lo(d1385)
+l296:     beq $t6, $s0, l1112
+l297:     j l839
+l298:     lui $a2, %hi(d566)
+l299:     ori $a3, $a3, %lo(d293)
+l300:     beq $t0, $s4, l20
+l301:     j l3843
+l302:     lui $a2, %hi(d3570)
+l303:     ori $a3, $a3, %lo(d3297)
+l304:     beq $t4, $s0, l3024
+l305:     j l2751
+l306:     lui $a2, %hi(d2478)
+l307:     ori $a3, $a3, %lo(d2205)
+l308:     beq $t8, $s4, l1932
+l309:     j l1659
+l310:     lui $a2, %hi(d1386)
+l311:     ori $a3, $a3, %lo(d1113)
+l312:     beq $t2, $s0, l840
+l313:     j l567
+l314:     lui $a2, %hi(d294)
+l315:     ori $a3, $a3, %lo(d21)
+l316:     beq $t6, $s4, l3844
+l317:     j l3571
+l318:     lui $a2, %hi(d3298)
+l319:     ori $a3, $a3, %lo(d3025)
+l320:     beq $t0, $s0, l2752
+l321:     j l2479
+l322:     lui $a2, %hi(d2206)
+l323:     ori $a3, $a3, %lo(d1933)
+l324:     beq $t4, $s4, l1660
+l325:     j l1387
+l326:     lui $a2, %hi(d1114)
+l327:     ori $a3, $a3, %lo(d841)
+l328:     beq $t8, $s0, l568
+l329:     j l295
+l330:     lui $a2, %hi(d22)
+l331:     ori $a3, $a3, %lo(d3845)
+l332:     beq $t2, $s4, l3572
+l333:     j l3299
+l334:     lui $a2, %hi(d3026)
+l335:     ori $a3, $a3, %lo(d2753)
+l336:     beq $t6, $s0, l2480
+l337:     j l2207
+l338:     lui $a2, %hi(d1934)
+l339:     ori $a3, $a3, %lo(d1661)
+l340:     beq $t0, $s4, l1388
+l341:     j l1115
+l342:     lui $a2, %hi(d842)
+l343:     ori $a3, $a3, %lo(d569)
+l344:     beq $t4, $s0, l296
+l345:     j l23
+l346:     lui $a2, %hi(d3846)
+l347:     ori $a3, $a3, %lo(d3573)
+l348:     beq $t8, $s4, l3300
+l349:     j l3027
+l350:     lui $a2, %hi(d2754)
+l351:     ori $a3, $a3, %lo(d2481)
+l352:     beq $t2, $s0, l2208
+l353:     j l1935
+l354:     lui $a2, %hi(d1662)
+l355:     ori $a3, $a3, %lo(d1389)
+l356:     beq $t6, $s4, l1116
+l357:     j l843
+l358:     lui $a2, %hi(d570)
+l359:     ori $a3, $a3, %lo(d297)
+l360:     beq $t0, $s0, l24
+l361:     j l3847
+l362:     lui $a2, %hi(d3574)
+l363:     ori $a3, $a3, %lo(d3301)
+l364:     beq $t4, $s4, l3028
+l365:     j l2755
+l366:     lui $a2, %hi(d2482)
+l367:     ori $a3, $a3, %lo(d2209)
+l368:     beq $t8, $s0, l1936
+l369:     j l1663
+l370:     lui $a2, %hi(d1390)
+l371:     ori $a3, $a3, %lo(d1117)
+l372:     beq $t2, $s4, l844
+l373:     j l571
+l374:     lui $a2, %hi(d298)
+l375:     ori $a3, $a3, %lo(d25)
+l376:     beq $t6, $s0, l3848
+l377:     j l3575
+l378:     lui $a2, %hi(d3302)
+l379:     ori $a3, $a3, %lo(d3029)
+l380:     beq $t0, $s4, l2756
+l381:     j l2483
+l382:     lui $a2, %hi(d2210)
+l383:     ori $a3, $a3, %lo(d1937)
+l384:     beq $t4, $s0, l1664
+l385:     j l1391
+l386:     lui $a2, %hi(d1118)
+l387:     ori $a3, $a3, %lo(d845)
+l388:     beq $t8, $s4, l572
+l389:     j l299
+l390:     lui $a2, %hi(d26)
+l391:     ori $a3, $a3, %lo(d3849)
+l392:     beq $t2, $s0, l3576
+l393:     j l3303
+l394:     lui $a2, %hi(d3030)
+l395:     ori $a3, $a3, %lo(d2757)
+l396:     beq $t6, $s4, l2484
+l397:     j l2211
+l398:     lui $a2, %hi(d1938)
+l399:     ori $a3, $a3, %lo(d1665)
+l400:     beq $t0, $s0, l1392
+l401:     j l1119
+l402:     lui $a2, %hi(d846)
+l403:     ori $a3, $a3, %lo(d573)
+l404:     beq $t4, $s4, l300
+l405:     j l27
+l406:     lui $a2, %hi(d3850)
+l407:     ori $a3, $a3, %lo(d3577)
+l408:     beq $t8, $s0, l3304
+l409:     j l3031
+l410:     lui $a2, %hi(d2758)
+l411:     ori $a3, $a3, %lo(d2485)
+l412:     beq $t2, $s4, l2212
+l413:     j l1939
+l414:     lui $a2, %hi(d1666)
+l415:     ori $a3, $a3, %lo(d1393)
+l416:     beq $t6, $s0, l1120
+l417:     j l847
+l418:     lui $a2, %hi(d574)
+l419:     ori $a3, $a3, %lo(d301)
+l420:     beq $t0, $s4, l28
+l421:     j l3851
+l422:     lui $a2, %hi(d3578)
+l423:     ori $a3, $a3, %lo(d3305)
+l424:     beq $t4, $s0, l3032
+l425:     j l2759
+l426:     lui $a2, %hi(d2486)
+l427:     ori $a3, $a3, %lo(d2213)
+l428:     beq $t8, $s4, l1940
+l429:     j l1667
+l430:     lui $a2, %hi(d1394)
+l431:     ori $a3, $a3, %lo(d1121)
+l432:     beq $t2, $s0, l848
+l433:     j l575
+l434:     lui $a2, %hi(d302)
+l435:     ori $a3, $a3, %lo(d29)
+l436:     beq $t6, $s4, l3852
+l437:     j l3579
+l438:     lui $a2, %hi(d3306)
+l439:     ori $a3, $a3, %lo(d3033)
+l440:     beq $t0, $s0, l2760
+l441:     j l2487
+l442:     lui $a2, %hi(d2214)
+l443:     ori $a3, $a3, %lo(d1941)
+l444:     beq $t4, $s4, l1668
+l445:     j l1395
+l446:     lui $a2, %hi(d1122)
+l447:     ori $a3, $a3, %lo(d849)
+l448:     beq $t8, $s0, l576
+l449:     j l303
+l450:     lui $a2, %hi(d30)
+l451:     ori $a3, $a3, %lo(d3853)
+l452:     beq $t2, $s4, l3580
+l453:     j l3307
+l454:     lui $a2, %hi(d3034)
+l455:     ori $a3, $a3, %lo(d2761)
+l456:     beq $t6, $s0, l2488
+l457:     j l2215
+l458:     lui $a2, %hi(d1942)
+l459:     ori $a3, $a3, %lo(d1669)
+l460:     beq $t0, $s4, l1396
+l461:     j l1123
+l462:     lui $a2, %hi(d850)
+l463:     ori $a3, $a3, %lo(d577)
+l464:     beq $t4, $s0, l304
+l465:     j l31
+l466:     lui $a2, %hi(d3854)
+l467:     ori $a3, $a3, %lo(d3581)
+l468:     beq $t8, $s4, l3308
+l469:     j l3035
+l470:     lui $a2, %hi(d2762)
+l471:     ori $a3, $a3, %lo(d2489)
+l472:     beq $t2, $s0, l2216
+l473:     j l1943
+l474:     lui $a2, %hi(d1670)
+l475:     ori $a3, $a3, %lo(d1397)
+l476:     beq $t6, $s4, l1124
+l477:     j l851
+l478:     lui $a2, %hi(d578)
+l479:     ori $a3, $a3, %lo(d305)
+l480:     beq $t0, $s0, l32
+l481:     j l3855
+l482:     lui $a2, %hi(d3582)
+l483:     ori $a3, $a3, %lo(d3309)
+l484:     beq $t4, $s4, l3036
+l485:     j l2763
+l486:     lui $a2, %hi(d2490)
+l487:     ori $a3, $a3, %lo(d2217)
+l488:     beq $t8, $s0, l1944
+l489:     j l1671
+l490:     lui $a2, %hi(d1398)
+l491:     ori $a3, $a3, %lo(d1125)
+l492:     beq $t2, $s4, l852
+l493:     j l579
+l494:     lui $a2, %hi(d306)
+l495:     ori $a3, $a3, %lo(d33)
+l496:     beq $t6, $s0, l3856
+l497:     j l3583
+l498:     lui $a2, %hi(d3310)
+l499:     ori $a3, $a3, %lo(d3037)
+l500:     beq $t0, $s4, l2764
+l501:     j l2491
+l502:     lui $a2, %hi(d2218)
+l503:     ori $a3, $a3, %lo(d1945)
+l504:     beq $t4, $s0, l1672
+l505:     j l1399
+l506:     lui $a2, %hi(d1126)
+l507:     ori $a3, $a3, %lo(d853)
+l508:     beq $t8, $s4, l580
+l509:     j l307
+l510:     lui $a2, %hi(d34)
+l511:     ori $a3, $a3, %lo(d3857)
+l512:     beq $t2, $s0, l3584
+l513:     j l3311
+l514:     lui $a2, %hi(d3038)
+l515:     ori $a3, $a3, %lo(d2765)
+l516:     beq $t6, $s4, l2492
+l517:     j l2219
+l518:     lui $a2, %hi(d1946)
+l519:     ori $a3, $a3, %lo(d1673)
+l520:     beq $t0, $s0, l1400
+l521:     j l1127
+l522:     lui $a2, %hi(d854)
+l523:     ori $a3, $a3, %lo(d581)
+l524:     beq $t4, $s4, l308
+l525:     j l35
+l526:     lui $a2, %hi(d3858)
+l527:     ori $a3, $a3, %lo(d3585)
+l528:     beq $t8, $s0, l3312
+l529:     j l3039
+l530:     lui $a2, %hi(d2766)
+l531:     ori $a3, $a3, %lo(d2493)
+l532:     beq $t2, $s4, l2220
+l533:     j l1947
+l534:     lui $a2, %hi(d1674)
+l535:     ori $a3, $a3, %lo(d1401)
+l536:     beq $t6, $s0, l1128
+l537:     j l855
+l538:     lui $a2, %hi(d582)
+l539:     ori $a3, $a3, %lo(d309)
+l540:     beq $t0, $s4, l36
+l541:     j l3859
+l542:     lui $a2, %hi(d3586)
+l543:     ori $a3, $a3, %lo(d3313)
+l544:     beq $t4, $s0, l3040
+l545:     j l2767
+l546:     lui $a2, %hi(d2494)
+l547:     ori $a3, $a3, %lo(d2221)
+l548:     beq $t8, $s4, l1948
+l549:     j l1675
+l550:     lui $a2, %hi(d1402)
+l551:     ori $a3, $a3, %lo(d1129)
+l552:     beq $t2, $s0, l856
+l553:     j l583
+l554:     lui $a2, %hi(d310)
+l555:     ori $a3, $a3, %lo(d37)
+l556:     beq $t6, $s4, l3860
+l557:     j l3587
+l558:     lui $a2, %hi(d3314)
+l559:     ori $a3, $a3, %lo(d3041)
+l560:     beq $t0, $s0, l2768
+l561:     j l2495
+l562:     lui $a2, %hi(d2222)
+l563:     ori $a3, $a3, %lo(d1949)
+l564:     beq $t4, $s4, l1676
+l565:     j l1403
+l566:     lui $a2, %hi(d1130)
+l567:     ori $a3, $a3, %lo(d857)
+l568:     beq $t8, $s0, l584
+l569:     j l311
+l570:     lui $a2, %hi(d38)
+l571:     ori $a3, $a3, %lo(d3861)
+l572:     beq $t2, $s4, l3588
+l573:     j l3315
+l574:     lui $a2, %hi(d3042)
+l575:     ori $a3, $a3, %lo(d2769)
+l576:     beq $t6, $s0, l2496
+l577:     j l2223
+l578:     lui $a2, %hi(d1950)
+l579:     ori $a3, $a3, %lo(d1677)
+l580:     beq $t0, $s4, l1404
+l581:     j l1131
+l582:     lui $a2, %hi(d858)
+l583:     ori $a3, $a3, %lo(d585)
+l584:     beq $t4, $s0, l312
+l585:     j l39
+l586:     lui $a2, %hi(d3862)
+l587:     ori $a3, $a3, %lo(d3589)
+l588:     beq $t8, $s4, l3316
+l589:     j l3043
+l590:     lui $a2, %hi(d2770)
+l591:     ori $a3, $a3, %lo(d2497)
+l592:     beq $t2, $s0, l2224
+l593:     j l1951
+l594:     lui $a2, %hi(d1678)
+l595:     ori $a3, $a3, %lo(d1405)
+l596:     beq $t6, $s4, l1132
+l597:     j l859
+l598:     lui $a2, %hi(d586)
+l599:     ori $a3, $a3, %lo(d313)
+l600:     beq $t0, $s0, l40
+l601:     j l3863
+l602:     lui $a2, %hi(d3590)
+l603:     ori $a3, $a3, %lo(d3317)
+l604:     beq $t4, $s4, l3044
+l605:     j l2771
+l606:     lui $a2, %hi(d2498)
+l607:     ori $a3, $a3, %lo(d2225)
+l608:     beq $t8, $s0, l1952
+l609:     j l1679
+l610:     lui $a2, %hi(d1406)
+l611:     ori $a3, $a3, %lo(d1133)
+l612:     beq $t2, $s4, l860
+l613:     j l587
+l614:     lui $a2, %hi(d314)
+l615:     ori $a3, $a3, %lo(d41)
+l616:     beq $t6, $s0, l3864
+l617:     j l3591
+l618:     lui $a2, %hi(d3318)
+l619:     ori $a3, $a3, %lo(d3045)
+l620:     beq $t0, $s4, l2772
+l621:     j l2499
+l622:     lui $a2, %hi(d2226)
+l623:     ori $a3, $a3, %lo(d1953)
+l624:     beq $t4, $s0, l1680
+l625:     j l1407
+l626:     lui $a2, %hi(d1134)
+l627:     ori $a3, $a3, %lo(d861)
+l628:     beq $t8, $s4, l588
+l629:     j l315
+l630:     lui $a2, %hi(d42)
+l631:     ori $a3, $a3, %lo(d3865)
+l632:     beq $t2, $s0, l3592
+l633:     j l3319
+l634:     lui $a2, %hi(d3046)
+l635:     ori $a3, $a3, %lo(d2773)
+l636:     beq $t6, $s4, l2500
+l637:     j l2227
+l638:     lui $a2, %hi(d1954)
+l639:     ori $a3, $a3, %lo(d1681)
+l640:     beq $t0, $s0, l1408
+l641:     j l1135
+l642:     lui $a2, %hi(d862)
+l643:     ori $a3, $a3, %lo(d589)
+l644:     beq $t4, $s4, l316
+l645:     j l43
+l646:     lui $a2, %hi(d3866)
+l647:     ori $a3, $a3, %lo(d3593)
+l648:     beq $t8, $s0, l3320
+l649:     j l3047
+l650:     lui $a2, %hi(d2774)
+l651:     ori $a3, $a3, %lo(d2501)
+l652:     beq $t2, $s4, l2228
+l653:     j l1955
+l654:     lui $a2, %hi(d1682)
+l655:     ori $a3, $a3, %lo(d1409)
+l656:     beq $t6, $s0, l1136
+l657:     j l863
+l658:     lui $a2, %hi(d590)
+l659:     ori $a3, $a3, %lo(d317)
+l660:     beq $t0, $s4, l44
+l661:     j l3867
+l662:     lui $a2, %hi(d3594)
+l663:     ori $a3, $a3, %lo(d3321)
+l664:     beq $t4, $s0, l3048
+l665:     j l2775
+l666:     lui $a2, %hi(d2502)
+l667:     ori $a3, $a3, %lo(d2229)
+l668:     beq $t8, $s4, l1956
+l669:     j l1683
+l670:     lui $a2, %hi(d1410)
+l671:     ori $a3, $a3, %lo(d1137)
+l672:     beq $t2, $s0, l864
+l673:     j l591
+l674:     lui $a2, %hi(d318)
+l675:     ori $a3, $a3, %lo(d45)
+l676:     beq $t6, $s4, l3868
+l677:     j l3595
+l678:     lui $a2, %hi(d3322)
+l679:     ori $a3, $a3, %lo(d3049)
+l680:     beq $t0, $s0, l2776
+l681:     j l2503
+l682:     lui $a2, %hi(d2230)
+l683:     ori $a3, $a3, %lo(d1957)
+l684:     beq $t4, $s4, l1684
+l685:     j l1411
+l686:     lui $a2, %hi(d1138)
+l687:     ori $a3, $a3, %lo(d865)
+l688:     beq $t8, $s0, l592
+l689:     j l319
+l690:     lui $a2, %hi(d46)
+l691:     ori $a3, $a3, %lo(d3869)
+l692:     beq $t2, $s4, l3596
+l693:     j l3323
+l694:     lui $a2, %hi(d3050)
+l695:     ori $a3, $a3, %lo(d2777)
+l696:     beq $t6, $s0, l2504
+l697:     j l2231
+l698:     lui $a2, %hi(d1958)
+l699:     ori $a3, $a3, %lo(d1685)
+l700:     beq $t0, $s4, l1412
+l701:     j l1139
+l702:     lui $a2, %hi(d866)
+l703:     ori $a3, $a3, %lo(d593)
+l704:     beq $t4, $s0, l320
+l705:     j l47
+l706:     lui $a2, %hi(d3870)
+l707:     ori $a3, $a3, %lo(d3597)
+l708:     beq $t8, $s4, l3324
+l709:     j l3051
+l710:     lui $a2, %hi(d2778)
+l711:     ori $a3, $a3, %lo(d2505)
+l712:     beq $t2, $s0, l2232
+l713:     j l1959
+l714:     lui $a2, %hi(d1686)
+l715:     ori $a3, $a3, %lo(d1413)
+l716:     beq $t6, $s4, l1140
+l717:     j l867
+l718:     lui $a2, %hi(d594)
+l719:     ori $a3, $a3, %lo(d321)
+l720:     beq $t0, $s0, l48
+l721:     j l3871
+l722:     lui $a2, %hi(d3598)
+l723:     ori $a3, $a3, %lo(d3325)
+l724:     beq $t4, $s4, l3052
+l725:     j l2779
+l726:     lui $a2, %hi(d2506)
+l727:     ori $a3, $a3, %lo(d2233)
+l728:     beq $t8, $s0, l1960
+l729:     j l1687
+l730:     lui $a2, %hi(d1414)
+l731:     ori $a3, $a3, %lo(d1141)
+l732:     beq $t2, $s4, l868
+l733:     j l595
+l734:     lui $a2, %hi(d322)
+l735:     ori $a3, $a3, %lo(d49)
+l736:     beq $t6, $s0, l3872
+l737:     j l3599
+l738:     lui $a2, %hi(d3326)
+l739:     ori $a3, $a3, %lo(d3053)
+l740:     beq $t0, $s4, l2780
+l741:     j l2507
+l742:     lui $a2, %hi(d2234)
+l743:     ori $a3, $a3, %lo(d1961)
+l744:     beq $t4, $s0, l1688
+l745:     j l1415
+l746:     lui $a2, %hi(d1142)
+l747:     ori $a3, $a3, %lo(d869)
+l748:     beq $t8, $s4, l596
+l749:     j l323
+l750:     lui $a2, %hi(d50)
+l751:     ori $a3, $a3, %lo(d3873)
+l752:     beq $t2, $s0, l3600
+l753:     j l3327
+l754:     lui $a2, %hi(d3054)
+l755:     ori $a3, $a3, %lo(d2781)
+l756:     beq $t6, $s4, l2508
+l757:     j l2235
+l758:     lui $a2, %hi(d1962)
+l759:     ori $a3, $a3, %lo(d1689)
+l760:     beq $t0, $s0, l1416
+l761:     j l1143
+l762:     lui $a2, %hi(d870)
+l763:     ori $a3, $a3, %lo(d597)
+l764:     beq $t4, $s4, l324
+l765:     j l51
+l766:     lui $a2, %hi(d3874)
+l767:     ori $a3, $a3, %lo(d3601)
+l768:     beq $t8, $s0, l3328
+l769:     j l3055
+l770:     lui $a2, %hi(d2782)
+l771:     ori $a3, $a3, %lo(d2509)
+l772:     beq $t2, $s4, l2236
+l773:     j l1963
+l774:     lui $a2, %hi(d1690)
+l775:     ori $a3, $a3, %lo(d1417)
+l776:     beq $t6, $s0, l1144
+l777:     j l871
+l778:     lui $a2, %hi(d598)
+l779:     ori $a3, $a3, %lo(d325)
+l780:     beq $t0, $s4, l52
+l781:     j l3875
+l782:     lui $a2, %hi(d3602)
+l783:     ori $a3, $a3, %lo(d3329)
+l784:     beq $t4, $s0, l3056
+l785:     j l2783
+l786:     lui $a2, %hi(d2510)
+l787:     ori $a3, $a3, %lo(d2237)
+l788:     beq $t8, $s4, l1964
+l789:     j l1691
+l790:     lui $a2, %hi(d1418)
+l791:     ori $a3, $a3, %lo(d1145)
+l792:     beq $t2, $s0, l872
+l793:     j l599
+l794:     lui $a2, %hi(d326)
+l795:     ori $a3, $a3, %lo(d53)
+l796:     beq $t6, $s4, l3876
+l797:     j l3603
+l798:     lui $a2, %hi(d3330)
+l799:     ori $a3, $a3, %lo(d3057)
+l800:     beq $t0, $s0, l2784
+l801:     j l2511
+l802:     lui $a2, %hi(d2238)
+l803:     ori $a3, $a3, %lo(d1965)
+l804:     beq $t4, $s4, l1692
+l805:     j l1419
+l806:     lui $a2, %hi(d1146)
+l807:     ori $a3, $a3, %lo(d873)
+l808:     beq $t8, $s0, l600
+l809:     j l327
+l810:     lui $a2, %hi(d54)
+l811:     ori $a3, $a3, %lo(d3877)
+l812:     beq $t2, $s4, l3604
+l813:     j l3331
+l814:     lui $a2, %hi(d3058)
+l815:     ori $a3, $a3, %lo(d2785)
+l816:     beq $t6, $s0, l2512
+l817:     j l2239
+l818:     lui $a2, %hi(d1966)
+l819:     ori $a3, $a3, %lo(d1693)
+l820:     beq $t0, $s4, l1420
+l821:     j l1147
+l822:     lui $a2, %hi(d874)
+l823:     ori $a3, $a3, %lo(d601)
+l824:     beq $t4, $s0, l328
+l825:     j l55
+l826:     lui $a2, %hi(d3878)
+l827:     ori $a3, $a3, %lo(d3605)
+l828:     beq $t8, $s4, l3332
+l829:     j l3059
+l830:     lui $a2, %hi(d2786)
+l831:     ori $a3, $a3, %lo(d2513)
+l832:     beq $t2, $s0, l2240
+l833:     j l1967
+l834:     lui $a2, %hi(d1694)
+l835:     ori $a3, $a3, %lo(d1421)
+l836:     beq $t6, $s4, l1148
+l837:     j l875
+l838:     lui $a2, %hi(d602)
+l839:     ori $a3, $a3, %lo(d329)
+l840:     beq $t0, $s0, l56
+l841:     j l3879
+l842:     lui $a2, %hi(d3606)
+l843:     ori $a3, $a3, %lo(d3333)
+l844:     beq $t4, $s4, l3060
+l845:     j l2787
+l846:     lui $a2, %hi(d2514)
+l847:     ori $a3, $a3, %lo(d2241)
+l848:     beq $t8, $s0, l1968
+l849:     j l1695
+l850:     lui $a2, %hi(d1422)
+l851:     ori $a3, $a3, %lo(d1149)
+l852:     beq $t2, $s4, l876
+l853:     j l603
+l854:     lui $a2, %hi(d330)
+l855:     ori $a3, $a3, %lo(d57)
+l856:     beq $t6, $s0, l3880
+l857:     j l3607
+l858:     lui $a2, %hi(d3334)
+l859:     ori $a3, $a3, %lo(d3061)
+l860:     beq $t0, $s4, l2788
+l861:     j l2515
+l862:     lui $a2, %hi(d2242)
+l863:     ori $a3, $a3, %lo(d1969)
+l864:     beq $t4, $s0, l1696
+l865:     j l1423
+l866:     lui $a2, %hi(d1150)
+l867:     ori $a3, $a3, %lo(d877)
+l868:     beq $t8, $s4, l604
+l869:     j l331
+l870:     lui $a2, %hi(d58)
+l871:     ori $a3, $a3, %lo(d3881)
+l872:     beq $t2, $s0, l3608
+l873:     j l3335
+l874:     lui $a2, %hi(d3062)
+l875:     ori $a3, $a3, %lo(d2789)
+l876:     beq $t6, $s4, l2516
+l877:     j l2243
+l878:     lui $a2, %hi(d1970)
+l879:     ori $a3, $a3, %lo(d1697)
+l880:     beq $t0, $s0, l1424
+l881:     j l1151
+l882:     lui $a2, %hi(d878)
+l883:     ori $a3, $a3, %lo(d605)
+l884:     beq $t4, $s4, l332
+l885:     j l59
+l886:     lui $a2, %hi(d3882)
+l887:     ori $a3, $a3, %lo(d3609)
+l888:     beq $t8, $s0, l3336
+l889:     j l3063
+l890:     lui $a2, %hi(d2790)
+l891:     ori $a3, $a3, %lo(d2517)
+l892:     beq $t2, $s4, l2244
+l893:     j l1971
+l894:     lui $a2, %hi(d1698)
+l895:     ori $a3, $a3, %lo(d1425)
+l896:     beq $t6, $s0, l1152
+l897:     j l879
+l898:     lui $a2, %hi(d606)
+l899:     ori $a3, $a3, %lo(d333)
+l900:     beq $t0, $s4, l60
+l901:     j l3883
+l902:     lui $a2, %hi(d3610)
+l903:     ori $a3, $a3, %lo(d3337)
+l904:     beq $t4, $s0, l3064
+l905:     j l2791
+l906:     lui $a2, %hi(d2518)
+l907:     ori $a3, $a3, %lo(d2245)
+l908:     beq $t8, $s4, l1972
+l909:     j l1699
+l910:     lui $a2, %hi(d1426)
+l911:     ori $a3, $a3, %lo(d1153)
+l912:     beq $t2, $s0, l880
+l913:     j l607
+l914:     lui $a2, %hi(d334)
+l915:     ori $a3, $a3, %lo(d61)
+l916:     beq $t6, $s4, l3884
+l917:     j l3611
+l918:     lui $a2, %hi(d3338)
+l919:     ori $a3, $a3, %lo(d3065)
+l920:     beq $t0, $s0, l2792
+l921:     j l2519
+l922:     lui $a2, %hi(d2246)
+l923:     ori $a3, $a3, %lo(d1973)
+l924:     beq $t4, $s4, l1700
+l925:     j l1427
+l926:     lui $a2, %hi(d1154)
+l927:     ori $a3, $a3, %lo(d881)
+l928:     beq $t8, $s0, l608
+l929:     j l335
+l930:     lui $a2, %hi(d62)
+l931:     ori $a3, $a3, %lo(d3885)
+l932:     beq $t2, $s4, l3612
+l933:     j l3339
+l934:     lui $a2, %hi(d3066)
+l935:     ori $a3, $a3, %lo(d2793)
+l936:     beq $t6, $s0, l2520
+l937:     j l2247
+l938:     lui $a2, %hi(d1974)
+l939:     ori $a3, $a3, %lo(d1701)
+l940:     beq $t0, $s4, l1428
+l941:     j l1155
+l942:     lui $a2, %hi(d882)
+l943:     ori $a3, $a3, %lo(d609)
+l944:     beq $t4, $s0, l336
+l945:     j l63
+l946:     lui $a2, %hi(d3886)
+l947:     ori $a3, $a3, %lo(d3613)
+l948:     beq $t8, $s4, l3340
+l949:     j l3067
+l950:     lui $a2, %hi(d2794)
+l951:     ori $a3, $a3, %lo(d2521)
+l952:     beq $t2, $s0, l2248
+l953:     j l1975
+l954:     lui $a2, %hi(d1702)
+l955:     ori $a3, $a3, %lo(d1429)
+l956:     beq $t6, $s4, l1156
+l957:     j l883
+l958:     lui $a2, %hi(d610)
+l959:     ori $a3, $a3, %lo(d337)
+l960:     beq $t0, $s0, l64
+l961:     j l3887
+l962:     lui $a2, %hi(d3614)
+l963:     ori $a3, $a3, %lo(d3341)
+l964:     beq $t4, $s4, l3068
+l965:     j l2795
+l966:     lui $a2, %hi(d2522)
+l967:     ori $a3, $a3, %lo(d2249)
+l968:     beq $t8, $s0, l1976
+l969:     j l1703
+l970:     lui $a2, %hi(d1430)
+l971:     ori $a3, $a3, %lo(d1157)
+l972:     beq $t2, $s4, l884
+l973:     j l611
+l974:     lui $a2, %hi(d338)
+l975:     ori $a3, $a3, %lo(d65)
+l976:     beq $t6, $s0, l3888
+l977:     j l3615
+l978:     lui $a2, %hi(d3342)
+l979:     ori $a3, $a3, %lo(d3069)
+l980:     beq $t0, $s4, l2796
+l981:     j l2523
+l982:     lui $a2, %hi(d2250)
+l983:     ori $a3, $a3, %lo(d1977)
+l984:     beq $t4, $s0, l1704
+l985:     j l1431
+l986:     lui $a2, %hi(d1158)
+l987:     ori $a3, $a3, %lo(d885)
+l988:     beq $t8, $s4, l612
+l989:     j l339
+l990:     lui $a2, %hi(d66)
+l991:     ori $a3, $a3, %lo(d3889)
+l992:     beq $t2, $s0, l3616
+l993:     j l3343
+l994:     lui $a2, %hi(d3070)
+l995:     ori $a3, $a3, %lo(d2797)
+l996:     beq $t6, $s4, l2524
+l997:     j l2251
+l998:     lui $a2, %hi(d1978)
+l999:     ori $a3, $a3, %lo(d1705)
+l1000:     beq $t0, $s0, l1432
+l1001:     j l1159
+l1002:     lui $a2, %hi(d886)
+l1003:     ori $a3, $a3, %lo(d613)
+l1004:     beq $t4, $s4, l340
+l1005:     j l67
+l1006:     lui $a2, %hi(d3890)
+l1007:     ori $a3, $a3, %lo(d3617)
+l1008:     beq $t8, $s0, l3344
+l1009:     j l3071
+l1010:     lui $a2, %hi(d2798)
+l1011:     ori $a3, $a3, %lo(d2525)
+l1012:     beq $t2, $s4, l2252
+l1013:     j l1979
+l1014:     lui $a2, %hi(d1706)
+l1015:     ori $a3, $a3, %lo(d1433)
+l1016:     beq $t6, $s0, l1160
+l1017:     j l887
+l1018:     lui $a2, %hi(d614)
+l1019:     ori $a3, $a3, %lo(d341)
+l1020:     beq $t0, $s4, l68
+l1021:     j l3891
+l1022:     lui $a2, %hi(d3618)
+l1023:     ori $a3, $a3, %lo(d3345)
+l1024:     beq $t4, $s0, l3072
+l1025:     j l2799
+l1026:     lui $a2, %hi(d2526)
+l1027:     ori $a3, $a3, %lo(d2253)
+l1028:     beq $t8, $s4, l1980
+l1029:     j l1707
+l1030:     lui $a2, %hi(d1434)
+l1031:     ori $a3, $a3, %lo(d1161)
+l1032:     beq $t2, $s0, l888
+l1033:     j l615
+l1034:     lui $a2, %hi(d342)
+l1035:     ori $a3, $a3, %lo(d69)
+l1036:     beq $t6, $s4, l3892
+l1037:     j l3619
+l1038:     lui $a2, %hi(d3346)
+l1039:     ori $a3, $a3, %lo(d3073)
+l1040:     beq $t0, $s0, l2800
+l1041:     j l2527
+l1042:     lui $a2, %hi(d2254)
+l1043:     ori $a3, $a3, %lo(d1981)
+l1044:     beq $t4, $s4, l1708
+l1045:     j l1435
+l1046:     lui $a2, %hi(d1162)
+l1047:     ori $a3, $a3, %lo(d889)
+l1048:     beq $t8, $s0, l616
+l1049:     j l343
+l1050:     lui $a2, %hi(d70)
+l1051:     ori $a3, $a3, %lo(d3893)
+l1052:     beq $t2, $s4, l3620
+l1053:     j l3347
+l1054:     lui $a2, %hi(d3074)
+l1055:     ori $a3, $a3, %lo(d2801)
+l1056:     beq $t6, $s0, l2528
+l1057:     j l2255
+l1058:     lui $a2, %hi(d1982)
+l1059:     ori $a3, $a3, %lo(d1709)
+l1060:     beq $t0, $s4, l1436
+l1061:     j l1163
+l1062:     lui $a2, %hi(d890)
+l1063:     ori $a3, $a3, %lo(d617)
+l1064:     beq $t4, $s0, l344
+l1065:     j l71
+l1066:     lui $a2, %hi(d3894)
+l1067:     ori $a3, $a3, %lo(d3621)
+l1068:     beq $t8, $s4, l3348
+l1069:     j l3075
+l1070:     lui $a2, %hi(d2802)
+l1071:     ori $a3, $a3, %lo(d2529)
+l1072:     beq $t2, $s0, l2256
+l1073:     j l1983
+l1074:     lui $a2, %hi(d1710)
+l1075:     ori $a3, $a3, %lo(d1437)
+l1076:     beq $t6, $s4, l1164
+l1077:     j l891
+l1078:     lui $a2, %hi(d618)
+l1079:     ori $a3, $a3, %lo(d345)
+l1080:     beq $t0, $s0, l72
+l1081:     j l3895
+l1082:     lui $a2, %hi(d3622)
+l1083:     ori $a3, $a3, %lo(d3349)
+l1084:     beq $t4, $s4, l3076
+l1085:     j l2803
+l1086:     lui $a2, %hi(d2530)
+l1087:     ori $a3, $a3, %lo(d2257)
+l1088:     beq $t8, $s0, l1984
+l1089:     j l1711
+l1090:     lui $a2, %hi(d1438)
+l1091:     ori $a3, $a3, %lo(d1165)
+l1092:     beq $t2, $s4, l892
+l1093:     j l619
+l1094:     lui $a2, %hi(d346)
+l1095:     ori $a3, $a3, %lo(d73)
+l1096:     beq $t6, $s0, l3896
+l1097:     j l3623
+l1098:     lui $a2, %hi(d3350)
+l1099:     ori $a3, $a3, %lo(d3077)
+l1100:     beq $t0, $s4, l2804
+l1101:     j l2531
+l1102:     lui $a2, %hi(d2258)
+l1103:     ori $a3, $a3, %lo(d1985)
+l1104:     beq $t4, $s0, l1712
+l1105:     j l1439
+l1106:     lui $a2, %hi(d1166)
+l1107:     ori $a3, $a3, %lo(d893)
+l1108:     beq $t8, $s4, l620
+l1109:     j l347
+l1110:     lui $a2, %hi(d74)
+l1111:     ori $a3, $a3, %lo(d3897)
+l1112:     beq $t2, $s0, l3624
+l1113:     j l3351
+l1114:     lui $a2, %hi(d3078)
+l1115:     ori $a3, $a3, %lo(d2805)
+l1116:     beq $t6, $s4, l2532
+l1117:     j l2259
+l1118:     lui $a2, %hi(d1986)
+l1119:     ori $a3, $a3, %lo(d1713)
+l1120:     beq $t0, $s0, l1440
+l1121:     j l1167
+l1122:     lui $a2, %hi(d894)
+l1123:     ori $a3, $a3, %lo(d621)
+l1124:     beq $t4, $s4, l348
+l1125:     j l75
+l1126:     lui $a2, %hi(d3898)
+l1127:     ori $a3, $a3, %lo(d3625)
+l1128:     beq $t8, $s0, l3352
+l1129:     j l3079
+l1130:     lui $a2, %hi(d2806)
+l1131:     ori $a3, $a3, %lo(d2533)
+l1132:     beq $t2, $s4, l2260
+l1133:     j l1987
+l1134:     lui $a2, %hi(d1714)
+l1135:     ori $a3, $a3, %lo(d1441)
+l1136:     beq $t6, $s0, l1168
+l1137:     j l895
+l1138:     lui $a2, %hi(d622)
+l1139:     ori $a3, $a3, %lo(d349)
+l1140:     beq $t0, $s4, l76
+l1141:     j l3899
+l1142:     lui $a2, %hi(d3626)
+l1143:     ori $a3, $a3, %lo(d3353)
+l1144:     beq $t4, $s0, l3080
+l1145:     j l2807
+l1146:     lui $a2, %hi(d2534)
+l1147:     ori $a3, $a3, %lo(d2261)
+l1148:     beq $t8, $s4, l1988
+l1149:     j l1715
+l1150:     lui $a2, %hi(d1442)
+l1151:     ori $a3, $a3, %lo(d1169)
+l1152:     beq $t2, $s0, l896
+l1153:     j l623
+l1154:     lui $a2, %hi(d350)
+l1155:     ori $a3, $a3, %lo(d77)
+l1156:     beq $t6, $s4, l3900
+l1157:     j l3627
+l1158:     lui $a2, %hi(d3354)
+l1159:     ori $a3, $a3, %lo(d3081)
+l1160:     beq $t0, $s0, l2808
+l1161:     j l2535
+l1162:     lui $a2, %hi(d2262)
+l1163:     ori $a3, $a3, %lo(d1989)
+l1164:     beq $t4, $s4, l1716
+l1165:     j l1443
+l1166:     lui $a2, %hi(d1170)
+l1167:     ori $a3, $a3, %lo(d897)
+l1168:     beq $t8, $s0, l624
+l1169:     j l351
+l1170:     lui $a2, %hi(d78)
+l1171:     ori $a3, $a3, %lo(d3901)
+l1172:     beq $t2, $s4, l3628
+l1173:     j l3355
+l1174:     lui $a2, %hi(d3082)
+l1175:     ori $a3, $a3, %lo(d2809)
+l1176:     beq $t6, $s0, l2536
+l1177:     j l2263
+l1178:     lui $a2, %hi(d1990)
+l1179:     ori $a3, $a3, %lo(d1717)
+l1180:     beq $t0, $s4, l1444
+l1181:     j l1171
+l1182:     lui $a2, %hi(d898)
+l1183:     ori $a3, $a3, %lo(d625)
+l1184:     beq $t4, $s0, l352
+l1185:     j l79
+l1186:     lui $a2, %hi(d3902)
+l1187:     ori $a3, $a3, %lo(d3629)
+l1188:     beq $t8, $s4, l3356
+l1189:     j l3083
+l1190:     lui $a2, %hi(d2810)
+l1191:     ori $a3, $a3, %lo(d2537)
+l1192:     beq $t2, $s0, l2264
+l1193:     j l1991
+l1194:     lui $a2, %hi(d1718)
+l1195:     ori $a3, $a3, %lo(d1445)
+l1196:     beq $t6, $s4, l1172
+l1197:     j l899
+l1198:     lui $a2, %hi(d626)
+l1199:     ori $a3, $a3, %lo(d353)
+l1200:     beq $t0, $s0, l80
+l1201:     j l3903
+l1202:     lui $a2, %hi(d3630)
+l1203:     ori $a3, $a3, %lo(d3357)
+l1204:     beq $t4, $s4, l3084
+l1205:     j l2811
+l1206:     lui $a2, %hi(d2538)
+l1207:     ori $a3, $a3, %lo(d2265)
+l1208:     beq $t8, $s0, l1992
+l1209:     j l1719
+l1210:     lui $a2, %hi(d1446)
+l1211:     ori $a3, $a3, %lo(d1173)
+l1212:     beq $t2, $s4, l900
+l1213:     j l627
+l1214:     lui $a2, %hi(d354)
+l1215:     ori $a3, $a3, %lo(d81)
+l1216:     beq $t6, $s0, l3904
+l1217:     j l3631
+l1218:     lui $a2, %hi(d3358)
+l1219:     ori $a3, $a3, %lo(d3085)
+l1220:     beq $t0, $s4, l2812
+l1221:     j l2539
+l1222:     lui $a2, %hi(d2266)
+l1223:     ori $a3, $a3, %lo(d1993)
+l1224:     beq $t4, $s0, l1720
+l1225:     j l1447
+l1226:     lui $a2, %hi(d1174)
+l1227:     ori $a3, $a3, %lo(d901)
+l1228:     beq $t8, $s4, l628
+l1229:     j l355
+l1230:     lui $a2, %hi(d82)
+l1231:     ori $a3, $a3, %lo(d3905)
+l1232:     beq $t2, $s0, l3632
+l1233:     j l3359
+l1234:     lui $a2, %hi(d3086)
+l1235:     ori $a3, $a3, %lo(d2813)
+l1236:     beq $t6, $s4, l2540
+l1237:     j l2267
+l1238:     lui $a2, %hi(d1994)
+l1239:     ori $a3, $a3, %lo(d1721)
+l1240:     beq $t0, $s0, l1448
+l1241:     j l1175
+l1242:     lui $a2, %hi(d902)
+l1243:     ori $a3, $a3, %lo(d629)
+l1244:     beq $t4, $s4, l356
+l1245:     j l83
+l1246:     lui $a2, %hi(d3906)
+l1247:     ori $a3, $a3, %lo(d3633)
+l1248:     beq $t8, $s0, l3360
+l1249:     j l3087
+l1250:     lui $a2, %hi(d2814)
+l1251:     ori $a3, $a3, %lo(d2541)
+l1252:     beq $t2, $s4, l2268
+l1253:     j l1995
+l1254:     lui $a2, %hi(d1722)
+l1255:     ori $a3, $a3, %lo(d1449)
+l1256:     beq $t6, $s0, l1176
+l1257:     j l903
+l1258:     lui $a2, %hi(d630)
+l1259:     ori $a3, $a3, %lo(d357)
+l1260:     beq $t0, $s4, l84
+l1261:     j l3907
+l1262:     lui $a2, %hi(d3634)
+l1263:     ori $a3, $a3, %lo(d3361)
+l1264:     beq $t4, $s0, l3088
+l1265:     j l2815
+l1266:     lui $a2, %hi(d2542)
+l1267:     ori $a3, $a3, %lo(d2269)
+l1268:     beq $t8, $s4, l1996
+l1269:     j l1723
+l1270:     lui $a2, %hi(d1450)
+l1271:     ori $a3, $a3, %lo(d1177)
+l1272:     beq $t2, $s0, l904
+l1273:     j l631
+l1274:     lui $a2, %hi(d358)
+l1275:     ori $a3, $a3, %lo(d85)
+l1276:     beq $t6, $s4, l3908
+l1277:     j l3635
+l1278:     lui $a2, %hi(d3362)
+l1279:     ori $a3, $a3, %lo(d3089)
+l1280:     beq $t0, $s0, l2816
+l1281:     j l2543
+l1282:     lui $a2, %hi(d2270)
+l1283:     ori $a3, $a3, %lo(d1997)
+l1284:     beq $t4, $s4, l1724
+l1285:     j l1451
+l1286:     lui $a2, %hi(d1178)
+l1287:     ori $a3, $a3, %lo(d905)
+l1288:     beq $t8, $s0, l632
+l1289:     j l359
+l1290:     lui $a2, %hi(d86)
+l1291:     ori $a3, $a3, %lo(d3909)
+l1292:     beq $t2, $s4, l3636
+l1293:     j l3363
+l1294:     lui $a2, %hi(d3090)
+l1295:     ori $a3, $a3, %lo(d2817)
+l1296:     beq $t6, $s0, l2544
+l1297:     j l2271
+l1298:     lui $a2, %hi(d1998)
+l1299:     ori $a3, $a3, %lo(d1725)
+l1300:     beq $t0, $s4, l1452
+l1301:     j l1179
+l1302:     lui $a2, %hi(d906)
+l1303:     ori $a3, $a3, %lo(d633)
+l1304:     beq $t4, $s0, l360
+l1305:     j l87
+l1306:     lui $a2, %hi(d3910)
+l1307:     ori $a3, $a3, %lo(d3637)
+l1308:     beq $t8, $s4, l3364
+l1309:     j l3091
+l1310:     lui $a2, %hi(d2818)
+l1311:     ori $a3, $a3, %lo(d2545)
+l1312:     beq $t2, $s0, l2272
+l1313:     j l1999
+l1314:     lui $a2, %hi(d1726)
+l1315:     ori $a3, $a3, %lo(d1453)
+l1316:     beq $t6, $s4, l1180
+l1317:     j l907
+l1318:     lui $a2, %hi(d634)
+l1319:     ori $a3, $a3, %lo(d361)
+l1320:     beq $t0, $s0, l88
+l1321:     j l3911
+l1322:     lui $a2, %hi(d3638)
+l1323:     ori $a3, $a3, %lo(d3365)
+l1324:     beq $t4, $s4, l3092
+l1325:     j l2819
+l1326:     lui $a2, %hi(d2546)
+l1327:     ori $a3, $a3, %lo(d2273)
+l1328:     beq $t8, $s0, l2000
+l1329:     j l1727
+l1330:     lui $a2, %hi(d1454)
+l1331:     ori $a3, $a3, %lo(d1181)
+l1332:     beq $t2, $s4, l908
+l1333:     j l635
+l1334:     lui $a2, %hi(d362)
+l1335:     ori $a3, $a3, %lo(d89)
+l1336:     beq $t6, $s0, l3912
+l1337:     j l3639
+l1338:     lui $a2, %hi(d3366)
+l1339:     ori $a3, $a3, %lo(d3093)
+l1340:     beq $t0, $s4, l2820
+l1341:     j l2547
+l1342:     lui $a2, %hi(d2274)
+l1343:     ori $a3, $a3, %lo(d2001)
+l1344:     beq $t4, $s0, l1728
+l1345:     j l1455
+l1346:     lui $a2, %hi(d1182)
+l1347:     ori $a3, $a3, %lo(d909)
+l1348:     beq $t8, $s4, l636
+l1349:     j l363
+l1350:     lui $a2, %hi(d90)
+l1351:     ori $a3, $a3, %lo(d3913)
+l1352:     beq $t2, $s0, l3640
+l1353:     j l3367
+l1354:     lui $a2, %hi(d3094)
+l1355:     ori $a3, $a3, %lo(d2821)
+l1356:     beq $t6, $s4, l2548
+l1357:     j l2275
+l1358:     lui $a2, %hi(d2002)
+l1359:     ori $a3, $a3, %lo(d1729)
+l1360:     beq $t0, $s0, l1456
+l1361:     j l1183
+l1362:     lui $a2, %hi(d910)
+l1363:     ori $a3, $a3, %lo(d637)
+l1364:     beq $t4, $s4, l364
+l1365:     j l91
+l1366:     lui $a2, %hi(d3914)
+l1367:     ori $a3, $a3, %lo(d3641)
+l1368:     beq $t8, $s0, l3368
+l1369:     j l3095
+l1370:     lui $a2, %hi(d2822)
+l1371:     ori $a3, $a3, %lo(d2549)
+l1372:     beq $t2, $s4, l2276
+l1373:     j l2003
+l1374:     lui $a2, %hi(d1730)
+l1375:     ori $a3, $a3, %lo(d1457)
+l1376:     beq $t6, $s0, l1184
+l1377:     j l911
+l1378:     lui $a2, %hi(d638)
+l1379:     ori $a3, $a3, %lo(d365)
+l1380:     beq $t0, $s4, l92
+l1381:     j l3915
+l1382:     lui $a2, %hi(d3642)
+l1383:     ori $a3, $a3, %lo(d3369)
+l1384:     beq $t4, $s0, l3096
+l1385:     j l2823
+l1386:     lui $a2, %hi(d2550)
+l1387:     ori $a3, $a3, %lo(d2277)
+l1388:     beq $t8, $s4, l2004
+l1389:     j l1731
+l1390:     lui $a2, %hi(d1458)
+l1391:     ori $a3, $a3, %lo(d1185)
+l1392:     beq $t2, $s0, l912
+l1393:     j l639
+l1394:     lui $a2, %hi(d366)
+l1395:     ori $a3, $a3, %lo(d93)
+l1396:     beq $t6, $s4, l3916
+l1397:     j l3643
+l1398:     lui $a2, %hi(d3370)
+l1399:     ori $a3, $a3, %lo(d3097)
+l1400:     beq $t0, $s0, l2824
+l1401:     j l2551
+l1402:     lui $a2, %hi(d2278)
+l1403:     ori $a3, $a3, %lo(d2005)
+l1404:     beq $t4, $s4, l1732
+l1405:     j l1459
+l1406:     lui $a2, %hi(d1186)
+l1407:     ori $a3, $a3, %lo(d913)
+l1408:     beq $t8, $s0, l640
+l1409:     j l367
+l1410:     lui $a2, %hi(d94)
+l1411:     ori $a3, $a3, %lo(d3917)
+l1412:     beq $t2, $s4, l3644
+l1413:     j l3371
+l1414:     lui $a2, %hi(d3098)
+l1415:     ori $a3, $a3, %lo(d2825)
+l1416:     beq $t6, $s0, l2552
+l1417:     j l2279
+l1418:     lui $a2, %hi(d2006)
+l1419:     ori $a3, $a3, %lo(d1733)
+l1420:     beq $t0, $s4, l1460
+l1421:     j l1187
+l1422:     lui $a2, %hi(d914)
+l1423:     ori $a3, $a3, %lo(d641)
+l1424:     beq $t4, $s0, l368
+l1425:     j l95
+l1426:     lui $a2, %hi(d3918)
+l1427:     ori $a3, $a3, %lo(d3645)
+l1428:     beq $t8, $s4, l3372
+l1429:     j l3099
+l1430:     lui $a2, %hi(d2826)
+l1431:     ori $a3, $a3, %lo(d2553)
+l1432:     beq $t2, $s0, l2280
+l1433:     j l2007
+l1434:     lui $a2, %hi(d1734)
+l1435:     ori $a3, $a3, %lo(d1461)
+l1436:     beq $t6, $s4, l1188
+l1437:     j l915
+l1438:     lui $a2, %hi(d642)
+l1439:     ori $a3, $a3, %lo(d369)
+l1440:     beq $t0, $s0, l96
+l1441:     j l3919
+l1442:     lui $a2, %hi(d3646)
+l1443:     ori $a3, $a3, %lo(d3373)
+l1444:     beq $t4, $s4, l3100
+l1445:     j l2827
+l1446:     lui $a2, %hi(d2554)
+l1447:     ori $a3, $a3, %lo(d2281)
+l1448:     beq $t8, $s0, l2008
+l1449:     j l1735
+l1450:     lui $a2, %hi(d1462)
+l1451:     ori $a3, $a3, %lo(d1189)
+l1452:     beq $t2, $s4, l916
+l1453:     j l643
+l1454:     lui $a2, %hi(d370)
+l1455:     ori $a3, $a3, %lo(d97)
+l1456:     beq $t6, $s0, l3920
+l1457:     j l3647
+l1458:     lui $a2, %hi(d3374)
+l1459:     ori $a3, $a3, %lo(d3101)
+l1460:     beq $t0, $s4, l2828
+l1461:     j l2555
+l1462:     lui $a2, %hi(d2282)
+l1463:     ori $a3, $a3, %lo(d2009)
+l1464:     beq $t4, $s0, l1736
+l1465:     j l1463
+l1466:     lui $a2, %hi(d1190)
+l1467:     ori $a3, $a3, %lo(d917)
+l1468:     beq $t8, $s4, l644
+l1469:     j l371
+l1470:     lui $a2, %hi(d98)
+l1471:     ori $a3, $a3, %lo(d3921)
+l1472:     beq $t2, $s0, l3648
+l1473:     j l3375
+l1474:     lui $a2, %hi(d3102)
+l1475:     ori $a3, $a3, %lo(d2829)
+l1476:     beq $t6, $s4, l2556
+l1477:     j l2283
+l1478:     lui $a2, %hi(d2010)
+l1479:     ori $a3, $a3, %lo(d1737)
+l1480:     beq $t0, $s0, l1464
+l1481:     j l1191
+l1482:     lui $a2, %hi(d918)
+l1483:     ori $a3, $a3, %lo(d645)
+l1484:     beq $t4, $s4, l372
+l1485:     j l99
+l1486:     lui $a2, %hi(d3922)
+l1487:     ori $a3, $a3, %lo(d3649)
+l1488:     beq $t8, $s0, l3376
+l1489:     j l3103
+l1490:     lui $a2, %hi(d2830)
+l1491:     ori $a3, $a3, %lo(d2557)
+l1492:     beq $t2, $s4, l2284
+l1493:     j l2011
+l1494:     lui $a2, %hi(d1738)
+l1495:     ori $a3, $a3, %lo(d1465)
+l1496:     beq $t6, $s0, l1192
+l1497:     j l919
+l1498:     lui $a2, %hi(d646)
+l1499:     ori $a3, $a3, %lo(d373)
+l1500:     beq $t0, $s4, l100
+l1501:     j l3923
+l1502:     lui $a2, %hi(d3650)
+l1503:     ori $a3, $a3, %lo(d3377)
+l1504:     beq $t4, $s0, l3104
+l1505:     j l2831
+l1506:     lui $a2, %hi(d2558)
+l1507:     ori $a3, $a3, %lo(d2285)
+l1508:     beq $t8, $s4, l2012
+l1509:     j l1739
+l1510:     lui $a2, %hi(d1466)
+l1511:     ori $a3, $a3, %lo(d1193)
+l1512:     beq $t2, $s0, l920
+l1513:     j l647
+l1514:     lui $a2, %hi(d374)
+l1515:     ori $a3, $a3, %lo(d101)
+l1516:     beq $t6, $s4, l3924
+l1517:     j l3651
+l1518:     lui $a2, %hi(d3378)
+l1519:     ori $a3, $a3, %lo(d3105)
+l1520:     beq $t0, $s0, l2832
+l1521:     j l2559
+l1522:     lui $a2, %hi(d2286)
+l1523:     ori $a3, $a3, %lo(d2013)
+l1524:     beq $t4, $s4, l1740
+l1525:     j l1467
+l1526:     lui $a2, %hi(d1194)
+l1527:     ori $a3, $a3, %lo(d921)
+l1528:     beq $t8, $s0, l648
+l1529:     j l375
+l1530:     lui $a2, %hi(d102)
+l1531:     ori $a3, $a3, %lo(d3925)
+l1532:     beq $t2, $s4, l3652
+l1533:     j l3379
+l1534:     lui $a2, %hi(d3106)
+l1535:     ori $a3, $a3, %lo(d2833)
+l1536:     beq $t6, $s0, l2560
+l1537:     j l2287
+l1538:     lui $a2, %hi(d2014)
+l1539:     ori $a3, $a3, %lo(d1741)
+l1540:     beq $t0, $s4, l1468
+l1541:     j l1195
+l1542:     lui $a2, %hi(d922)
+l1543:     ori $a3, $a3, %lo(d649)
+l1544:     beq $t4, $s0, l376
+l1545:     j l103
+l1546:     lui $a2, %hi(d3926)
+l1547:     ori $a3, $a3, %lo(d3653)
+l1548:     beq $t8, $s4, l3380
+l1549:     j l3107
+l1550:     lui $a2, %hi(d2834)
+l1551:     ori $a3, $a3, %lo(d2561)
+l1552:     beq $t2, $s0, l2288
+l1553:     j l2015
+l1554:     lui $a2, %hi(d1742)
+l1555:     ori $a3, $a3, %lo(d1469)
+l1556:     beq $t6, $s4, l1196
+l1557:     j l923
+l1558:     lui $a2, %hi(d650)
+l1559:     ori $a3, $a3, %lo(d377)
+l1560:     beq $t0, $s0, l104
+l1561:     j l3927
+l1562:     lui $a2, %hi(d3654)
+l1563:     ori $a3, $a3, %lo(d3381)
+l1564:     beq $t4, $s4, l3108
+l1565:     j l2835
+l1566:     lui $a2, %hi(d2562)
+l1567:     ori $a3, $a3, %lo(d2289)
+l1568:     beq $t8, $s0, l2016
+l1569:     j l1743
+l1570:     lui $a2, %hi(d1470)
+l1571:     ori $a3, $a3, %lo(d1197)
+l1572:     beq $t2, $s4, l924
+l1573:     j l651
+l1574:     lui $a2, %hi(d378)
+l1575:     ori $a3, $a3, %lo(d105)
+l1576:     beq $t6, $s0, l3928
+l1577:     j l3655
+l1578:     lui $a2, %hi(d3382)
+l1579:     ori $a3, $a3, %lo(d3109)
+l1580:     beq $t0, $s4, l2836
+l1581:     j l2563
+l1582:     lui $a2, %hi(d2290)
+l1583:     ori $a3, $a3, %lo(d2017)
+l1584:     beq $t4, $s0, l1744
+l1585:     j l1471
+l1586:     lui $a2, %hi(d1198)
+l1587:     ori $a3, $a3, %lo(d925)
+l1588:     beq $t8, $s4, l652
+l1589:     j l379
+l1590:     lui $a2, %hi(d106)
+l1591:     ori $a3, $a3, %lo(d3929)
+l1592:     beq $t2, $s0, l3656
+l1593:     j l3383
+l1594:     lui $a2, %hi(d3110)
+l1595:     ori $a3, $a3, %lo(d2837)
+l1596:     beq $t6, $s4, l2564
+l1597:     j l2291
+l1598:     lui $a2, %hi(d2018)
+l1599:     ori $a3, $a3, %lo(d1745)
+l1600:     beq $t0, $s0, l1472
+l1601:     j l1199
+l1602:     lui $a2, %hi(d926)
+l1603:     ori $a3, $a3, %lo(d653)
+l1604:     beq $t4, $s4, l380
+l1605:     j l107
+l1606:     lui $a2, %hi(d3930)
+l1607:     ori $a3, $a3, %lo(d3657)
+l1608:     beq $t8, $s0, l3384
+l1609:     j l3111
+l1610:     lui $a2, %hi(d2838)
+l1611:     ori $a3, $a3, %lo(d2565)
+l1612:     beq $t2, $s4, l2292
+l1613:     j l2019
+l1614:     lui $a2, %hi(d1746)
+l1615:     ori $a3, $a3, %lo(d1473)
+l1616:     beq $t6, $s0, l1200
+l1617:     j l927
+l1618:     lui $a2, %hi(d654)
+l1619:     ori $a3, $a3, %lo(d381)
+l1620:     beq $t0, $s4, l108
+l1621:     j l3931
+l1622:     lui $a2, %hi(d3658)
+l1623:     ori $a3, $a3, %lo(d3385)
+l1624:     beq $t4, $s0, l3112
+l1625:     j l2839
+l1626:     lui $a2, %hi(d2566)
+l1627:     ori $a3, $a3, %lo(d2293)
+l1628:     beq $t8, $s4, l2020
+l1629:     j l1747
+l1630:     lui $a2, %hi(d1474)
+l1631:     ori $a3, $a3, %lo(d1201)
+l1632:     beq $t2, $s0, l928
+l1633:     j l655
+l1634:     lui $a2, %hi(d382)
+l1635:     ori $a3, $a3, %lo(d109)
+l1636:     beq $t6, $s4, l3932
+l1637:     j l3659
+l1638:     lui $a2, %hi(d3386)
+l1639:     ori $a3, $a3, %lo(d3113)
+l1640:     beq $t0, $s0, l2840
+l1641:     j l2567
+l1642:     lui $a2, %hi(d2294)
+l1643:     ori $a3, $a3, %lo(d2021)
+l1644:     beq $t4, $s4, l1748
+l1645:     j l1475
+l1646:     lui $a2, %hi(d1202)
+l1647:     ori $a3, $a3, %lo(d929)
+l1648:     beq $t8, $s0, l656
+l1649:     j l383
+l1650:     lui $a2, %hi(d110)
+l1651:     ori $a3, $a3, %lo(d3933)
+l1652:     beq $t2, $s4, l3660
+l1653:     j l3387
+l1654:     lui $a2, %hi(d3114)
+l1655:     ori $a3, $a3, %lo(d2841)
+l1656:     beq $t6, $s0, l2568
+l1657:     j l2295
+l1658:     lui $a2, %hi(d2022)
+l1659:     ori $a3, $a3, %lo(d1749)
+l1660:     beq $t0, $s4, l1476
+l1661:     j l1203
+l1662:     lui $a2, %hi(d930)
+l1663:     ori $a3, $a3, %lo(d657)
+l1664:     beq $t4, $s0, l384
+l1665:     j l111
+l1666:     lui $a2, %hi(d3934)
+l1667:     ori $a3, $a3, %lo(d3661)
+l1668:     beq $t8, $s4, l3388
+l1669:     j l3115
+l1670:     lui $a2, %hi(d2842)
+l1671:     ori $a3, $a3, %lo(d2569)
+l1672:     beq $t2, $s0, l2296
+l1673:     j l2023
+l1674:     lui $a2, %hi(d1750)
+l1675:     ori $a3, $a3, %lo(d1477)
+l1676:     beq $t6, $s4, l1204
+l1677:     j l931
+l1678:     lui $a2, %hi(d658)
+l1679:     ori $a3, $a3, %lo(d385)
+l1680:     beq $t0, $s0, l112
+l1681:     j l3935
+l1682:     lui $a2, %hi(d3662)
+l1683:     ori $a3, $a3, %lo(d3389)
+l1684:     beq $t4, $s4, l3116
+l1685:     j l2843
+l1686:     lui $a2, %hi(d2570)
+l1687:     ori $a3, $a3, %lo(d2297)
+l1688:     beq $t8, $s0, l2024
+l1689:     j l1751
+l1690:     lui $a2, %hi(d1478)
+l1691:     ori $a3, $a3, %lo(d1205)
+l1692:     beq $t2, $s4, l932
+l1693:     j l659
+l1694:     lui $a2, %hi(d386)
+l1695:     ori $a3, $a3, %lo(d113)
+l1696:     beq $t6, $s0, l3936
+l1697:     j l3663
+l1698:     lui $a2, %hi(d3390)
+l1699:     ori $a3, $a3, %lo(d3117)
+l1700:     beq $t0, $s4, l2844
+l1701:     j l2571
+l1702:     lui $a2, %hi(d2298)
+l1703:     ori $a3, $a3, %lo(d2025)
+l1704:     beq $t4, $s0, l1752
+l1705:     j l1479
+l1706:     lui $a2, %hi(d1206)
+l1707:     ori $a3, $a3, %lo(d933)
+l1708:     beq $t8, $s4, l660
+l1709:     j l387
+l1710:     lui $a2, %hi(d114)
+l1711:     ori $a3, $a3, %lo(d3937)
+l1712:     beq $t2, $s0, l3664
+l1713:     j l3391
+l1714:     lui $a2, %hi(d3118)
+l1715:     ori $a3, $a3, %lo(d2845)
+l1716:     beq $t6, $s4, l2572
+l1717:     j l2299
+l1718:     lui $a2, %hi(d2026)
+l1719:     ori $a3, $a3, %lo(d1753)
+l1720:     beq $t0, $s0, l1480
+l1721:     j l1207
+l1722:     lui $a2, %hi(d934)
+l1723:     ori $a3, $a3, %lo(d661)
+l1724:     beq $t4, $s4, l388
+l1725:     j l115
+l1726:     lui $a2, %hi(d3938)
+l1727:     ori $a3, $a3, %lo(d3665)
+l1728:     beq $t8, $s0, l3392
+l1729:     j l3119
+l1730:     lui $a2, %hi(d2846)
+l1731:     ori $a3, $a3, %lo(d2573)
+l1732:     beq $t2, $s4, l2300
+l1733:     j l2027
+l1734:     lui $a2, %hi(d1754)
+l1735:     ori $a3, $a3, %lo(d1481)
+l1736:     beq $t6, $s0, l1208
+l1737:     j l935
+l1738:     lui $a2, %hi(d662)
+l1739:     ori $a3, $a3, %lo(d389)
+l1740:     beq $t0, $s4, l116
+l1741:     j l3939
+l1742:     lui $a2, %hi(d3666)
+l1743:     ori $a3, $a3, %lo(d3393)
+l1744:     beq $t4, $s0, l3120
+l1745:     j l2847
+l1746:     lui $a2, %hi(d2574)
+l1747:     ori $a3, $a3, %lo(d2301)
+l1748:     beq $t8, $s4, l2028
+l1749:     j l1755
+l1750:     lui $a2, %hi(d1482)
+l1751:     ori $a3, $a3, %lo(d1209)
+l1752:     beq $t2, $s0, l936
+l1753:     j l663
+l1754:     lui $a2, %hi(d390)
+l1755:     ori $a3, $a3, %lo(d117)
+l1756:     beq $t6, $s4, l3940
+l1757:     j l3667
+l1758:     lui $a2, %hi(d3394)
+l1759:     ori $a3, $a3, %lo(d3121)
+l1760:     beq $t0, $s0, l2848
+l1761:     j l2575
+l1762:     lui $a2, %hi(d2302)
+l1763:     ori $a3, $a3, %lo(d2029)
+l1764:     beq $t4, $s4, l1756
+l1765:     j l1483
+l1766:     lui $a2, %hi(d1210)
+l1767:     ori $a3, $a3, %lo(d937)
+l1768:     beq $t8, $s0, l664
+l1769:     j l391
+l1770:     lui $a2, %hi(d118)
+l1771:     ori $a3, $a3, %lo(d3941)
+l1772:     beq $t2, $s4, l3668
+l1773:     j l3395
+l1774:     lui $a2, %hi(d3122)
+l1775:     ori $a3, $a3, %lo(d2849)
+l1776:     beq $t6, $s0, l2576
+l1777:     j l2303
+l1778:     lui $a2, %hi(d2030)
+l1779:     ori $a3, $a3, %lo(d1757)
+l1780:     beq $t0, $s4, l1484
+l1781:     j l1211
+l1782:     lui $a2, %hi(d938)
+l1783:     ori $a3, $a3, %lo(d665)
+l1784:     beq $t4, $s0, l392
+l1785:     j l119
+l1786:     lui $a2, %hi(d3942)
+l1787:     ori $a3, $a3, %lo(d3669)
+l1788:     beq $t8, $s4, l3396
+l1789:     j l3123
+l1790:     lui $a2, %hi(d2850)
+l1791:     ori $a3, $a3, %lo(d2577)
+l1792:     beq $t2, $s0, l2304
+l1793:     j l2031
+l1794:     lui $a2, %hi(d1758)
+l1795:     ori $a3, $a3, %lo(d1485)
+l1796:     beq $t6, $s4, l1212
+l1797:     j l939
+l1798:     lui $a2, %hi(d666)
+l1799:     ori $a3, $a3, %lo(d393)
+l1800:     beq $t0, $s0, l120
+l1801:     j l3943
+l1802:     lui $a2, %hi(d3670)
+l1803:     ori $a3, $a3, %lo(d3397)
+l1804:     beq $t4, $s4, l3124
+l1805:     j l2851
+l1806:     lui $a2, %hi(d2578)
+l1807:     ori $a3, $a3, %lo(d2305)
+l1808:     beq $t8, $s0, l2032
+l1809:     j l1759
+l1810:     lui $a2, %hi(d1486)
+l1811:     ori $a3, $a3, %lo(d1213)
+l1812:     beq $t2, $s4, l940
+l1813:     j l667
+l1814:     lui $a2, %hi(d394)
+l1815:     ori $a3, $a3, %lo(d121)
+l1816:     beq $t6, $s0, l3944
+l1817:     j l3671
+l1818:     lui $a2, %hi(d3398)
+l1819:     ori $a3, $a3, %lo(d3125)
+l1820:     beq $t0, $s4, l2852
+l1821:     j l2579
+l1822:     lui $a2, %hi(d2306)
+l1823:     ori $a3, $a3, %lo(d2033)
+l1824:     beq $t4, $s0, l1760
+l1825:     j l1487
+l1826:     lui $a2, %hi(d1214)
+l1827:     ori $a3, $a3, %lo(d941)
+l1828:     beq $t8, $s4, l668
+l1829:     j l395
+l1830:     lui $a2, %hi(d122)
+l1831:     ori $a3, $a3, %lo(d3945)
+l1832:     beq $t2, $s0, l3672
+l1833:     j l3399
+l1834:     lui $a2, %hi(d3126)
+l1835:     ori $a3, $a3, %lo(d2853)
+l1836:     beq $t6, $s4, l2580
+l1837:     j l2307
+l1838:     lui $a2, %hi(d2034)
+l1839:     ori $a3, $a3, %lo(d1761)
+l1840:     beq $t0, $s0, l1488
+l1841:     j l1215
+l1842:     lui $a2, %hi(d942)
+l1843:     ori $a3, $a3, %lo(d669)
+l1844:     beq $t4, $s4, l396
+l1845:     j l123
+l1846:     lui $a2, %hi(d3946)
+l1847:     ori $a3, $a3, %lo(d3673)
+l1848:     beq $t8, $s0, l3400
+l1849:     j l3127
+l1850:     lui $a2, %hi(d2854)
+l1851:     ori $a3, $a3, %lo(d2581)
+l1852:     beq $t2, $s4, l2308
+l1853:     j l2035
+l1854:     lui $a2, %hi(d1762)
+l1855:     ori $a3, $a3, %lo(d1489)
+l1856:     beq $t6, $s0, l1216
+l1857:     j l943
+l1858:     lui $a2, %hi(d670)
+l1859:     ori $a3, $a3, %lo(d397)
+l1860:     beq $t0, $s4, l124
+l1861:     j l3947
+l1862:     lui $a2, %hi(d3674)
+l1863:     ori $a3, $a3, %lo(d3401)
+l1864:     beq $t4, $s0, l3128
+l1865:     j l2855
+l1866:     lui $a2, %hi(d2582)
+l1867:     ori $a3, $a3, %lo(d2309)
+l1868:     beq $t8, $s4, l2036
+l1869:     j l1763
+l1870:     lui $a2, %hi(d1490)
+l1871:     ori $a3, $a3, %lo(d1217)
+l1872:     beq $t2, $s0, l944
+l1873:     j l671
+l1874:     lui $a2, %hi(d398)
+l1875:     ori $a3, $a3, %lo(d125)
+l1876:     beq $t6, $s4, l3948
+l1877:     j l3675
+l1878:     lui $a2, %hi(d3402)
+l1879:     ori $a3, $a3, %lo(d3129)
+l1880:     beq $t0, $s0, l2856
+l1881:     j l2583
+l1882:     lui $a2, %hi(d2310)
+l1883:     ori $a3, $a3, %lo(d2037)
+l1884:     beq $t4, $s4, l1764
+l1885:     j l1491
+l1886:     lui $a2, %hi(d1218)
+l1887:     ori $a3, $a3, %lo(d945)
+l1888:     beq $t8, $s0, l672
+l1889:     j l399
+l1890:     lui $a2, %hi(d126)
+l1891:     ori $a3, $a3, %lo(d3949)
+l1892:     beq $t2, $s4, l3676
+l1893:     j l3403
+l1894:     lui $a2, %hi(d3130)
+l1895:     ori $a3, $a3, %lo(d2857)
+l1896:     beq $t6, $s0, l2584
+l1897:     j l2311
+l1898:     lui $a2, %hi(d2038)
+l1899:     ori $a3, $a3, %lo(d1765)
+l1900:     beq $t0, $s4, l1492
+l1901:     j l1219
+l1902:     lui $a2, %hi(d946)
+l1903:     ori $a3, $a3, %lo(d673)
+l1904:     beq $t4, $s0, l400
+l1905:     j l127
+l1906:     lui $a2, %hi(d3950)
+l1907:     ori $a3, $a3, %lo(d3677)
+l1908:     beq $t8, $s4, l3404
+l1909:     j l3131
+l1910:     lui $a2, %hi(d2858)
+l1911:     ori $a3, $a3, %lo(d2585)
+l1912:     beq $t2, $s0, l2312
+l1913:     j l2039
+l1914:     lui $a2, %hi(d1766)
+l1915:     ori $a3, $a3, %lo(d1493)
+l1916:     beq $t6, $s4, l1220
+l1917:     j l947
+l1918:     lui $a2, %hi(d674)
+l1919:     ori $a3, $a3, %lo(d401)
+l1920:     beq $t0, $s0, l128
+l1921:     j l3951
+l1922:     lui $a2, %hi(d3678)
+l1923:     ori $a3, $a3, %lo(d3405)
+l1924:     beq $t4, $s4, l3132
+l1925:     j l2859
+l1926:     lui $a2, %hi(d2586)
+l1927:     ori $a3, $a3, %lo(d2313)
+l1928:     beq $t8, $s0, l2040
+l1929:     j l1767
+l1930:     lui $a2, %hi(d1494)
+l1931:     ori $a3, $a3, %lo(d1221)
+l1932:     beq $t2, $s4, l948
+l1933:     j l675
+l1934:     lui $a2, %hi(d402)
+l1935:     ori $a3, $a3, %lo(d129)
+l1936:     beq $t6, $s0, l3952
+l1937:     j l3679
+l1938:     lui $a2, %hi(d3406)
+l1939:     ori $a3, $a3, %lo(d3133)
+l1940:     beq $t0, $s4, l2860
+l1941:     j l2587
+l1942:     lui $a2, %hi(d2314)
+l1943:     ori $a3, $a3, %lo(d2041)
+l1944:     beq $t4, $s0, l1768
+l1945:     j l1495
+l1946:     lui $a2, %hi(d1222)
+l1947:     ori $a3, $a3, %lo(d949)
+l1948:     beq $t8, $s4, l676
+l1949:     j l403
+l1950:     lui $a2, %hi(d130)
+l1951:     ori $a3, $a3, %lo(d3953)
+l1952:     beq $t2, $s0, l3680
+l1953:     j l3407
+l1954:     lui $a2, %hi(d3134)
+l1955:     ori $a3, $a3, %lo(d2861)
+l1956:     beq $t6, $s4, l2588
+l1957:     j l2315
+l1958:     lui $a2, %hi(d2042)
+l1959:     ori $a3, $a3, %lo(d1769)
+l1960:     beq $t0, $s0, l1496
+l1961:     j l1223
+l1962:     lui $a2, %hi(d950)
+l1963:     ori $a3, $a3, %lo(d677)
+l1964:     beq $t4, $s4, l404
+l1965:     j l131
+l1966:     lui $a2, %hi(d3954)
+l1967:     ori $a3, $a3, %lo(d3681)
+l1968:     beq $t8, $s0, l3408
+l1969:     j l3135
+l1970:     lui $a2, %hi(d2862)
+l1971:     ori $a3, $a3, %lo(d2589)
+l1972:     beq $t2, $s4, l2316
+l1973:     j l2043
+l1974:     lui $a2, %hi(d1770)
+l1975:     ori $a3, $a3, %lo(d1497)
+l1976:     beq $t6, $s0, l1224
+l1977:     j l951
+l1978:     lui $a2, %hi(d678)
+l1979:     ori $a3, $a3, %lo(d405)
+l1980:     beq $t0, $s4, l132
+l1981:     j l3955
+l1982:     lui $a2, %hi(d3682)
+l1983:     ori $a3, $a3, %lo(d3409)
+l1984:     beq $t4, $s0, l3136
+l1985:     j l2863
+l1986:     lui $a2, %hi(d2590)
+l1987:     ori $a3, $a3, %lo(d2317)
+l1988:     beq $t8, $s4, l2044
+l1989:     j l1771
+l1990:     lui $a2, %hi(d1498)
+l1991:     ori $a3, $a3, %lo(d1225)
+l1992:     beq $t2, $s0, l952
+l1993:     j l679
+l1994:     lui $a2, %hi(d406)
+l1995:     ori $a3, $a3, %lo(d133)
+l1996:     beq $t6, $s4, l3956
+l1997:     j l3683
+l1998:     lui $a2, %hi(d3410)
+l1999:     ori $a3, $a3, %lo(d3137)
+l2000:     beq $t0, $s0, l2864
+l2001:     j l2591
+l2002:     lui $a2, %hi(d2318)
+l2003:     ori $a3, $a3, %lo(d2045)
+l2004:     beq $t4, $s4, l1772
+l2005:     j l1499
+l2006:     lui $a2, %hi(d1226)
+l2007:     ori $a3, $a3, %lo(d953)
+l2008:     beq $t8, $s0, l680
+l2009:     j l407
+l2010:     lui $a2, %hi(d134)
+l2011:     ori $a3, $a3, %lo(d3957)
+l2012:     beq $t2, $s4, l3684
+l2013:     j l3411
+l2014:     lui $a2, %hi(d3138)
+l2015:     ori $a3, $a3, %lo(d2865)
+l2016:     beq $t6, $s0, l2592
+l2017:     j l2319
+l2018:     lui $a2, %hi(d2046)
+l2019:     ori $a3, $a3, %lo(d1773)
+l2020:     beq $t0, $s4, l1500
+l2021:     j l1227
+l2022:     lui $a2, %hi(d954)
+l2023:     ori $a3, $a3, %lo(d681)
+l2024:     beq $t4, $s0, l408
+l2025:     j l135
+l2026:     lui $a2, %hi(d3958)
+l2027:     ori $a3, $a3, %lo(d3685)
+l2028:     beq $t8, $s4, l3412
+l2029:     j l3139
+l2030:     lui $a2, %hi(d2866)
+l2031:     ori $a3, $a3, %lo(d2593)
+l2032:     beq $t2, $s0, l2320
+l2033:     j l2047
+l2034:     lui $a2, %hi(d1774)
+l2035:     ori $a3, $a3, %lo(d1501)
+l2036:     beq $t6, $s4, l1228
+l2037:     j l955
+l2038:     lui $a2, %hi(d682)
+l2039:     ori $a3, $a3, %lo(d409)
+l2040:     beq $t0, $s0, l136
+l2041:     j l3959
+l2042:     lui $a2, %hi(d3686)
+l2043:     ori $a3, $a3, %lo(d3413)
+l2044:     beq $t4, $s4, l3140
+l2045:     j l2867
+l2046:     lui $a2, %hi(d2594)
+l2047:     ori $a3, $a3, %lo(d2321)
+l2048:     beq $t8, $s0, l2048
+l2049:     j l1775
+l2050:     lui $a2, %hi(d1502)
+l2051:     ori $a3, $a3, %lo(d1229)
+l2052:     beq $t2, $s4, l956
+l2053:     j l683
+l2054:     lui $a2, %hi(d410)
+l2055:     ori $a3, $a3, %lo(d137)
+l2056:     beq $t6, $s0, l3960
+l2057:     j l3687
+l2058:     lui $a2, %hi(d3414)
+l2059:     ori $a3, $a3, %lo(d3141)
+l2060:     beq $t0, $s4, l2868
+l2061:     j l2595
+l2062:     lui $a2, %hi(d2322)
+l2063:     ori $a3, $a3, %lo(d2049)
+l2064:     beq $t4, $s0, l1776
+l2065:     j l1503
+l2066:     lui $a2, %hi(d1230)
+l2067:     ori $a3, $a3, %lo(d957)
+l2068:     beq $t8, $s4, l684
+l2069:     j l411
+l2070:     lui $a2, %hi(d138)
+l2071:     ori $a3, $a3, %lo(d3961)
+l2072:     beq $t2, $s0, l3688
+l2073:     j l3415
+l2074:     lui $a2, %hi(d3142)
+l2075:     ori $a3, $a3, %lo(d2869)
+l2076:     beq $t6, $s4, l2596
+l2077:     j l2323
+l2078:     lui $a2, %hi(d2050)
+l2079:     ori $a3, $a3, %lo(d1777)
+l2080:     beq $t0, $s0, l1504
+l2081:     j l1231
+l2082:     lui $a2, %hi(d958)
+l2083:     ori $a3, $a3, %lo(d685)
+l2084:     beq $t4, $s4, l412
+l2085:     j l139
+l2086:     lui $a2, %hi(d3962)
+l2087:     ori $a3, $a3, %lo(d3689)
+l2088:     beq $t8, $s0, l3416
+l2089:     j l3143
+l2090:     lui $a2, %hi(d2870)
+l2091:     ori $a3, $a3, %lo(d2597)
+l2092:     beq $t2, $s4, l2324
+l2093:     j l2051
+l2094:     lui $a2, %hi(d1778)
+l2095:     ori $a3, $a3, %lo(d1505)
+l2096:     beq $t6, $s0, l1232
+l2097:     j l959
+l2098:     lui $a2, %hi(d686)
+l2099:     ori $a3, $a3, %lo(d413)
+l2100:     beq $t0, $s4, l140
+l2101:     j l3963
+l2102:     lui $a2, %hi(d3690)
+l2103:     ori $a3, $a3, %lo(d3417)
+l2104:     beq $t4, $s0, l3144
+l2105:     j l2871
+l2106:     lui $a2, %hi(d2598)
+l2107:     ori $a3, $a3, %lo(d2325)
+l2108:     beq $t8, $s4, l2052
+l2109:     j l1779
+l2110:     lui $a2, %hi(d1506)
+l2111:     ori $a3, $a3, %lo(d1233)
+l2112:     beq $t2, $s0, l960
+l2113:     j l687
+l2114:     lui $a2, %hi(d414)
+l2115:     ori $a3, $a3, %lo(d141)
+l2116:     beq $t6, $s4, l3964
+l2117:     j l3691
+l2118:     lui $a2, %hi(d3418)
+l2119:     ori $a3, $a3, %lo(d3145)
+l2120:     beq $t0, $s0, l2872
+l2121:     j l2599
+l2122:     lui $a2, %hi(d2326)
+l2123:     ori $a3, $a3, %lo(d2053)
+l2124:     beq $t4, $s4, l1780
+l2125:     j l1507
+l2126:     lui $a2, %hi(d1234)
+l2127:     ori $a3, $a3, %lo(d961)
+l2128:     beq $t8, $s0, l688
+l2129:     j l415
+l2130:     lui $a2, %hi(d142)
+l2131:     ori $a3, $a3, %lo(d3965)
+l2132:     beq $t2, $s4, l3692
+l2133:     j l3419
+l2134:     lui $a2, %hi(d3146)
+l2135:     ori $a3, $a3, %lo(d2873)
+l2136:     beq $t6, $s0, l2600
+l2137:     j l2327
+l2138:     lui $a2, %hi(d2054)
+l2139:     ori $a3, $a3, %lo(d1781)
+l2140:     beq $t0, $s4, l1508
+l2141:     j l1235
+l2142:     lui $a2, %hi(d962)
+l2143:     ori $a3, $a3, %lo(d689)
+l2144:     beq $t4, $s0, l416
+l2145:     j l143
+l2146:     lui $a2, %hi(d3966)
+l2147:     ori $a3, $a3, %lo(d3693)
+l2148:     beq $t8, $s4, l3420
+l2149:     j l3147
+l2150:     lui $a2, %hi(d2874)
+l2151:     ori $a3, $a3, %lo(d2601)
+l2152:     beq $t2, $s0, l2328
+l2153:     j l2055
+l2154:     lui $a2, %hi(d1782)
+l2155:     ori $a3, $a3, %lo(d1509)
+l2156:     beq $t6, $s4, l1236
+l2157:     j l963
+l2158:     lui $a2, %hi(d690)
+l2159:     ori $a3, $a3, %lo(d417)
+l2160:     beq $t0, $s0, l144
+l2161:     j l3967
+l2162:     lui $a2, %hi(d3694)
+l2163:     ori $a3, $a3, %lo(d3421)
+l2164:     beq $t4, $s4, l3148
+l2165:     j l2875
+l2166:     lui $a2, %hi(d2602)
+l2167:     ori $a3, $a3, %lo(d2329)
+l2168:     beq $t8, $s0, l2056
+l2169:     j l1783
+l2170:     lui $a2, %hi(d1510)
+l2171:     ori $a3, $a3, %lo(d1237)
+l2172:     beq $t2, $s4, l964
+l2173:     j l691
+l2174:     lui $a2, %hi(d418)
+l2175:     ori $a3, $a3, %lo(d145)
+l2176:     beq $t6, $s0, l3968
+l2177:     j l3695
+l2178:     lui $a2, %hi(d3422)
+l2179:     ori $a3, $a3, %lo(d3149)
+l2180:     beq $t0, $s4, l2876
+l2181:     j l2603
+l2182:     lui $a2, %hi(d2330)
+l2183:     ori $a3, $a3, %lo(d2057)
+l2184:     beq $t4, $s0, l1784
+l2185:     j l1511
+l2186:     lui $a2, %hi(d1238)
+l2187:     ori $a3, $a3, %lo(d965)
+l2188:     beq $t8, $s4, l692
+l2189:     j l419
+l2190:     lui $a2, %hi(d146)
+l2191:     ori $a3, $a3, %lo(d3969)
+l2192:     beq $t2, $s0, l3696
+l2193:     j l3423
+l2194:     lui $a2, %hi(d3150)
+l2195:     ori $a3, $a3, %lo(d2877)
+l2196:     beq $t6, $s4, l2604
+l2197:     j l2331
+l2198:     lui $a2, %hi(d2058)
+l2199:     ori $a3, $a3, %lo(d1785)
+l2200:     beq $t0, $s0, l1512
+l2201:     j l1239
+l2202:     lui $a2, %hi(d966)
+l2203:     ori $a3, $a3, %lo(d693)
+l2204:     beq $t4, $s4, l420
+l2205:     j l147
+l2206:     lui $a2, %hi(d3970)
+l2207:     ori $a3, $a3, %lo(d3697)
+l2208:     beq $t8, $s0, l3424
+l2209:     j l3151
+l2210:     lui $a2, %hi(d2878)
+l2211:     ori $a3, $a3, %lo(d2605)
+l2212:     beq $t2, $s4, l2332
+l2213:     j l2059
+l2214:     lui $a2, %hi(d1786)
+l2215:     ori $a3, $a3, %lo(d1513)
+l2216:     beq $t6, $s0, l1240
+l2217:     j l967
+l2218:     lui $a2, %hi(d694)
+l2219:     ori $a3, $a3, %lo(d421)
+l2220:     beq $t0, $s4, l148
+l2221:     j l3971
+l2222:     lui $a2, %hi(d3698)
+l2223:     ori $a3, $a3, %lo(d3425)
+l2224:     beq $t4, $s0, l3152
+l2225:     j l2879
+l2226:     lui $a2, %hi(d2606)
+l2227:     ori $a3, $a3, %lo(d2333)
+l2228:     beq $t8, $s4, l2060
+l2229:     j l1787
+l2230:     lui $a2, %hi(d1514)
+l2231:     ori $a3, $a3, %lo(d1241)
+l2232:     beq $t2, $s0, l968
+l2233:     j l695
+l2234:     lui $a2, %hi(d422)
+l2235:     ori $a3, $a3, %lo(d149)
+l2236:     beq $t6, $s4, l3972
+l2237:     j l3699
+l2238:     lui $a2, %hi(d3426)
+l2239:     ori $a3, $a3, %lo(d3153)
+l2240:     beq $t0, $s0, l2880
+l2241:     j l2607
+l2242:     lui $a2, %hi(d2334)
+l2243:     ori $a3, $a3, %lo(d2061)
+l2244:     beq $t4, $s4, l1788
+l2245:     j l1515
+l2246:     lui $a2, %hi(d1242)
+l2247:     ori $a3, $a3, %lo(d969)
+l2248:     beq $t8, $s0, l696
+l2249:     j l423
+l2250:     lui $a2, %hi(d150)
+l2251:     ori $a3, $a3, %lo(d3973)
+l2252:     beq $t2, $s4, l3700
+l2253:     j l3427
+l2254:     lui $a2, %hi(d3154)
+l2255:     ori $a3, $a3, %lo(d2881)
+l2256:     beq $t6, $s0, l2608
+l2257:     j l2335
+l2258:     lui $a2, %hi(d2062)
+l2259:     ori $a3, $a3, %lo(d1789)
+l2260:     beq $t0, $s4, l1516
+l2261:     j l1243
+l2262:     lui $a2, %hi(d970)
+l2263:     ori $a3, $a3, %lo(d697)
+l2264:     beq $t4, $s0, l424
+l2265:     j l151
+l2266:     lui $a2, %hi(d3974)
+l2267:     ori $a3, $a3, %lo(d3701)
+l2268:     beq $t8, $s4, l3428
+l2269:     j l3155
+l2270:     lui $a2, %hi(d2882)
+l2271:     ori $a3, $a3, %lo(d2609)
+l2272:     beq $t2, $s0, l2336
+l2273:     j l2063
+l2274:     lui $a2, %hi(d1790)
+l2275:     ori $a3, $a3, %lo(d1517)
+l2276:     beq $t6, $s4, l1244
+l2277:     j l971
+l2278:     lui $a2, %hi(d698)
+l2279:     ori $a3, $a3, %lo(d425)
+l2280:     beq $t0, $s0, l152
+l2281:     j l3975
+l2282:     lui $a2, %hi(d3702)
+l2283:     ori $a3, $a3, %lo(d3429)
+l2284:     beq $t4, $s4, l3156
+l2285:     j l2883
+l2286:     lui $a2, %hi(d2610)
+l2287:     ori $a3, $a3, %lo(d2337)
+l2288:     beq $t8, $s0, l2064
+l2289:     j l1791
+l2290:     lui $a2, %hi(d1518)
+l2291:     ori $a3, $a3, %lo(d1245)
+l2292:     beq $t2, $s4, l972
+l2293:     j l699
+l2294:     lui $a2, %hi(d426)
+l2295:     ori $a3, $a3, %lo(d153)
+l2296:     beq $t6, $s0, l3976
+l2297:     j l3703
+l2298:     lui $a2, %hi(d3430)
+l2299:     ori $a3, $a3, %lo(d3157)
+l2300:     beq $t0, $s4, l2884
+l2301:     j l2611
+l2302:     lui $a2, %hi(d2338)
+l2303:     ori $a3, $a3, %lo(d2065)
+l2304:     beq $t4, $s0, l1792
+l2305:     j l1519
+l2306:     lui $a2, %hi(d1246)
+l2307:     ori $a3, $a3, %lo(d973)
+l2308:     beq $t8, $s4, l700
+l2309:     j l427
+l2310:     lui $a2, %hi(d154)
+l2311:     ori $a3, $a3, %lo(d3977)
+l2312:     beq $t2, $s0, l3704
+l2313:     j l3431
+l2314:     lui $a2, %hi(d3158)
+l2315:     ori $a3, $a3, %lo(d2885)
+l2316:     beq $t6, $s4, l2612
+l2317:     j l2339
+l2318:     lui $a2, %hi(d2066)
+l2319:     ori $a3, $a3, %lo(d1793)
+l2320:     beq $t0, $s0, l1520
+l2321:     j l1247
+l2322:     lui $a2, %hi(d974)
+l2323:     ori $a3, $a3, %lo(d701)
+l2324:     beq $t4, $s4, l428
+l2325:     j l155
+l2326:     lui $a2, %hi(d3978)
+l2327:     ori $a3, $a3, %lo(d3705)
+l2328:     beq $t8, $s0, l3432
+l2329:     j l3159
+l2330:     lui $a2, %hi(d2886)
+l2331:     ori $a3, $a3, %lo(d2613)
+l2332:     beq $t2, $s4, l2340
+l2333:     j l2067
+l2334:     lui $a2, %hi(d1794)
+l2335:     ori $a3, $a3, %lo(d1521)
+l2336:     beq $t6, $s0, l1248
+l2337:     j l975
+l2338:     lui $a2, %hi(d702)
+l2339:     ori $a3, $a3, %lo(d429)
+l2340:     beq $t0, $s4, l156
+l2341:     j l3979
+l2342:     lui $a2, %hi(d3706)
+l2343:     ori $a3, $a3, %lo(d3433)
+l2344:     beq $t4, $s0, l3160
+l2345:     j l2887
+l2346:     lui $a2, %hi(d2614)
+l2347:     ori $a3, $a3, %lo(d2341)
+l2348:     beq $t8, $s4, l2068
+l2349:     j l1795
+l2350:     lui $a2, %hi(d1522)
+l2351:     ori $a3, $a3, %lo(d1249)
+l2352:     beq $t2, $s0, l976
+l2353:     j l703
+l2354:     lui $a2, %hi(d430)
+l2355:     ori $a3, $a3, %lo(d157)
+l2356:     beq $t6, $s4, l3980
+l2357:     j l3707
+l2358:     lui $a2, %hi(d3434)
+l2359:     ori $a3, $a3, %lo(d3161)
+l2360:     beq $t0, $s0, l2888
+l2361:     j l2615
+l2362:     lui $a2, %hi(d2342)
+l2363:     ori $a3, $a3, %lo(d2069)
+l2364:     beq $t4, $s4, l1796
+l2365:     j l1523
+l2366:     lui $a2, %hi(d1250)
+l2367:     ori $a3, $a3, %lo(d977)
+l2368:     beq $t8, $s0, l704
+l2369:     j l431
+l2370:     lui $a2, %hi(d158)
+l2371:     ori $a3, $a3, %lo(d3981)
+l2372:     beq $t2, $s4, l3708
+l2373:     j l3435
+l2374:     lui $a2, %hi(d3162)
+l2375:     ori $a3, $a3, %lo(d2889)
+l2376:     beq $t6, $s0, l2616
+l2377:     j l2343
+l2378:     lui $a2, %hi(d2070)
+l2379:     ori $a3, $a3, %lo(d1797)
+l2380:     beq $t0, $s4, l1524
+l2381:     j l1251
+l2382:     lui $a2, %hi(d978)
+l2383:     ori $a3, $a3, %lo(d705)
+l2384:     beq $t4, $s0, l432
+l2385:     j l159
+l2386:     lui $a2, %hi(d3982)
+l2387:     ori $a3, $a3, %lo(d3709)
+l2388:     beq $t8, $s4, l3436
+l2389:     j l3163
+l2390:     lui $a2, %hi(d2890)
+l2391:     ori $a3, $a3, %lo(d2617)
+l2392:     beq $t2, $s0, l2344
+l2393:     j l2071
+l2394:     lui $a2, %hi(d1798)
+l2395:     ori $a3, $a3, %lo(d1525)
+l2396:     beq $t6, $s4, l1252
+l2397:     j l979
+l2398:     lui $a2, %hi(d706)
+l2399:     ori $a3, $a3, %lo(d433)
+l2400:     beq $t0, $s0, l160
+l2401:     j l3983
+l2402:     lui $a2, %hi(d3710)
+l2403:     ori $a3, $a3, %lo(d3437)
+l2404:     beq $t4, $s4, l3164
+l2405:     j l2891
+l2406:     lui $a2, %hi(d2618)
+l2407:     ori $a3, $a3, %lo(d2345)
+l2408:     beq $t8, $s0, l2072
+l2409:     j l1799
+l2410:     lui $a2, %hi(d1526)
+l2411:     ori $a3, $a3, %lo(d1253)
+l2412:     beq $t2, $s4, l980
+l2413:     j l707
+l2414:     lui $a2, %hi(d434)
+l2415:     ori $a3, $a3, %lo(d161)
+l2416:     beq $t6, $s0, l3984
+l2417:     j l3711
+l2418:     lui $a2, %hi(d3438)
+l2419:     ori $a3, $a3, %lo(d3165)
+l2420:     beq $t0, $s4, l2892
+l2421:     j l2619
+l2422:     lui $a2, %hi(d2346)
+l2423:     ori $a3, $a3, %lo(d2073)
+l2424:     beq $t4, $s0, l1800
+l2425:     j l1527
+l2426:     lui $a2, %hi(d1254)
+l2427:     ori $a3, $a3, %lo(d981)
+l2428:     beq $t8, $s4, l708
+l2429:     j l435
+l2430:     lui $a2, %hi(d162)
+l2431:     ori $a3, $a3, %lo(d3985)
+l2432:     beq $t2, $s0, l3712
+l2433:     j l3439
+l2434:     lui $a2, %hi(d3166)
+l2435:     ori $a3, $a3, %lo(d2893)
+l2436:     beq $t6, $s4, l2620
+l2437:     j l2347
+l2438:     lui $a2, %hi(d2074)
+l2439:     ori $a3, $a3, %lo(d1801)
+l2440:     beq $t0, $s0, l1528
+l2441:     j l1255
+l2442:     lui $a2, %hi(d982)
+l2443:     ori $a3, $a3, %lo(d709)
+l2444:     beq $t4, $s4, l436
+l2445:     j l163
+l2446:     lui $a2, %hi(d3986)
+l2447:     ori $a3, $a3, %lo(d3713)
+l2448:     beq $t8, $s0, l3440
+l2449:     j l3167
+l2450:     lui $a2, %hi(d2894)
+l2451:     ori $a3, $a3, %lo(d2621)
+l2452:     beq $t2, $s4, l2348
+l2453:     j l2075
+l2454:     lui $a2, %hi(d1802)
+l2455:     ori $a3, $a3, %lo(d1529)
+l2456:     beq $t6, $s0, l1256
+l2457:     j l983
+l2458:     lui $a2, %hi(d710)
+l2459:     ori $a3, $a3, %lo(d437)
+l2460:     beq $t0, $s4, l164
+l2461:     j l3987
+l2462:     lui $a2, %hi(d3714)
+l2463:     ori $a3, $a3, %lo(d3441)
+l2464:     beq $t4, $s0, l3168
+l2465:     j l2895
+l2466:     lui $a2, %hi(d2622)
+l2467:     ori $a3, $a3, %lo(d2349)
+l2468:     beq $t8, $s4, l2076
+l2469:     j l1803
+l2470:     lui $a2, %hi(d1530)
+l2471:     ori $a3, $a3, %lo(d1257)
+l2472:     beq $t2, $s0, l984
+l2473:     j l711
+l2474:     lui $a2, %hi(d438)
+l2475:     ori $a3, $a3, %lo(d165)
+l2476:     beq $t6, $s4, l3988
+l2477:     j l3715
+l2478:     lui $a2, %hi(d3442)
+l2479:     ori $a3, $a3, %lo(d3169)
+l2480:     beq $t0, $s0, l2896
+l2481:     j l2623
+l2482:     lui $a2, %hi(d2350)
+l2483:     ori $a3, $a3, %lo(d2077)
+l2484:     beq $t4, $s4, l1804
+l2485:     j l1531
+l2486:     lui $a2, %hi(d1258)
+l2487:     ori $a3, $a3, %lo(d985)
+l2488:     beq $t8, $s0, l712
+l2489:     j l439
+l2490:     lui $a2, %hi(d166)
+l2491:     ori $a3, $a3, %lo(d3989)
+l2492:     beq $t2, $s4, l3716
+l2493:     j l3443
+l2494:     lui $a2, %hi(d3170)
+l2495:     ori $a3, $a3, %lo(d2897)
+l2496:     beq $t6, $s0, l2624
+l2497:     j l2351
+l2498:     lui $a2, %hi(d2078)
+l2499:     ori $a3, $a3, %lo(d1805)
+l2500:     beq $t0, $s4, l1532
+l2501:     j l1259
+l2502:     lui $a2, %hi(d986)
+l2503:     ori $a3, $a3, %lo(d713)
+l2504:     beq $t4, $s0, l440
+l2505:     j l167
+l2506:     lui $a2, %hi(d3990)
+l2507:     ori $a3, $a3, %lo(d3717)
+l2508:     beq $t8, $s4, l3444
+l2509:     j l3171
+l2510:     lui $a2, %hi(d2898)
+l2511:     ori $a3, $a3, %lo(d2625)
+l2512:     beq $t2, $s0, l2352
+l2513:     j l2079
+l2514:     lui $a2, %hi(d1806)
+l2515:     ori $a3, $a3, %lo(d1533)
+l2516:     beq $t6, $s4, l1260
+l2517:     j l987
+l2518:     lui $a2, %hi(d714)
+l2519:     ori $a3, $a3, %lo(d441)
+l2520:     beq $t0, $s0, l168
+l2521:     j l3991
+l2522:     lui $a2, %hi(d3718)
+l2523:     ori $a3, $a3, %lo(d3445)
+l2524:     beq $t4, $s4, l3172
+l2525:     j l2899
+l2526:     lui $a2, %hi(d2626)
+l2527:     ori $a3, $a3, %lo(d2353)
+l2528:     beq $t8, $s0, l2080
+l2529:     j l1807
+l2530:     lui $a2, %hi(d1534)
+l2531:     ori $a3, $a3, %lo(d1261)
+l2532:     beq $t2, $s4, l988
+l2533:     j l715
+l2534:     lui $a2, %hi(d442)
+l2535:     ori $a3, $a3, %lo(d169)
+l2536:     beq $t6, $s0, l3992
+l2537:     j l3719
+l2538:     lui $a2, %hi(d3446)
+l2539:     ori $a3, $a3, %lo(d3173)
+l2540:     beq $t0, $s4, l2900
+l2541:     j l2627
+l2542:     lui $a2, %hi(d2354)
+l2543:     ori $a3, $a3, %lo(d2081)
+l2544:     beq $t4, $s0, l1808
+l2545:     j l1535
+l2546:     lui $a2, %hi(d1262)
+l2547:     ori $a3, $a3, %lo(d989)
+l2548:     beq $t8, $s4, l716
+l2549:     j l443
+l2550:     lui $a2, %hi(d170)
+l2551:     ori $a3, $a3, %lo(d3993)
+l2552:     beq $t2, $s0, l3720
+l2553:     j l3447
+l2554:     lui $a2, %hi(d3174)
+l2555:     ori $a3, $a3, %lo(d2901)
+l2556:     beq $t6, $s4, l2628
+l2557:     j l2355
+l2558:     lui $a2, %hi(d2082)
+l2559:     ori $a3, $a3, %lo(d1809)
+l2560:     beq $t0, $s0, l1536
+l2561:     j l1263
+l2562:     lui $a2, %hi(d990)
+l2563:     ori $a3, $a3, %lo(d717)
+l2564:     beq $t4, $s4, l444
+l2565:     j l171
+l2566:     lui $a2, %hi(d3994)
+l2567:     ori $a3, $a3, %lo(d3721)
+l2568:     beq $t8, $s0, l3448
+l2569:     j l3175
+l2570:     lui $a2, %hi(d2902)
+l2571:     ori $a3, $a3, %lo(d2629)
+l2572:     beq $t2, $s4, l2356
+l2573:     j l2083
+l2574:     lui $a2, %hi(d1810)
+l2575:     ori $a3, $a3, %lo(d1537)
+l2576:     beq $t6, $s0, l1264
+l2577:     j l991
+l2578:     lui $a2, %hi(d718)
+l2579:     ori $a3, $a3, %lo(d445)
+l2580:     beq $t0, $s4, l172
+l2581:     j l3995
+l2582:     lui $a2, %hi(d3722)
+l2583:     ori $a3, $a3, %lo(d3449)
+l2584:     beq $t4, $s0, l3176
+l2585:     j l2903
+l2586:     lui $a2, %hi(d2630)
+l2587:     ori $a3, $a3, %lo(d2357)
+l2588:     beq $t8, $s4, l2084
+l2589:     j l1811
+l2590:     lui $a2, %hi(d1538)
+l2591:     ori $a3, $a3, %lo(d1265)
+l2592:     beq $t2, $s0, l992
+l2593:     j l719
+l2594:     lui $a2, %hi(d446)
+l2595:     ori $a3, $a3, %lo(d173)
+l2596:     beq $t6, $s4, l3996
+l2597:     j l3723
+l2598:     lui $a2, %hi(d3450)
+l2599:     ori $a3, $a3, %lo(d3177)
+l2600:     beq $t0, $s0, l2904
+l2601:     j l2631
+l2602:     lui $a2, %hi(d2358)
+l2603:     ori $a3, $a3, %lo(d2085)
+l2604:     beq $t4, $s4, l1812
+l2605:     j l1539
+l2606:     lui $a2, %hi(d1266)
+l2607:     ori $a3, $a3, %lo(d993)
+l2608:     beq $t8, $s0, l720
+l2609:     j l447
+l2610:     lui $a2, %hi(d174)
+l2611:     ori $a3, $a3, %lo(d3997)
+l2612:     beq $t2, $s4, l3724
+l2613:     j l3451
+l2614:     lui $a2, %hi(d3178)
+l2615:     ori $a3, $a3, %lo(d2905)
+l2616:     beq $t6, $s0, l2632
+l2617:     j l2359
+l2618:     lui $a2, %hi(d2086)
+l2619:     ori $a3, $a3, %lo(d1813)
+l2620:     beq $t0, $s4, l1540
+l2621:     j l1267
+l2622:     lui $a2, %hi(d994)
+l2623:     ori $a3, $a3, %lo(d721)
+l2624:     beq $t4, $s0, l448
+l2625:     j l175
+l2626:     lui $a2, %hi(d3998)
+l2627:     ori $a3, $a3, %lo(d3725)
+l2628:     beq $t8, $s4, l3452
+l2629:     j l3179
+l2630:     lui $a2, %hi(d2906)
+l2631:     ori $a3, $a3, %lo(d2633)
+l2632:     beq $t2, $s0, l2360
+l2633:     j l2087
+l2634:     lui $a2, %hi(d1814)
+l2635:     ori $a3, $a3, %lo(d1541)
+l2636:     beq $t6, $s4, l1268
+l2637:     j l995
+l2638:     lui $a2, %hi(d722)
+l2639:     ori $a3, $a3, %lo(d449)
+l2640:     beq $t0, $s0, l176
+l2641:     j l3999
+l2642:     lui $a2, %hi(d3726)
+l2643:     ori $a3, $a3, %lo(d3453)
+l2644:     beq $t4, $s4, l3180
+l2645:     j l2907
+l2646:     lui $a2, %hi(d2634)
+l2647:     ori $a3, $a3, %lo(d2361)
+l2648:     beq $t8, $s0, l2088
+l2649:     j l1815
+l2650:     lui $a2, %hi(d1542)
+l2651:     ori $a3, $a3, %lo(d1269)
+l2652:     beq $t2, $s4, l996
+l2653:     j l723
+l2654:     lui $a2, %hi(d450)
+l2655:     ori $a3, $a3, %lo(d177)
+l2656:     beq $t6, $s0, l4000
+l2657:     j l3727
+l2658:     lui $a2, %hi(d3454)
+l2659:     ori $a3, $a3, %lo(d3181)
+l2660:     beq $t0, $s4, l2908
+l2661:     j l2635
+l2662:     lui $a2, %hi(d2362)
+l2663:     ori $a3, $a3, %lo(d2089)
+l2664:     beq $t4, $s0, l1816
+l2665:     j l1543
+l2666:     lui $a2, %hi(d1270)
+l2667:     ori $a3, $a3, %lo(d997)
+l2668:     beq $t8, $s4, l724
+l2669:     j l451
+l2670:     lui $a2, %hi(d178)
+l2671:     ori $a3, $a3, %lo(d4001)
+l2672:     beq $t2, $s0, l3728
+l2673:     j l3455
+l2674:     lui $a2, %hi(d3182)
+l2675:     ori $a3, $a3, %lo(d2909)
+l2676:     beq $t6, $s4, l2636
+l2677:     j l2363
+l2678:     lui $a2, %hi(d2090)
+l2679:     ori $a3, $a3, %lo(d1817)
+l2680:     beq $t0, $s0, l1544
+l2681:     j l1271
+l2682:     lui $a2, %hi(d998)
+l2683:     ori $a3, $a3, %lo(d725)
+l2684:     beq $t4, $s4, l452
+l2685:     j l179
+l2686:     lui $a2, %hi(d4002)
+l2687:     ori $a3, $a3, %lo(d3729)
+l2688:     beq $t8, $s0, l3456
+l2689:     j l3183
+l2690:     lui $a2, %hi(d2910)
+l2691:     ori $a3, $a3, %lo(d2637)
+l2692:     beq $t2, $s4, l2364
+l2693:     j l2091
+l2694:     lui $a2, %hi(d1818)
+l2695:     ori $a3, $a3, %lo(d1545)
+l2696:     beq $t6, $s0, l1272
+l2697:     j l999
+l2698:     lui $a2, %hi(d726)
+l2699:     ori $a3, $a3, %lo(d453)
+l2700:     beq $t0, $s4, l180
+l2701:     j l4003
+l2702:     lui $a2, %hi(d3730)
+l2703:     ori $a3, $a3, %lo(d3457)
+l2704:     beq $t4, $s0, l3184
+l2705:     j l2911
+l2706:     lui $a2, %hi(d2638)
+l2707:     ori $a3, $a3, %lo(d2365)
+l2708:     beq $t8, $s4, l2092
+l2709:     j l1819
+l2710:     lui $a2, %hi(d1546)
+l2711:     ori $a3, $a3, %lo(d1273)
+l2712:     beq $t2, $s0, l1000
+l2713:     j l727
+l2714:     lui $a2, %hi(d454)
+l2715:     ori $a3, $a3, %lo(d181)
+l2716:     beq $t6, $s4, l4004
+l2717:     j l3731
+l2718:     lui $a2, %hi(d3458)
+l2719:     ori $a3, $a3, %lo(d3185)
+l2720:     beq $t0, $s0, l2912
+l2721:     j l2639
+l2722:     lui $a2, %hi(d2366)
+l2723:     ori $a3, $a3, %lo(d2093)
+l2724:     beq $t4, $s4, l1820
+l2725:     j l1547
+l2726:     lui $a2, %hi(d1274)
+l2727:     ori $a3, $a3, %lo(d1001)
+l2728:     beq $t8, $s0, l728
+l2729:     j l455
+l2730:     lui $a2, %hi(d182)
+l2731:     ori $a3, $a3, %lo(d4005)
+l2732:     beq $t2, $s4, l3732
+l2733:     j l3459
+l2734:     lui $a2, %hi(d3186)
+l2735:     ori $a3, $a3, %lo(d2913)
+l2736:     beq $t6, $s0, l2640
+l2737:     j l2367
+l2738:     lui $a2, %hi(d2094)
+l2739:     ori $a3, $a3, %lo(d1821)
+l2740:     beq $t0, $s4, l1548
+l2741:     j l1275
+l2742:     lui $a2, %hi(d1002)
+l2743:     ori $a3, $a3, %lo(d729)
+l2744:     beq $t4, $s0, l456
+l2745:     j l183
+l2746:     lui $a2, %hi(d4006)
+l2747:     ori $a3, $a3, %lo(d3733)
+l2748:     beq $t8, $s4, l3460
+l2749:     j l3187
+l2750:     lui $a2, %hi(d2914)
+l2751:     ori $a3, $a3, %lo(d2641)
+l2752:     beq $t2, $s0, l2368
+l2753:     j l2095
+l2754:     lui $a2, %hi(d1822)
+l2755:     ori $a3, $a3, %lo(d1549)
+l2756:     beq $t6, $s4, l1276
+l2757:     j l1003
+l2758:     lui $a2, %hi(d730)
+l2759:     ori $a3, $a3, %lo(d457)
+l2760:     beq $t0, $s0, l184
+l2761:     j l4007
+l2762:     lui $a2, %hi(d3734)
+l2763:     ori $a3, $a3, %lo(d3461)
+l2764:     beq $t4, $s4, l3188
+l2765:     j l2915
+l2766:     lui $a2, %hi(d2642)
+l2767:     ori $a3, $a3, %lo(d2369)
+l2768:     beq $t8, $s0, l2096
+l2769:     j l1823
+l2770:     lui $a2, %hi(d1550)
+l2771:     ori $a3, $a3, %lo(d1277)
+l2772:     beq $t2, $s4, l1004
+l2773:     j l731
+l2774:     lui $a2, %hi(d458)
+l2775:     ori $a3, $a3, %lo(d185)
+l2776:     beq $t6, $s0, l4008
+l2777:     j l3735
+l2778:     lui $a2, %hi(d3462)
+l2779:     ori $a3, $a3, %lo(d3189)
+l2780:     beq $t0, $s4, l2916
+l2781:     j l2643
+l2782:     lui $a2, %hi(d2370)
+l2783:     ori $a3, $a3, %lo(d2097)
+l2784:     beq $t4, $s0, l1824
+l2785:     j l1551
+l2786:     lui $a2, %hi(d1278)
+l2787:     ori $a3, $a3, %lo(d1005)
+l2788:     beq $t8, $s4, l732
+l2789:     j l459
+l2790:     lui $a2, %hi(d186)
+l2791:     ori $a3, $a3, %lo(d4009)
+l2792:     beq $t2, $s0, l3736
+l2793:     j l3463
+l2794:     lui $a2, %hi(d3190)
+l2795:     ori $a3, $a3, %lo(d2917)
+l2796:     beq $t6, $s4, l2644
+l2797:     j l2371
+l2798:     lui $a2, %hi(d2098)
+l2799:     ori $a3, $a3, %lo(d1825)
+l2800:     beq $t0, $s0, l1552
+l2801:     j l1279
+l2802:     lui $a2, %hi(d1006)
+l2803:     ori $a3, $a3, %lo(d733)
+l2804:     beq $t4, $s4, l460
+l2805:     j l187
+l2806:     lui $a2, %hi(d4010)
+l2807:     ori $a3, $a3, %lo(d3737)
+l2808:     beq $t8, $s0, l3464
+l2809:     j l3191
+l2810:     lui $a2, %hi(d2918)
+l2811:     ori $a3, $a3, %lo(d2645)
+l2812:     beq $t2, $s4, l2372
+l2813:     j l2099
+l2814:     lui $a2, %hi(d1826)
+l2815:     ori $a3, $a3, %lo(d1553)
+l2816:     beq $t6, $s0, l1280
+l2817:     j l1007
+l2818:     lui $a2, %hi(d734)
+l2819:     ori $a3, $a3, %lo(d461)
+l2820:     beq $t0, $s4, l188
+l2821:     j l4011
+l2822:     lui $a2, %hi(d3738)
+l2823:     ori $a3, $a3, %lo(d3465)
+l2824:     beq $t4, $s0, l3192
+l2825:     j l2919
+l2826:     lui $a2, %hi(d2646)
+l2827:     ori $a3, $a3, %lo(d2373)
+l2828:     beq $t8, $s4, l2100
+l2829:     j l1827
+l2830:     lui $a2, %hi(d1554)
+l2831:     ori $a3, $a3, %lo(d1281)
+l2832:     beq $t2, $s0, l1008
+l2833:     j l735
+l2834:     lui $a2, %hi(d462)
+l2835:     ori $a3, $a3, %lo(d189)
+l2836:     beq $t6, $s4, l4012
+l2837:     j l3739
+l2838:     lui $a2, %hi(d3466)
+l2839:     ori $a3, $a3, %lo(d3193)
+l2840:     beq $t0, $s0, l2920
+l2841:     j l2647
+l2842:     lui $a2, %hi(d2374)
+l2843:     ori $a3, $a3, %lo(d2101)
+l2844:     beq $t4, $s4, l1828
+l2845:     j l1555
+l2846:     lui $a2, %hi(d1282)
+l2847:     ori $a3, $a3, %lo(d1009)
+l2848:     beq $t8, $s0, l736
+l2849:     j l463
+l2850:     lui $a2, %hi(d190)
+l2851:     ori $a3, $a3, %lo(d4013)
+l2852:     beq $t2, $s4, l3740
+l2853:     j l3467
+l2854:     lui $a2, %hi(d3194)
+l2855:     ori $a3, $a3, %lo(d2921)
+l2856:     beq $t6, $s0, l2648
+l2857:     j l2375
+l2858:     lui $a2, %hi(d2102)
+l2859:     ori $a3, $a3, %lo(d1829)
+l2860:     beq $t0, $s4, l1556
+l2861:     j l1283
+l2862:     lui $a2, %hi(d1010)
+l2863:     ori $a3, $a3, %lo(d737)
+l2864:     beq $t4, $s0, l464
+l2865:     j l191
+l2866:     lui $a2, %hi(d4014)
+l2867:     ori $a3, $a3, %lo(d3741)
+l2868:     beq $t8, $s4, l3468
+l2869:     j l3195
+l2870:     lui $a2, %hi(d2922)
+l2871:     ori $a3, $a3, %lo(d2649)
+l2872:     beq $t2, $s0, l2376
+l2873:     j l2103
+l2874:     lui $a2, %hi(d1830)
+l2875:     ori $a3, $a3, %lo(d1557)
+l2876:     beq $t6, $s4, l1284
+l2877:     j l1011
+l2878:     lui $a2, %hi(d738)
+l2879:     ori $a3, $a3, %lo(d465)
+l2880:     beq $t0, $s0, l192
+l2881:     j l4015
+l2882:     lui $a2, %hi(d3742)
+l2883:     ori $a3, $a3, %lo(d3469)
+l2884:     beq $t4, $s4, l3196
+l2885:     j l2923
+l2886:     lui $a2, %hi(d2650)
+l2887:     ori $a3, $a3, %lo(d2377)
+l2888:     beq $t8, $s0, l2104
+l2889:     j l1831
+l2890:     lui $a2, %hi(d1558)
+l2891:     ori $a3, $a3, %lo(d1285)
+l2892:     beq $t2, $s4, l1012
+l2893:     j l739
+l2894:     lui $a2, %hi(d466)
+l2895:     ori $a3, $a3, %lo(d193)
+l2896:     beq $t6, $s0, l4016
+l2897:     j l3743
+l2898:     lui $a2, %hi(d3470)
+l2899:     ori $a3, $a3, %lo(d3197)
+l2900:     beq $t0, $s4, l2924
+l2901:     j l2651
+l2902:     lui $a2, %hi(d2378)
+l2903:     ori $a3, $a3, %lo(d2105)
+l2904:     beq $t4, $s0, l1832
+l2905:     j l1559
+l2906:     lui $a2, %hi(d1286)
+l2907:     ori $a3, $a3, %lo(d1013)
+l2908:     beq $t8, $s4, l740
+l2909:     j l467
+l2910:     lui $a2, %hi(d194)
+l2911:     ori $a3, $a3, %lo(d4017)
+l2912:     beq $t2, $s0, l3744
+l2913:     j l3471
+l2914:     lui $a2, %hi(d3198)
+l2915:     ori $a3, $a3, %lo(d2925)
+l2916:     beq $t6, $s4, l2652
+l2917:     j l2379
+l2918:     lui $a2, %hi(d2106)
+l2919:     ori $a3, $a3, %lo(d1833)
+l2920:     beq $t0, $s0, l1560
+l2921:     j l1287
+l2922:     lui $a2, %hi(d1014)
+l2923:     ori $a3, $a3, %lo(d741)
+l2924:     beq $t4, $s4, l468
+l2925:     j l195
+l2926:     lui $a2, %hi(d4018)
+l2927:     ori $a3, $a3, %lo(d3745)
+l2928:     beq $t8, $s0, l3472
+l2929:     j l3199
+l2930:     lui $a2, %hi(d2926)
+l2931:     ori $a3, $a3, %lo(d2653)
+l2932:     beq $t2, $s4, l2380
+l2933:     j l2107
+l2934:     lui $a2, %hi(d1834)
+l2935:     ori $a3, $a3, %lo(d1561)
+l2936:     beq $t6, $s0, l1288
+l2937:     j l1015
+l2938:     lui $a2, %hi(d742)
+l2939:     ori $a3, $a3, %lo(d469)
+l2940:     beq $t0, $s4, l196
+l2941:     j l4019
+l2942:     lui $a2, %hi(d3746)
+l2943:     ori $a3, $a3, %lo(d3473)
+l2944:     beq $t4, $s0, l3200
+l2945:     j l2927
+l2946:     lui $a2, %hi(d2654)
+l2947:     ori $a3, $a3, %lo(d2381)
+l2948:     beq $t8, $s4, l2108
+l2949:     j l1835
+l2950:     lui $a2, %hi(d1562)
+l2951:     ori $a3, $a3, %lo(d1289)
+l2952:     beq $t2, $s0, l1016
+l2953:     j l743
+l2954:     lui $a2, %hi(d470)
+l2955:     ori $a3, $a3, %lo(d197)
+l2956:     beq $t6, $s4, l4020
+l2957:     j l3747
+l2958:     lui $a2, %hi(d3474)
+l2959:     ori $a3, $a3, %lo(d3201)
+l2960:     beq $t0, $s0, l2928
+l2961:     j l2655
+l2962:     lui $a2, %hi(d2382)
+l2963:     ori $a3, $a3, %lo(d2109)
+l2964:     beq $t4, $s4, l1836
+l2965:     j l1563
+l2966:     lui $a2, %hi(d1290)
+l2967:     ori $a3, $a3, %lo(d1017)
+l2968:     beq $t8, $s0, l744
+l2969:     j l471
+l2970:     lui $a2, %hi(d198)
+l2971:     ori $a3, $a3, %lo(d4021)
+l2972:     beq $t2, $s4, l3748
+l2973:     j l3475
+l2974:     lui $a2, %hi(d3202)
+l2975:     ori $a3, $a3, %lo(d2929)
+l2976:     beq $t6, $s0, l2656
+l2977:     j l2383
+l2978:     lui $a2, %hi(d2110)
+l2979:     ori $a3, $a3, %lo(d1837)
+l2980:     beq $t0, $s4, l1564
+l2981:     j l1291
+l2982:     lui $a2, %hi(d1018)
+l2983:     ori $a3, $a3, %lo(d745)
+l2984:     beq $t4, $s0, l472
+l2985:     j l199
+l2986:     lui $a2, %hi(d4022)
+l2987:     ori $a3, $a3, %lo(d3749)
+l2988:     beq $t8, $s4, l3476
+l2989:     j l3203
+l2990:     lui $a2, %hi(d2930)
+l2991:     ori $a3, $a3, %lo(d2657)
+l2992:     beq $t2, $s0, l2384
+l2993:     j l2111
+l2994:     lui $a2, %hi(d1838)
+l2995:     ori $a3, $a3, %lo(d1565)
+l2996:     beq $t6, $s4, l1292
+l2997:     j l1019
+l2998:     lui $a2, %hi(d746)
+l2999:     ori $a3, $a3, %lo(d473)
+l3000:     beq $t0, $s0, l200
+l3001:     j l4023
+l3002:     lui $a2, %hi(d3750)
+l3003:     ori $a3, $a3, %lo(d3477)
+l3004:     beq $t4, $s4, l3204
+l3005:     j l2931
+l3006:     lui $a2, %hi(d2658)
+l3007:     ori $a3, $a3, %lo(d2385)
+l3008:     beq $t8, $s0, l2112
+l3009:     j l1839
+l3010:     lui $a2, %hi(d1566)
+l3011:     ori $a3, $a3, %lo(d1293)
+l3012:     beq $t2, $s4, l1020
+l3013:     j l747
+l3014:     lui $a2, %hi(d474)
+l3015:     ori $a3, $a3, %lo(d201)
+l3016:     beq $t6, $s0, l4024
+l3017:     j l3751
+l3018:     lui $a2, %hi(d3478)
+l3019:     ori $a3, $a3, %lo(d3205)
+l3020:     beq $t0, $s4, l2932
+l3021:     j l2659
+l3022:     lui $a2, %hi(d2386)
+l3023:     ori $a3, $a3, %lo(d2113)
+l3024:     beq $t4, $s0, l1840
+l3025:     j l1567
+l3026:     lui $a2, %hi(d1294)
+l3027:     ori $a3, $a3, %lo(d1021)
+l3028:     beq $t8, $s4, l748
+l3029:     j l475
+l3030:     lui $a2, %hi(d202)
+l3031:     ori $a3, $a3, %lo(d4025)
+l3032:     beq $t2, $s0, l3752
+l3033:     j l3479
+l3034:     lui $a2, %hi(d3206)
+l3035:     ori $a3, $a3, %lo(d2933)
+l3036:     beq $t6, $s4, l2660
+l3037:     j l2387
+l3038:     lui $a2, %hi(d2114)
+l3039:     ori $a3, $a3, %lo(d1841)
+l3040:     beq $t0, $s0, l1568
+l3041:     j l1295
+l3042:     lui $a2, %hi(d1022)
+l3043:     ori $a3, $a3, %lo(d749)
+l3044:     beq $t4, $s4, l476
+l3045:     j l203
+l3046:     lui $a2, %hi(d4026)
+l3047:     ori $a3, $a3, %lo(d3753)
+l3048:     beq $t8, $s0, l3480
+l3049:     j l3207
+l3050:     lui $a2, %hi(d2934)
+l3051:     ori $a3, $a3, %lo(d2661)
+l3052:     beq $t2, $s4, l2388
+l3053:     j l2115
+l3054:     lui $a2, %hi(d1842)
+l3055:     ori $a3, $a3, %lo(d1569)
+l3056:     beq $t6, $s0, l1296
+l3057:     j l1023
+l3058:     lui $a2, %hi(d750)
+l3059:     ori $a3, $a3, %lo(d477)
+l3060:     beq $t0, $s4, l204
+l3061:     j l4027
+l3062:     lui $a2, %hi(d3754)
+l3063:     ori $a3, $a3, %lo(d3481)
+l3064:     beq $t4, $s0, l3208
+l3065:     j l2935
+l3066:     lui $a2, %hi(d2662)
+l3067:     ori $a3, $a3, %lo(d2389)
+l3068:     beq $t8, $s4, l2116
+l3069:     j l1843
+l3070:     lui $a2, %hi(d1570)
+l3071:     ori $a3, $a3, %lo(d1297)
+l3072:     beq $t2, $s0, l1024
+l3073:     j l751
+l3074:     lui $a2, %hi(d478)
+l3075:     ori $a3, $a3, %lo(d205)
+l3076:     beq $t6, $s4, l4028
+l3077:     j l3755
+l3078:     lui $a2, %hi(d3482)
+l3079:     ori $a3, $a3, %lo(d3209)
+l3080:     beq $t0, $s0, l2936
+l3081:     j l2663
+l3082:     lui $a2, %hi(d2390)
+l3083:     ori $a3, $a3, %lo(d2117)
+l3084:     beq $t4, $s4, l1844
+l3085:     j l1571
+l3086:     lui $a2, %hi(d1298)
+l3087:     ori $a3, $a3, %lo(d1025)
+l3088:     beq $t8, $s0, l752
+l3089:     j l479
+l3090:     lui $a2, %hi(d206)
+l3091:     ori $a3, $a3, %lo(d4029)
+l3092:     beq $t2, $s4, l3756
+l3093:     j l3483
+l3094:     lui $a2, %hi(d3210)
+l3095:     ori $a3, $a3, %lo(d2937)
+l3096:     beq $t6, $s0, l2664
+l3097:     j l2391
+l3098:     lui $a2, %hi(d2118)
+l3099:     ori $a3, $a3, %lo(d1845)
+l3100:     beq $t0, $s4, l1572
+l3101:     j l1299
+l3102:     lui $a2, %hi(d1026)
+l3103:     ori $a3, $a3, %lo(d753)
+l3104:     beq $t4, $s0, l480
+l3105:     j l207
+l3106:     lui $a2, %hi(d4030)
+l3107:     ori $a3, $a3, %lo(d3757)
+l3108:     beq $t8, $s4, l3484
+l3109:     j l3211
+l3110:     lui $a2, %hi(d2938)
+l3111:     ori $a3, $a3, %lo(d2665)
+l3112:     beq $t2, $s0, l2392
+l3113:     j l2119
+l3114:     lui $a2, %hi(d1846)
+l3115:     ori $a3, $a3, %lo(d1573)
+l3116:     beq $t6, $s4, l1300
+l3117:     j l1027
+l3118:     lui $a2, %hi(d754)
+l3119:     ori $a3, $a3, %lo(d481)
+l3120:     beq $t0, $s0, l208
+l3121:     j l4031
+l3122:     lui $a2, %hi(d3758)
+l3123:     ori $a3, $a3, %lo(d3485)
+l3124:     beq $t4, $s4, l3212
+l3125:     j l2939
+l3126:     lui $a2, %hi(d2666)
+l3127:     ori $a3, $a3, %lo(d2393)
+l3128:     beq $t8, $s0, l2120
+l3129:     j l1847
+l3130:     lui $a2, %hi(d1574)
+l3131:     ori $a3, $a3, %lo(d1301)
+l3132:     beq $t2, $s4, l1028
+l3133:     j l755
+l3134:     lui $a2, %hi(d482)
+l3135:     ori $a3, $a3, %lo(d209)
+l3136:     beq $t6, $s0, l4032
+l3137:     j l3759
+l3138:     lui $a2, %hi(d3486)
+l3139:     ori $a3, $a3, %lo(d3213)
+l3140:     beq $t0, $s4, l2940
+l3141:     j l2667
+l3142:     lui $a2, %hi(d2394)
+l3143:     ori $a3, $a3, %lo(d2121)
+l3144:     beq $t4, $s0, l1848
+l3145:     j l1575
+l3146:     lui $a2, %hi(d1302)
+l3147:     ori $a3, $a3, %lo(d1029)
+l3148:     beq $t8, $s4, l756
+l3149:     j l483
+l3150:     lui $a2, %hi(d210)
+l3151:     ori $a3, $a3, %lo(d4033)
+l3152:     beq $t2, $s0, l3760
+l3153:     j l3487
+l3154:     lui $a2, %hi(d3214)
+l3155:     ori $a3, $a3, %lo(d2941)
+l3156:     beq $t6, $s4, l2668
+l3157:     j l2395
+l3158:     lui $a2, %hi(d2122)
+l3159:     ori $a3, $a3, %lo(d1849)
+l3160:     beq $t0, $s0, l1576
+l3161:     j l1303
+l3162:     lui $a2, %hi(d1030)
+l3163:     ori $a3, $a3, %lo(d757)
+l3164:     beq $t4, $s4, l484
+l3165:     j l211
+l3166:     lui $a2, %hi(d4034)
+l3167:     ori $a3, $a3, %lo(d3761)
+l3168:     beq $t8, $s0, l3488
+l3169:     j l3215
+l3170:     lui $a2, %hi(d2942)
+l3171:     ori $a3, $a3, %lo(d2669)
+l3172:     beq $t2, $s4, l2396
+l3173:     j l2123
+l3174:     lui $a2, %hi(d1850)
+l3175:     ori $a3, $a3, %lo(d1577)
+l3176:     beq $t6, $s0, l1304
+l3177:     j l1031
+l3178:     lui $a2, %hi(d758)
+l3179:     ori $a3, $a3, %lo(d485)
+l3180:     beq $t0, $s4, l212
+l3181:     j l4035
+l3182:     lui $a2, %hi(d3762)
+l3183:     ori $a3, $a3, %lo(d3489)
+l3184:     beq $t4, $s0, l3216
+l3185:     j l2943
+l3186:     lui $a2, %hi(d2670)
+l3187:     ori $a3, $a3, %lo(d2397)
+l3188:     beq $t8, $s4, l2124
+l3189:     j l1851
+l3190:     lui $a2, %hi(d1578)
+l3191:     ori $a3, $a3, %lo(d1305)
+l3192:     beq $t2, $s0, l1032
+l3193:     j l759
+l3194:     lui $a2, %hi(d486)
+l3195:     ori $a3, $a3, %lo(d213)
+l3196:     beq $t6, $s4, l4036
+l3197:     j l3763
+l3198:     lui $a2, %hi(d3490)
+l3199:     ori $a3, $a3, %lo(d3217)
+l3200:     beq $t0, $s0, l2944
+l3201:     j l2671
+l3202:     lui $a2, %hi(d2398)
+l3203:     ori $a3, $a3, %lo(d2125)
+l3204:     beq $t4, $s4, l1852
+l3205:     j l1579
+l3206:     lui $a2, %hi(d1306)
+l3207:     ori $a3, $a3, %lo(d1033)
+l3208:     beq $t8, $s0, l760
+l3209:     j l487
+l3210:     lui $a2, %hi(d214)
+l3211:     ori $a3, $a3, %lo(d4037)
+l3212:     beq $t2, $s4, l3764
+l3213:     j l3491
+l3214:     lui $a2, %hi(d3218)
+l3215:     ori $a3, $a3, %lo(d2945)
+l3216:     beq $t6, $s0, l2672
+l3217:     j l2399
+l3218:     lui $a2, %hi(d2126)
+l3219:     ori $a3, $a3, %lo(d1853)
+l3220:     beq $t0, $s4, l1580
+l3221:     j l1307
+l3222:     lui $a2, %hi(d1034)
+l3223:     ori $a3, $a3, %lo(d761)
+l3224:     beq $t4, $s0, l488
+l3225:     j l215
+l3226:     lui $a2, %hi(d4038)
+l3227:     ori $a3, $a3, %lo(d3765)
+l3228:     beq $t8, $s4, l3492
+l3229:     j l3219
+l3230:     lui $a2, %hi(d2946)
+l3231:     ori $a3, $a3, %lo(d2673)
+l3232:     beq $t2, $s0, l2400
+l3233:     j l2127
+l3234:     lui $a2, %hi(d1854)
+l3235:     ori $a3, $a3, %lo(d1581)
+l3236:     beq $t6, $s4, l1308
+l3237:     j l1035
+l3238:     lui $a2, %hi(d762)
+l3239:     ori $a3, $a3, %lo(d489)
+l3240:     beq $t0, $s0, l216
+l3241:     j l4039
+l3242:     lui $a2, %hi(d3766)
+l3243:     ori $a3, $a3, %lo(d3493)
+l3244:     beq $t4, $s4, l3220
+l3245:     j l2947
+l3246:     lui $a2, %hi(d2674)
+l3247:     ori $a3, $a3, %lo(d2401)
+l3248:     beq $t8, $s0, l2128
+l3249:     j l1855
+l3250:     lui $a2, %hi(d1582)
+l3251:     ori $a3, $a3, %lo(d1309)
+l3252:     beq $t2, $s4, l1036
+l3253:     j l763
+l3254:     lui $a2, %hi(d490)
+l3255:     ori $a3, $a3, %lo(d217)
+l3256:     beq $t6, $s0, l4040
+l3257:     j l3767
+l3258:     lui $a2, %hi(d3494)
+l3259:     ori $a3, $a3, %lo(d3221)
+l3260:     beq $t0, $s4, l2948
+l3261:     j l2675
+l3262:     lui $a2, %hi(d2402)
+l3263:     ori $a3, $a3, %lo(d2129)
+l3264:     beq $t4, $s0, l1856
+l3265:     j l1583
+l3266:     lui $a2, %hi(d1310)
+l3267:     ori $a3, $a3, %lo(d1037)
+l3268:     beq $t8, $s4, l764
+l3269:     j l491
+l3270:     lui $a2, %hi(d218)
+l3271:     ori $a3, $a3, %lo(d4041)
+l3272:     beq $t2, $s0, l3768
+l3273:     j l3495
+l3274:     lui $a2, %hi(d3222)
+l3275:     ori $a3, $a3, %lo(d2949)
+l3276:     beq $t6, $s4, l2676
+l3277:     j l2403
+l3278:     lui $a2, %hi(d2130)
+l3279:     ori $a3, $a3, %lo(d1857)
+l3280:     beq $t0, $s0, l1584
+l3281:     j l1311
+l3282:     lui $a2, %hi(d1038)
+l3283:     ori $a3, $a3, %lo(d765)
+l3284:     beq $t4, $s4, l492
+l3285:     j l219
+l3286:     lui $a2, %hi(d4042)
+l3287:     ori $a3, $a3, %lo(d3769)
+l3288:     beq $t8, $s0, l3496
+l3289:     j l3223
+l3290:     lui $a2, %hi(d2950)
+l3291:     ori $a3, $a3, %lo(d2677)
+l3292:     beq $t2, $s4, l2404
+l3293:     j l2131
+l3294:     lui $a2, %hi(d1858)
+l3295:     ori $a3, $a3, %lo(d1585)
+l3296:     beq $t6, $s0, l1312
+l3297:     j l1039
+l3298:     lui $a2, %hi(d766)
+l3299:     ori $a3, $a3, %lo(d493)
+l3300:     beq $t0, $s4, l220
+l3301:     j l4043
+l3302:     lui $a2, %hi(d3770)
+l3303:     ori $a3, $a3, %lo(d3497)
+l3304:     beq $t4, $s0, l3224
+l3305:     j l2951
+l3306:     lui $a2, %hi(d2678)
+l3307:     ori $a3, $a3, %lo(d2405)
+l3308:     beq $t8, $s4, l2132
+l3309:     j l1859
+l3310:     lui $a2, %hi(d1586)
+l3311:     ori $a3, $a3, %lo(d1313)
+l3312:     beq $t2, $s0, l1040
+l3313:     j l767
+l3314:     lui $a2, %hi(d494)
+l3315:     ori $a3, $a3, %lo(d221)
+l3316:     beq $t6, $s4, l4044
+l3317:     j l3771
+l3318:     lui $a2, %hi(d3498)
+l3319:     ori $a3, $a3, %lo(d3225)
+l3320:     beq $t0, $s0, l2952
+l3321:     j l2679
+l3322:     lui $a2, %hi(d2406)
+l3323:     ori $a3, $a3, %lo(d2133)
+l3324:     beq $t4, $s4, l1860
+l3325:     j l1587
+l3326:     lui $a2, %hi(d1314)
+l3327:     ori $a3, $a3, %lo(d1041)
+l3328:     beq $t8, $s0, l768
+l3329:     j l495
+l3330:     lui $a2, %hi(d222)
+l3331:     ori $a3, $a3, %lo(d4045)
+l3332:     beq $t2, $s4, l3772
+l3333:     j l3499
+l3334:     lui $a2, %hi(d3226)
+l3335:     ori $a3, $a3, %lo(d2953)
+l3336:     beq $t6, $s0, l2680
+l3337:     j l2407
+l3338:     lui $a2, %hi(d2134)
+l3339:     ori $a3, $a3, %lo(d1861)
+l3340:     beq $t0, $s4, l1588
+l3341:     j l1315
+l3342:     lui $a2, %hi(d1042)
+l3343:     ori $a3, $a3, %lo(d769)
+l3344:     beq $t4, $s0, l496
+l3345:     j l223
+l3346:     lui $a2, %hi(d4046)
+l3347:     ori $a3, $a3, %lo(d3773)
+l3348:     beq $t8, $s4, l3500
+l3349:     j l3227
+l3350:     lui $a2, %hi(d2954)
+l3351:     ori $a3, $a3, %lo(d2681)
+l3352:     beq $t2, $s0, l2408
+l3353:     j l2135
+l3354:     lui $a2, %hi(d1862)
+l3355:     ori $a3, $a3, %lo(d1589)
+l3356:     beq $t6, $s4, l1316
+l3357:     j l1043
+l3358:     lui $a2, %hi(d770)
+l3359:     ori $a3, $a3, %lo(d497)
+l3360:     beq $t0, $s0, l224
+l3361:     j l4047
+l3362:     lui $a2, %hi(d3774)
+l3363:     ori $a3, $a3, %lo(d3501)
+l3364:     beq $t4, $s4, l3228
+l3365:     j l2955
+l3366:     lui $a2, %hi(d2682)
+l3367:     ori $a3, $a3, %lo(d2409)
+l3368:     beq $t8, $s0, l2136
+l3369:     j l1863
+l3370:     lui $a2, %hi(d1590)
+l3371:     ori $a3, $a3, %lo(d1317)
+l3372:     beq $t2, $s4, l1044
+l3373:     j l771
+l3374:     lui $a2, %hi(d498)
+l3375:     ori $a3, $a3, %lo(d225)
+l3376:     beq $t6, $s0, l4048
+l3377:     j l3775
+l3378:     lui $a2, %hi(d3502)
+l3379:     ori $a3, $a3, %lo(d3229)
+l3380:     beq $t0, $s4, l2956
+l3381:     j l2683
+l3382:     lui $a2, %hi(d2410)
+l3383:     ori $a3, $a3, %lo(d2137)
+l3384:     beq $t4, $s0, l1864
+l3385:     j l1591
+l3386:     lui $a2, %hi(d1318)
+l3387:     ori $a3, $a3, %lo(d1045)
+l3388:     beq $t8, $s4, l772
+l3389:     j l499
+l3390:     lui $a2, %hi(d226)
+l3391:     ori $a3, $a3, %lo(d4049)
+l3392:     beq $t2, $s0, l3776
+l3393:     j l3503
+l3394:     lui $a2, %hi(d3230)
+l3395:     ori $a3, $a3, %lo(d2957)
+l3396:     beq $t6, $s4, l2684
+l3397:     j l2411
+l3398:     lui $a2, %hi(d2138)
+l3399:     ori $a3, $a3, %lo(d1865)
+l3400:     beq $t0, $s0, l1592
+l3401:     j l1319
+l3402:     lui $a2, %hi(d1046)
+l3403:     ori $a3, $a3, %lo(d773)
+l3404:     beq $t4, $s4, l500
+l3405:     j l227
+l3406:     lui $a2, %hi(d4050)
+l3407:     ori $a3, $a3, %lo(d3777)
+l3408:     beq $t8, $s0, l3504
+l3409:     j l3231
+l3410:     lui $a2, %hi(d2958)
+l3411:     ori $a3, $a3, %lo(d2685)
+l3412:     beq $t2, $s4, l2412
+l3413:     j l2139
+l3414:     lui $a2, %hi(d1866)
+l3415:     ori $a3, $a3, %lo(d1593)
+l3416:     beq $t6, $s0, l1320
+l3417:     j l1047
+l3418:     lui $a2, %hi(d774)
+l3419:     ori $a3, $a3, %lo(d501)
+l3420:     beq $t0, $s4, l228
+l3421:     j l4051
+l3422:     lui $a2, %hi(d3778)
+l3423:     ori $a3, $a3, %lo(d3505)
+l3424:     beq $t4, $s0, l3232
+l3425:     j l2959
+l3426:     lui $a2, %hi(d2686)
+l3427:     ori $a3, $a3, %lo(d2413)
+l3428:     beq $t8, $s4, l2140
+l3429:     j l1867
+l3430:     lui $a2, %hi(d1594)
+l3431:     ori $a3, $a3, %lo(d1321)
+l3432:     beq $t2, $s0, l1048
+l3433:     j l775
+l3434:     lui $a2, %hi(d502)
+l3435:     ori $a3, $a3, %lo(d229)
+l3436:     beq $t6, $s4, l4052
+l3437:     j l3779
+l3438:     lui $a2, %hi(d3506)
+l3439:     ori $a3, $a3, %lo(d3233)
+l3440:     beq $t0, $s0, l2960
+l3441:     j l2687
+l3442:     lui $a2, %hi(d2414)
+l3443:     ori $a3, $a3, %lo(d2141)
+l3444:     beq $t4, $s4, l1868
+l3445:     j l1595
+l3446:     lui $a2, %hi(d1322)
+l3447:     ori $a3, $a3, %lo(d1049)
+l3448:     beq $t8, $s0, l776
+l3449:     j l503
+l3450:     lui $a2, %hi(d230)
+l3451:     ori $a3, $a3, %lo(d4053)
+l3452:     beq $t2, $s4, l3780
+l3453:     j l3507
+l3454:     lui $a2, %hi(d3234)
+l3455:     ori $a3, $a3, %lo(d2961)
+l3456:     beq $t6, $s0, l2688
+l3457:     j l2415
+l3458:     lui $a2, %hi(d2142)
+l3459:     ori $a3, $a3, %lo(d1869)
+l3460:     beq $t0, $s4, l1596
+l3461:     j l1323
+l3462:     lui $a2, %hi(d1050)
+l3463:     ori $a3, $a3, %lo(d777)
+l3464:     beq $t4, $s0, l504
+l3465:     j l231
+l3466:     lui $a2, %hi(d4054)
+l3467:     ori $a3, $a3, %lo(d3781)
+l3468:     beq $t8, $s4, l3508
+l3469:     j l3235
+l3470:     lui $a2, %hi(d2962)
+l3471:     ori $a3, $a3, %lo(d2689)
+l3472:     beq $t2, $s0, l2416
+l3473:     j l2143
+l3474:     lui $a2, %hi(d1870)
+l3475:     ori $a3, $a3, %lo(d1597)
+l3476:     beq $t6, $s4, l1324
+l3477:     j l1051
+l3478:     lui $a2, %hi(d778)
+l3479:     ori $a3, $a3, %lo(d505)
+l3480:     beq $t0, $s0, l232
+l3481:     j l4055
+l3482:     lui $a2, %hi(d3782)
+l3483:     ori $a3, $a3, %lo(d3509)
+l3484:     beq $t4, $s4, l3236
+l3485:     j l2963
+l3486:     lui $a2, %hi(d2690)
+l3487:     ori $a3, $a3, %lo(d2417)
+l3488:     beq $t8, $s0, l2144
+l3489:     j l1871
+l3490:     lui $a2, %hi(d1598)
+l3491:     ori $a3, $a3, %lo(d1325)
+l3492:     beq $t2, $s4, l1052
+l3493:     j l779
+l3494:     lui $a2, %hi(d506)
+l3495:     ori $a3, $a3, %lo(d233)
+l3496:     beq $t6, $s0, l4056
+l3497:     j l3783
+l3498:     lui $a2, %hi(d3510)
+l3499:     ori $a3, $a3, %lo(d3237)
+l3500:     beq $t0, $s4, l2964
+l3501:     j l2691
+l3502:     lui $a2, %hi(d2418)
+l3503:     ori $a3, $a3, %lo(d2145)
+l3504:     beq $t4, $s0, l1872
+l3505:     j l1599
+l3506:     lui $a2, %hi(d1326)
+l3507:     ori $a3, $a3, %lo(d1053)
+l3508:     beq $t8, $s4, l780
+l3509:     j l507
+l3510:     lui $a2, %hi(d234)
+l3511:     ori $a3, $a3, %lo(d4057)
+l3512:     beq $t2, $s0, l3784
+l3513:     j l3511
+l3514:     lui $a2, %hi(d3238)
+l3515:     ori $a3, $a3, %lo(d2965)
+l3516:     beq $t6, $s4, l2692
+l3517:     j l2419
+l3518:     lui $a2, %hi(d2146)
+l3519:     ori $a3, $a3, %lo(d1873)
+l3520:     beq $t0, $s0, l1600
+l3521:     j l1327
+l3522:     lui $a2, %hi(d1054)
+l3523:     ori $a3, $a3, %lo(d781)
+l3524:     beq $t4, $s4, l508
+l3525:     j l235
+l3526:     lui $a2, %hi(d4058)
+l3527:     ori $a3, $a3, %lo(d3785)
+l3528:     beq $t8, $s0, l3512
+l3529:     j l3239
+l3530:     lui $a2, %hi(d2966)
+l3531:     ori $a3, $a3, %lo(d2693)
+l3532:     beq $t2, $s4, l2420
+l3533:     j l2147
+l3534:     lui $a2, %hi(d1874)
+l3535:     ori $a3, $a3, %lo(d1601)
+l3536:     beq $t6, $s0, l1328
+l3537:     j l1055
+l3538:     lui $a2, %hi(d782)
+l3539:     ori $a3, $a3, %lo(d509)
+l3540:     beq $t0, $s4, l236
+l3541:     j l4059
+l3542:     lui $a2, %hi(d3786)
+l3543:     ori $a3, $a3, %lo(d3513)
+l3544:     beq $t4, $s0, l3240
+l3545:     j l2967
+l3546:     lui $a2, %hi(d2694)
+l3547:     ori $a3, $a3, %lo(d2421)
+l3548:     beq $t8, $s4, l2148
+l3549:     j l1875
+l3550:     lui $a2, %hi(d1602)
+l3551:     ori $a3, $a3, %lo(d1329)
+l3552:     beq $t2, $s0, l1056
+l3553:     j l783
+l3554:     lui $a2, %hi(d510)
+l3555:     ori $a3, $a3, %lo(d237)
+l3556:     beq $t6, $s4, l4060
+l3557:     j l3787
+l3558:     lui $a2, %hi(d3514)
+l3559:     ori $a3, $a3, %lo(d3241)
+l3560:     beq $t0, $s0, l2968
+l3561:     j l2695
+l3562:     lui $a2, %hi(d2422)
+l3563:     ori $a3, $a3, %lo(d2149)
+l3564:     beq $t4, $s4, l1876
+l3565:     j l1603
+l3566:     lui $a2, %hi(d1330)
+l3567:     ori $a3, $a3, %lo(d1057)
+l3568:     beq $t8, $s0, l784
+l3569:     j l511
+l3570:     lui $a2, %hi(d238)
+l3571:     ori $a3, $a3, %lo(d4061)
+l3572:     beq $t2, $s4, l3788
+l3573:     j l3515
+l3574:     lui $a2, %hi(d3242)
+l3575:     ori $a3, $a3, %lo(d2969)
+l3576:     beq $t6, $s0, l2696
+l3577:     j l2423
+l3578:     lui $a2, %hi(d2150)
+l3579:     ori $a3, $a3, %lo(d1877)
+l3580:     beq $t0, $s4, l1604
+l3581:     j l1331
+l3582:     lui $a2, %hi(d1058)
+l3583:     ori $a3, $a3, %lo(d785)
+l3584:     beq $t4, $s0, l512
+l3585:     j l239
+l3586:     lui $a2, %hi(d4062)
+l3587:     ori $a3, $a3, %lo(d3789)
+l3588:     beq $t8, $s4, l3516
+l3589:     j l3243
+l3590:     lui $a2, %hi(d2970)
+l3591:     ori $a3, $a3, %lo(d2697)
+l3592:     beq $t2, $s0, l2424
+l3593:     j l2151
+l3594:     lui $a2, %hi(d1878)
+l3595:     ori $a3, $a3, %lo(d1605)
+l3596:     beq $t6, $s4, l1332
+l3597:     j l1059
+l3598:     lui $a2, %hi(d786)
+l3599:     ori $a3, $a3, %lo(d513)
+l3600:     beq $t0, $s0, l240
+l3601:     j l4063
+l3602:     lui $a2, %hi(d3790)
+l3603:     ori $a3, $a3, %lo(d3517)
+l3604:     beq $t4, $s4, l3244
+l3605:     j l2971
+l3606:     lui $a2, %hi(d2698)
+l3607:     ori $a3, $a3, %lo(d2425)
+l3608:     beq $t8, $s0, l2152
+l3609:     j l1879
+l3610:     lui $a2, %hi(d1606)
+l3611:     ori $a3, $a3, %lo(d1333)
+l3612:     beq $t2, $s4, l1060
+l3613:     j l787
+l3614:     lui $a2, %hi(d514)
+l3615:     ori $a3, $a3, %lo(d241)
+l3616:     beq $t6, $s0, l4064
+l3617:     j l3791
+l3618:     lui $a2, %hi(d3518)
+l3619:     ori $a3, $a3, %lo(d3245)
+l3620:     beq $t0, $s4, l2972
+l3621:     j l2699
+l3622:     lui $a2, %hi(d2426)
+l3623:     ori $a3, $a3, %lo(d2153)
+l3624:     beq $t4, $s0, l1880
+l3625:     j l1607
+l3626:     lui $a2, %hi(d1334)
+l3627:     ori $a3, $a3, %lo(d1061)
+l3628:     beq $t8, $s4, l788
+l3629:     j l515
+l3630:     lui $a2, %hi(d242)
+l3631:     ori $a3, $a3, %lo(d4065)
+l3632:     beq $t2, $s0, l3792
+l3633:     j l3519
+l3634:     lui $a2, %hi(d3246)
+l3635:     ori $a3, $a3, %lo(d2973)
+l3636:     beq $t6, $s4, l2700
+l3637:     j l2427
+l3638:     lui $a2, %hi(d2154)
+l3639:     ori $a3, $a3, %lo(d1881)
+l3640:     beq $t0, $s0, l1608
+l3641:     j l1335
+l3642:     lui $a2, %hi(d1062)
+l3643:     ori $a3, $a3, %lo(d789)
+l3644:     beq $t4, $s4, l516
+l3645:     j l243
+l3646:     lui $a2, %hi(d4066)
+l3647:     ori $a3, $a3, %lo(d3793)
+l3648:     beq $t8, $s0, l3520
+l3649:     j l3247
+l3650:     lui $a2, %hi(d2974)
+l3651:     ori $a3, $a3, %lo(d2701)
+l3652:     beq $t2, $s4, l2428
+l3653:     j l2155
+l3654:     lui $a2, %hi(d1882)
+l3655:     ori $a3, $a3, %lo(d1609)
+l3656:     beq $t6, $s0, l1336
+l3657:     j l1063
+l3658:     lui $a2, %hi(d790)
+l3659:     ori $a3, $a3, %lo(d517)
+l3660:     beq $t0, $s4, l244
+l3661:     j l4067
+l3662:     lui $a2, %hi(d3794)
+l3663:     ori $a3, $a3, %lo(d3521)
+l3664:     beq $t4, $s0, l3248
+l3665:     j l2975
+l3666:     lui $a2, %hi(d2702)
+l3667:     ori $a3, $a3, %lo(d2429)
+l3668:     beq $t8, $s4, l2156
+l3669:     j l1883
+l3670:     lui $a2, %hi(d1610)
+l3671:     ori $a3, $a3, %lo(d1337)
+l3672:     beq $t2, $s0, l1064
+l3673:     j l791
+l3674:     lui $a2, %hi(d518)
+l3675:     ori $a3, $a3, %lo(d245)
+l3676:     beq $t6, $s4, l4068
+l3677:     j l3795
+l3678:     lui $a2, %hi(d3522)
+l3679:     ori $a3, $a3, %lo(d3249)
+l3680:     beq $t0, $s0, l2976
+l3681:     j l2703
+l3682:     lui $a2, %hi(d2430)
+l3683:     ori $a3, $a3, %lo(d2157)
+l3684:     beq $t4, $s4, l1884
+l3685:     j l1611
+l3686:     lui $a2, %hi(d1338)
+l3687:     ori $a3, $a3, %lo(d1065)
+l3688:     beq $t8, $s0, l792
+l3689:     j l519
+l3690:     lui $a2, %hi(d246)
+l3691:     ori $a3, $a3, %lo(d4069)
+l3692:     beq $t2, $s4, l3796
+l3693:     j l3523
+l3694:     lui $a2, %hi(d3250)
+l3695:     ori $a3, $a3, %lo(d2977)
+l3696:     beq $t6, $s0, l2704
+l3697:     j l2431
+l3698:     lui $a2, %hi(d2158)
+l3699:     ori $a3, $a3, %lo(d1885)
+l3700:     beq $t0, $s4, l1612
+l3701:     j l1339
+l3702:     lui $a2, %hi(d1066)
+l3703:     ori $a3, $a3, %lo(d793)
+l3704:     beq $t4, $s0, l520
+l3705:     j l247
+l3706:     lui $a2, %hi(d4070)
+l3707:     ori $a3, $a3, %lo(d3797)
+l3708:     beq $t8, $s4, l3524
+l3709:     j l3251
+l3710:     lui $a2, %hi(d2978)
+l3711:     ori $a3, $a3, %lo(d2705)
+l3712:     beq $t2, $s0, l2432
+l3713:     j l2159
+l3714:     lui $a2, %hi(d1886)
+l3715:     ori $a3, $a3, %lo(d1613)
+l3716:     beq $t6, $s4, l1340
+l3717:     j l1067
+l3718:     lui $a2, %hi(d794)
+l3719:     ori $a3, $a3, %lo(d521)
+l3720:     beq $t0, $s0, l248
+l3721:     j l4071
+l3722:     lui $a2, %hi(d3798)
+l3723:     ori $a3, $a3, %lo(d3525)
+l3724:     beq $t4, $s4, l3252
+l3725:     j l2979
+l3726:     lui $a2, %hi(d2706)
+l3727:     ori $a3, $a3, %lo(d2433)
+l3728:     beq $t8, $s0, l2160
+l3729:     j l1887
+l3730:     lui $a2, %hi(d1614)
+l3731:     ori $a3, $a3, %lo(d1341)
+l3732:     beq $t2, $s4, l1068
+l3733:     j l795
+l3734:     lui $a2, %hi(d522)
+l3735:     ori $a3, $a3, %lo(d249)
+l3736:     beq $t6, $s0, l4072
+l3737:     j l3799
+l3738:     lui $a2, %hi(d3526)
+l3739:     ori $a3, $a3, %lo(d3253)
+l3740:     beq $t0, $s4, l2980
+l3741:     j l2707
+l3742:     lui $a2, %hi(d2434)
+l3743:     ori $a3, $a3, %lo(d2161)
+l3744:     beq $t4, $s0, l1888
+l3745:     j l1615
+l3746:     lui $a2, %hi(d1342)
+l3747:     ori $a3, $a3, %lo(d1069)
+l3748:     beq $t8, $s4, l796
+l3749:     j l523
+l3750:     lui $a2, %hi(d250)
+l3751:     ori $a3, $a3, %lo(d4073)
+l3752:     beq $t2, $s0, l3800
+l3753:     j l3527
+l3754:     lui $a2, %hi(d3254)
+l3755:     ori $a3, $a3, %lo(d2981)
+l3756:     beq $t6, $s4, l2708
+l3757:     j l2435
+l3758:     lui $a2, %hi(d2162)
+l3759:     ori $a3, $a3, %lo(d1889)
+l3760:     beq $t0, $s0, l1616
+l3761:     j l1343
+l3762:     lui $a2, %hi(d1070)
+l3763:     ori $a3, $a3, %lo(d797)
+l3764:     beq $t4, $s4, l524
+l3765:     j l251
+l3766:     lui $a2, %hi(d4074)
+l3767:     ori $a3, $a3, %lo(d3801)
+l3768:     beq $t8, $s0, l3528
+l3769:     j l3255
+l3770:     lui $a2, %hi(d2982)
+l3771:     ori $a3, $a3, %lo(d2709)
+l3772:     beq $t2, $s4, l2436
+l3773:     j l2163
+l3774:     lui $a2, %hi(d1890)
+l3775:     ori $a3, $a3, %lo(d1617)
+l3776:     beq $t6, $s0, l1344
+l3777:     j l1071
+l3778:     lui $a2, %hi(d798)
+l3779:     ori $a3, $a3, %lo(d525)
+l3780:     beq $t0, $s4, l252
+l3781:     j l4075
+l3782:     lui $a2, %hi(d3802)
+l3783:     ori $a3, $a3, %lo(d3529)
+l3784:     beq $t4, $s0, l3256
+l3785:     j l2983
+l3786:     lui $a2, %hi(d2710)
+l3787:     ori $a3, $a3, %lo(d2437)
+l3788:     beq $t8, $s4, l2164
+l3789:     j l1891
+l3790:     lui $a2, %hi(d1618)
+l3791:     ori $a3, $a3, %lo(d1345)
+l3792:     beq $t2, $s0, l1072
+l3793:     j l799
+l3794:     lui $a2, %hi(d526)
+l3795:     ori $a3, $a3, %lo(d253)
+l3796:     beq $t6, $s4, l4076
+l3797:     j l3803
+l3798:     lui $a2, %hi(d3530)
+l3799:     ori $a3, $a3, %lo(d3257)
+l3800:     beq $t0, $s0, l2984
+l3801:     j l2711
+l3802:     lui $a2, %hi(d2438)
+l3803:     ori $a3, $a3, %lo(d2165)
+l3804:     beq $t4, $s4, l1892
+l3805:     j l1619
+l3806:     lui $a2, %hi(d1346)
+l3807:     ori $a3, $a3, %lo(d1073)
+l3808:     beq $t8, $s0, l800
+l3809:     j l527
+l3810:     lui $a2, %hi(d254)
+l3811:     ori $a3, $a3, %lo(d4077)
+l3812:     beq $t2, $s4, l3804
+l3813:     j l3531
+l3814:     lui $a2, %hi(d3258)
+l3815:     ori $a3, $a3, %lo(d2985)
+l3816:     beq $t6, $s0, l2712
+l3817:     j l2439
+l3818:     lui $a2, %hi(d2166)
+l3819:     ori $a3, $a3, %lo(d1893)
+l3820:     beq $t0, $s4, l1620
+l3821:     j l1347
+l3822:     lui $a2, %hi(d1074)
+l3823:     ori $a3, $a3, %lo(d801)
+l3824:     beq $t4, $s0, l528
+l3825:     j l255
+l3826:     lui $a2, %hi(d4078)
+l3827:     ori $a3, $a3, %lo(d3805)
+l3828:     beq $t8, $s4, l3532
+l3829:     j l3259
+l3830:     lui $a2, %hi(d2986)
+l3831:     ori $a3, $a3, %lo(d2713)
+l3832:     beq $t2, $s0, l2440
+l3833:     j l2167
+l3834:     lui $a2, %hi(d1894)
+l3835:     ori $a3, $a3, %lo(d1621)
+l3836:     beq $t6, $s4, l1348
+l3837:     j l1075
+l3838:     lui $a2, %hi(d802)
+l3839:     ori $a3, $a3, %lo(d529)
+l3840:     beq $t0, $s0, l256
+l3841:     j l4079
+l3842:     lui $a2, %hi(d3806)
+l3843:     ori $a3, $a3, %lo(d3533)
+l3844:     beq $t4, $s4, l3260
+l3845:     j l2987
+l3846:     lui $a2, %hi(d2714)
+l3847:     ori $a3, $a3, %lo(d2441)
+l3848:     beq $t8, $s0, l2168
+l3849:     j l1895
+l3850:     lui $a2, %hi(d1622)
+l3851:     ori $a3, $a3, %lo(d1349)
+l3852:     beq $t2, $s4, l1076
+l3853:     j l803
+l3854:     lui $a2, %hi(d530)
+l3855:     ori $a3, $a3, %lo(d257)
+l3856:     beq $t6, $s0, l4080
+l3857:     j l3807
+l3858:     lui $a2, %hi(d3534)
+l3859:     ori $a3, $a3, %lo(d3261)
+l3860:     beq $t0, $s4, l2988
+l3861:     j l2715
+l3862:     lui $a2, %hi(d2442)
+l3863:     ori $a3, $a3, %lo(d2169)
+l3864:     beq $t4, $s0, l1896
+l3865:     j l1623
+l3866:     lui $a2, %hi(d1350)
+l3867:     ori $a3, $a3, %lo(d1077)
+l3868:     beq $t8, $s4, l804
+l3869:     j l531
+l3870:     lui $a2, %hi(d258)
+l3871:     ori $a3, $a3, %lo(d4081)
+l3872:     beq $t2, $s0, l3808
+l3873:     j l3535
+l3874:     lui $a2, %hi(d3262)
+l3875:     ori $a3, $a3, %lo(d2989)
+l3876:     beq $t6, $s4, l2716
+l3877:     j l2443
+l3878:     lui $a2, %hi(d2170)
+l3879:     ori $a3, $a3, %lo(d1897)
+l3880:     beq $t0, $s0, l1624
+l3881:     j l1351
+l3882:     lui $a2, %hi(d1078)
+l3883:     ori $a3, $a3, %lo(d805)
+l3884:     beq $t4, $s4, l532
+l3885:     j l259
+l3886:     lui $a2, %hi(d4082)
+l3887:     ori $a3, $a3, %lo(d3809)
+l3888:     beq $t8, $s0, l3536
+l3889:     j l3263
+l3890:     lui $a2, %hi(d2990)
+l3891:     ori $a3, $a3, %lo(d2717)
+l3892:     beq $t2, $s4, l2444
+l3893:     j l2171
+l3894:     lui $a2, %hi(d1898)
+l3895:     ori $a3, $a3, %lo(d1625)
+l3896:     beq $t6, $s0, l1352
+l3897:     j l1079
+l3898:     lui $a2, %hi(d806)
+l3899:     ori $a3, $a3, %lo(d533)
+l3900:     beq $t0, $s4, l260
+l3901:     j l4083
+l3902:     lui $a2, %hi(d3810)
+l3903:     ori $a3, $a3, %lo(d3537)
+l3904:     beq $t4, $s0, l3264
+l3905:     j l2991
+l3906:     lui $a2, %hi(d2718)
+l3907:     ori $a3, $a3, %lo(d2445)
+l3908:     beq $t8, $s4, l2172
+l3909:     j l1899
+l3910:     lui $a2, %hi(d1626)
+l3911:     ori $a3, $a3, %lo(d1353)
+l3912:     beq $t2, $s0, l1080
+l3913:     j l807
+l3914:     lui $a2, %hi(d534)
+l3915:     ori $a3, $a3, %lo(d261)
+l3916:     beq $t6, $s4, l4084
+l3917:     j l3811
+l3918:     lui $a2, %hi(d3538)
+l3919:     ori $a3, $a3, %lo(d3265)
+l3920:     beq $t0, $s0, l2992
+l3921:     j l2719
+l3922:     lui $a2, %hi(d2446)
+l3923:     ori $a3, $a3, %lo(d2173)
+l3924:     beq $t4, $s4, l1900
+l3925:     j l1627
+l3926:     lui $a2, %hi(d1354)
+l3927:     ori $a3, $a3, %lo(d1081)
+l3928:     beq $t8, $s0, l808
+l3929:     j l535
+l3930:     lui $a2, %hi(d262)
+l3931:     ori $a3, $a3, %lo(d4085)
+l3932:     beq $t2, $s4, l3812
+l3933:     j l3539
+l3934:     lui $a2, %hi(d3266)
+l3935:     ori $a3, $a3, %lo(d2993)
+l3936:     beq $t6, $s0, l2720
+l3937:     j l2447
+l3938:     lui $a2, %hi(d2174)
+l3939:     ori $a3, $a3, %lo(d1901)
+l3940:     beq $t0, $s4, l1628
+l3941:     j l1355
+l3942:     lui $a2, %hi(d1082)
+l3943:     ori $a3, $a3, %lo(d809)
+l3944:     beq $t4, $s0, l536
+l3945:     j l263
+l3946:     lui $a2, %hi(d4086)
+l3947:     ori $a3, $a3, %lo(d3813)
+l3948:     beq $t8, $s4, l3540
+l3949:     j l3267
+l3950:     lui $a2, %hi(d2994)
+l3951:     ori $a3, $a3, %lo(d2721)
+l3952:     beq $t2, $s0, l2448
+l3953:     j l2175
+l3954:     lui $a2, %hi(d1902)
+l3955:     ori $a3, $a3, %lo(d1629)
+l3956:     beq $t6, $s4, l1356
+l3957:     j l1083
+l3958:     lui $a2, %hi(d810)
+l3959:     ori $a3, $a3, %lo(d537)
+l3960:     beq $t0, $s0, l264
+l3961:     j l4087
+l3962:     lui $a2, %hi(d3814)
+l3963:     ori $a3, $a3, %lo(d3541)
+l3964:     beq $t4, $s4, l3268
+l3965:     j l2995
+l3966:     lui $a2, %hi(d2722)
+l3967:     ori $a3, $a3, %lo(d2449)
+l3968:     beq $t8, $s0, l2176
+l3969:     j l1903
+l3970:     lui $a2, %hi(d1630)
+l3971:     ori $a3, $a3, %lo(d1357)
+l3972:     beq $t2, $s4, l1084
+l3973:     j l811
+l3974:     lui $a2, %hi(d538)
+l3975:     ori $a3, $a3, %lo(d265)
+l3976:     beq $t6, $s0, l4088
+l3977:     j l3815
+l3978:     lui $a2, %hi(d3542)
+l3979:     ori $a3, $a3, %lo(d3269)
+l3980:     beq $t0, $s4, l2996
+l3981:     j l2723
+l3982:     lui $a2, %hi(d2450)
+l3983:     ori $a3, $a3, %lo(d2177)
+l3984:     beq $t4, $s0, l1904
+l3985:     j l1631
+l3986:     lui $a2, %hi(d1358)
+l3987:     ori $a3, $a3, %lo(d1085)
+l3988:     beq $t8, $s4, l812
+l3989:     j l539
+l3990:     lui $a2, %hi(d266)
+l3991:     ori $a3, $a3, %lo(d4089)
+l3992:     beq $t2, $s0, l3816
+l3993:     j l3543
+l3994:     lui $a2, %hi(d3270)
+l3995:     ori $a3, $a3, %lo(d2997)
+l3996:     beq $t6, $s4, l2724
+l3997:     j l2451
+l3998:     lui $a2, %hi(d2178)
+l3999:     ori $a3, $a3, %lo(d1905)
+l4000:     beq $t0, $s0, l1632
+l4001:     j l1359
+l4002:     lui $a2, %hi(d1086)
+l4003:     ori $a3, $a3, %lo(d813)
+l4004:     beq $t4, $s4, l540
+l4005:     j l267
+l4006:     lui $a2, %hi(d4090)
+l4007:     ori $a3, $a3, %lo(d3817)
+l4008:     beq $t8, $s0, l3544
+l4009:     j l3271
+l4010:     lui $a2, %hi(d2998)
+l4011:     ori $a3, $a3, %lo(d2725)
+l4012:     beq $t2, $s4, l2452
+l4013:     j l2179
+l4014:     lui $a2, %hi(d1906)
+l4015:     ori $a3, $a3, %lo(d1633)
+l4016:     beq $t6, $s0, l1360
+l4017:     j l1087
+l4018:     lui $a2, %hi(d814)
+l4019:     ori $a3, $a3, %lo(d541)
+l4020:     beq $t0, $s4, l268
+l4021:     j l4091
+l4022:     lui $a2, %hi(d3818)
+l4023:     ori $a3, $a3, %lo(d3545)
+l4024:     beq $t4, $s0, l3272
+l4025:     j l2999
+l4026:     lui $a2, %hi(d2726)
+l4027:     ori $a3, $a3, %lo(d2453)
+l4028:     beq $t8, $s4, l2180
+l4029:     j l1907
+l4030:     lui $a2, %hi(d1634)
+l4031:     ori $a3, $a3, %lo(d1361)
+l4032:     beq $t2, $s0, l1088
+l4033:     j l815
+l4034:     lui $a2, %hi(d542)
+l4035:     ori $a3, $a3, %lo(d269)
+l4036:     beq $t6, $s4, l4092
+l4037:     j l3819
+l4038:     lui $a2, %hi(d3546)
+l4039:     ori $a3, $a3, %lo(d3273)
+l4040:     beq $t0, $s0, l3000
+l4041:     j l2727
+l4042:     lui $a2, %hi(d2454)
+l4043:     ori $a3, $a3, %lo(d2181)
+l4044:     beq $t4, $s4, l1908
+l4045:     j l1635
+l4046:     lui $a2, %hi(d1362)
+l4047:     ori $a3, $a3, %lo(d1089)
+l4048:     beq $t8, $s0, l816
+l4049:     j l543
+l4050:     lui $a2, %hi(d270)
+l4051:     ori $a3, $a3, %lo(d4093)
+l4052:     beq $t2, $s4, l3820
+l4053:     j l3547
+l4054:     lui $a2, %hi(d3274)
+l4055:     ori $a3, $a3, %lo(d3001)
+l4056:     beq $t6, $s0, l2728
+l4057:     j l2455
+l4058:     lui $a2, %hi(d2182)
+l4059:     ori $a3, $a3, %lo(d1909)
+l4060:     beq $t0, $s4, l1636
+l4061:     j l1363
+l4062:     lui $a2, %hi(d1090)
+l4063:     ori $a3, $a3, %lo(d817)
+l4064:     beq $t4, $s0, l544
+l4065:     j l271
+l4066:     lui $a2, %hi(d4094)
+l4067:     ori $a3, $a3, %lo(d3821)
+l4068:     beq $t8, $s4, l3548
+l4069:     j l3275
+l4070:     lui $a2, %hi(d3002)
+l4071:     ori $a3, $a3, %lo(d2729)
+l4072:     beq $t2, $s0, l2456
+l4073:     j l2183
+l4074:     lui $a2, %hi(d1910)
+l4075:     ori $a3, $a3, %lo(d1637)
+l4076:     beq $t6, $s4, l1364
+l4077:     j l1091
+l4078:     lui $a2, %hi(d818)
+l4079:     ori $a3, $a3, %lo(d545)
+l4080:     beq $t0, $s0, l272
+l4081:     j l4095
+l4082:     lui $a2, %hi(d3822)
+l4083:     ori $a3, $a3, %lo(d3549)
+l4084:     beq $t4, $s4, l3276
+l4085:     j l3003
+l4086:     lui $a2, %hi(d2730)
+l4087:     ori $a3, $a3, %lo(d2457)
+l4088:     beq $t8, $s0, l2184
+l4089:     j l1911
+l4090:     lui $a2, %hi(d1638)
+l4091:     ori $a3, $a3, %lo(d1365)
+l4092:     beq $t2, $s4, l1092
+l4093:     j l819
+l4094:     lui $a2, %hi(d546)
+l4095:     ori $a3, $a3, %lo(d273)
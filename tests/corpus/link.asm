@@ -0,0 +1,14 @@
+# golden: link linklib
+# Linked with linklib.asm by arfmipsld: a call, data and %hi/%lo across
+        .globl main
+        .extern count
+        .extern bump
+        .data
+base:   .word 10
+        .text
+main:   lui $a0, %hi(count)
+        ori $a0, $a0, %lo(count)
+        lw $t0, 0($a0)
+        lui $a1, %hi(base)
+        ori $a1, $a1, %lo(base)
+        j bump
@@ -0,0 +1,10 @@
+# Module linked after link.asm
+        .globl count
+        .globl bump
+        .data
+count:  .word 3
+        .text
+bump:   lw $t1, 0($a0)
+        add $t1, $t1, $t1
+        sw $t1, 0($a0)
+back:   beq $zero, $zero, back
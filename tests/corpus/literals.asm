@@ -0,0 +1,22 @@
+; Edge case literals and spacing
+        .data
+hex:    .word 0x0, 0xFFFFFFFF, 0x7fffffff, 0x80000000
+oct:    .word 0777, 017, 00
+bin:    .word 0b0, 0b1, 0b10101010
+dec:    .word 0, 1, 2147483647, 4294967295
+byte:   .byte 255, 0, 0x80, 0177
+half:   .half 65535, 0x8000, 0b1111
+	.word	9	,	10
+tight:.word 3,4,5
+a: b: c: .byte 1
+empty:  .ascii ""
+emptz:  .asciiz ""
+
+        .text
+; comment between instructions
+        ori $t0,$t1,0xffff
+        ori   $t0 ,  $t1 ,  65535
+	ori	$t0,	$t1,	0b1
+        lw $t0,0($t1)
+        lui $t0, 0xFFFF
+last:   j last
@@ -0,0 +1,33 @@
+# golden: max-memory 8192
+# Holes cost nothing wherever they are, the 3 KB of words after them go over
+        .macro w16
+        .word 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        .endm
+        .macro w256
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        w16
+        .endm
+        .data
+small:  .word 1
+gap:    .space 0x10000
+after:  .word 2
+        .space 0x10000
+big:    w256
+        w256
+        w256
+        .text
+        and $t0, $t0, $t0
@@ -0,0 +1,26 @@
+# golden: merge-strings
+        .data
+hello:  .asciiz "hello world"
+world:  .asciiz "world"
+again:  .asciiz "hello world"
+tab1:   .word 1, 2, 3
+tab2:   .word 1, 2, 3
+other:  .byte 9
+        .text
+        lui $t0, %hi(world)
+        ori $t0, $t0, %lo(world)
+        .data
+# A table continuing on unlabelled lines is merged whole or not at all
+a:      .word 1, 2
+b:      .word 9
+tbl:    .word 1, 2
+        .word 3, 4
+tbl2:   .word 1, 2
+        .word 3, 4
+# Labels on their own line label the next data
+msg:
+        .asciiz "standalone"
+msg2:
+        .asciiz "standalone"
+alone:
+        .asciiz "alone"
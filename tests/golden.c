@@ -0,0 +1,639 @@
+/*
+
+    arfmipsas: Assembler for UM ETC base MIPS-based RISC CPU
+    Copyright (C) 2023 arf20 (Ángel Ruiz Fernandez)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+    golden.c: Assembles a corpus and compares every output byte for byte
+        against golden files, timing each source, then checks --watch
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <dirent.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "assembler.h"
+#include "object.h"
+#include "symindex.h"
+#include "symfile.h"
+#include "emit.h"
+#include "elfout.h"
+#include "linetab.h"
+#include "watch.h"
+
+/* Tunables */
+#define TIME_MIN_NS     20000000    /* keep repeating a source this long */
+#define TIME_MIN_RUNS   3
+#define TIME_MAX_RUNS   1000
+#define TIME_NOISE_US   50          /* differences below are not slower */
+#define CASES_MAX       256
+#define WATCH_TIMEOUT_S 10          /* a rebuild that never comes fails */
+#define WATCH_REWRITE_US 100000     /* writer repeats until noticed */
+
+/* An output of a source, NULL data when not produced */
+typedef struct {
+    const char *ext;
+    uint8_t *data;
+    size_t len;
+} output_t;
+
+enum { OUT_DATA, OUT_TEXT, OUT_EB_DATA, OUT_EB_TEXT, OUT_OBJ, OUT_SYM,
+    OUT_DIAG, OUT_HEX, OUT_DATA_MEM, OUT_TEXT_MEM, OUT_DATA_IMG,
+    OUT_TEXT_IMG, OUT_LST, OUT_ELF, OUT_ELF_OBJ, OUT_LINES, OUT_LD_DATA,
+    OUT_LD_TEXT, OUT_LD_SYM, OUT_MAX };
+
+static const char *out_ext[OUT_MAX] = { ".data", ".text", ".eb.data",
+    ".eb.text", ".o", ".sym", ".diag", ".hex", ".data.mem", ".text.mem",
+    ".data.img", ".text.img", ".lst", ".elf", ".elf.o", ".lines",
+    ".ld.data", ".ld.text", ".ld.sym" };
+
+/* Per source, from its "# golden: ..." first line */
+typedef struct {
+    asm_options_t opts;
+    char *link;         /* corpus source linked with it, or NULL */
+} case_t;
+
+static FILE *devnull;
+static emitter_t emitter;
+
+void
+usage(char *name) {
+    fprintf(stderr, "Usage: %s [options] corpus-dir golden-dir\n"
+    "       %s --generate-labels <n>\nOptions\n"
+    "  --update\t\tRewrite the golden files from the current outputs.\n"
+    "  --times <file>\t\tWrite the time of every source as CSV.\n"
+    "  --baseline <file>\tFail on sources slower than in this CSV.\n"
+    "  --tolerance <pct>\tHow much slower counts, default 10.\n"
+    "  --linker <file>\tarfmipsld to link with, default next to %s.\n",
+    name, name, name);
+}
+
+/* Source with n labels, branches and jumps among them */
+void
+generate_labels(long n) {
+    printf("# generated by golden --generate-labels %ld\n", n);
+    printf("        .data\n");
+    for (long i = 0; i < n; i++)
+        printf("d%ld:     .word %ld\n", i, i * 2654435761 % 0x7fffffff);
+    printf("        .text\n");
+    for (long i = 0; i < n; i++) {
+        long t = i * 7919 % n;
+        switch (i % 4) {
+            case 0: printf("l%ld:     beq $t%ld, $s%ld, l%ld\n", i, i % 10,
+                i % 8, t); break;
+            case 1: printf("l%ld:     j l%ld\n", i, t); break;
+            case 2: printf("l%ld:     lui $a%ld, %%hi(d%ld)\n", i, i % 4,
+                t); break;
+            case 3: printf("l%ld:     ori $a%ld, $a%ld, %%lo(d%ld)\n", i,
+                i % 4, i % 4, t); break;
+        }
+    }
+}
+
+char *
+path_join(const char *dir, const char *name, const char *ext) {
+    size_t dl = strlen(dir), nl = strlen(name), el = strlen(ext);
+    char *p = malloc(dl + nl + el + 2);
+    memcpy(p, dir, dl);
+    p[dl] = '/';
+    memcpy(p + dl + 1, name, nl);
+    memcpy(p + dl + 1 + nl, ext, el + 1);
+    return p;
+}
+
+/* Whole stream from its start */
+uint8_t *
+read_stream(FILE *f, size_t *len) {
+    fseek(f, 0, SEEK_END);
+    long l = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = malloc(l + 1);
+    *len = fread(buf, 1, l, f);
+    return buf;
+}
+
+/* Whole file, NULL if missing */
+uint8_t *
+read_file(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    uint8_t *buf = read_stream(f, len);
+    fclose(f);
+    return buf;
+}
+
+/* Replace a file at once, as an editor saving it would */
+int
+write_file(const char *path, const char *text) {
+    char *tmp = malloc(strlen(path) + strlen(".tmp") + 1);
+    sprintf(tmp, "%s.tmp", path);
+    FILE *f = fopen(tmp, "w");
+    int r = f && fputs(text, f) >= 0 ? 0 : -1;
+    if (f && fclose(f) != 0) r = -1;
+    if (r == 0) r = rename(tmp, path);
+    free(tmp);
+    return r;
+}
+
+/* Segment as an image would hold it, zero tail included */
+void
+segment_image(const segment_t *seg, output_t *out) {
+    out->len = seg->size;
+    out->data = malloc(seg->size + 1);
+    segment_read(seg, 0, out->data, seg->size);
+}
+
+void
+segments_free(segment_t *segs) {
+    segment_destroy(&segs[SEG_DATA]);
+    segment_destroy(&segs[SEG_TEXT]);
+    free(segs);
+}
+
+/* Options from a "# golden: ..." first line: merge-strings,
+    max-memory <bytes> and link <source> */
+void
+case_options(const cached_file_t *cf, case_t *cs) {
+    const char *tag = "# golden:";
+    if (strncmp(cf->data, tag, strlen(tag)) != 0) return;
+    const char *eol = strchr(cf->data, '\n');
+    const char *p = cf->data + strlen(tag);
+    const char *m = strstr(p, "merge-strings");
+    if (m && m < eol) cs->opts.merge_strings = 1;
+    m = strstr(p, "max-memory ");
+    if (m && m < eol)
+        cs->opts.max_memory = strtoul(m + strlen("max-memory "), NULL, 0);
+    m = strstr(p, "link ");
+    if (m && m < eol) {
+        m += strlen("link ");
+        size_t l = strcspn(m, " \n");
+        cs->link = strndup(m, l);
+    }
+}
+
+/* Text formats and the listing, through the emitters into a temporary */
+void
+emitted_outputs(const segment_t *segs, const statement_table_t *stmts,
+    endian_t end, output_t *outs)
+{
+    for (int o = OUT_HEX; o <= OUT_LST; o++) {
+        FILE *f = tmpfile();
+        if (!f) continue;
+        emitter_init(&emitter, fileno(f));
+        int r = 0;
+        switch (o) {
+            case OUT_HEX: r = emit_ihex(&emitter, segs, 2); break;
+            case OUT_DATA_MEM:
+                r = emit_vmem(&emitter, &segs[SEG_DATA], end); break;
+            case OUT_TEXT_MEM:
+                r = emit_vmem(&emitter, &segs[SEG_TEXT], end); break;
+            case OUT_DATA_IMG:
+                r = emit_logisim(&emitter, &segs[SEG_DATA], end); break;
+            case OUT_TEXT_IMG:
+                r = emit_logisim(&emitter, &segs[SEG_TEXT], end); break;
+            case OUT_LST: r = emit_listing(&emitter, segs, stmts, end); break;
+        }
+        if (r == 0) outs[o].data = read_stream(f, &outs[o].len);
+        fclose(f);
+    }
+}
+
+/* Raw images and binary symbols of linking obj with the object of
+    corpus source partner, by running the linker */
+void
+link_outputs(const char *linker, const char *corpus, const char *partner,
+    const output_t *obj, filecache_t *cache, output_t *outs)
+{
+    char *src = path_join(corpus, partner, ".asm");
+    cached_file_t *cf = filecache_get(cache, src);
+    asm_options_t opts = { 0 };
+    opts.filename = src;
+    opts.cache = cache;
+    opts.relocatable = 1;
+    segment_t *segs;
+    if (!cf || assemble(cf->data, cf->len, &opts, &segs, NULL, NULL, NULL,
+        devnull) < 0)
+    {
+        fprintf(stderr, "%s: cannot be assembled to link with\n", src);
+        free(src);
+        return;
+    }
+    output_t other;
+    other.data = object_build(segs, opts.endian, &other.len);
+    segments_free(segs);
+    free(src);
+
+    char dir[] = "/tmp/golden.XXXXXX";
+    if (!mkdtemp(dir)) {
+        fprintf(stderr, "Error creating %s: %s\n", dir, strerror(errno));
+        free(other.data);
+        return;
+    }
+    char *objs[2] = { path_join(dir, "a", ".o"), path_join(dir, "b", ".o") };
+    const output_t *ins[2] = { obj, &other };
+    for (int i = 0; i < 2; i++) {
+        FILE *f = fopen(objs[i], "wb");
+        if (f) {
+            fwrite(ins[i]->data, 1, ins[i]->len, f);
+            fclose(f);
+        }
+    }
+    free(other.data);
+
+    char *out = path_join(dir, "out", "");
+    pid_t pid = fork();
+    if (pid == 0) {
+        execl(linker, linker, "-G", "-o", out, objs[0], objs[1],
+            (char*)NULL);
+        fprintf(stderr, "Error running %s: %s\n", linker, strerror(errno));
+        _exit(127);
+    }
+    int status = 0;
+    if (pid < 0 || waitpid(pid, &status, 0) < 0 || !WIFEXITED(status)
+        || WEXITSTATUS(status) != 0)
+    {
+        fprintf(stderr, "%s failed\n", linker);
+    }
+
+    const char *ld_ext[3] = { ".data", ".text", ".sym" };
+    for (int i = 0; i < 3; i++) {
+        char *p = path_join(dir, "out", ld_ext[i]);
+        outs[OUT_LD_DATA + i].data = read_file(p, &outs[OUT_LD_DATA + i].len);
+        remove(p);
+        free(p);
+    }
+    for (int i = 0; i < 2; i++) {
+        remove(objs[i]);
+        free(objs[i]);
+    }
+    free(out);
+    rmdir(dir);
+}
+
+/* Every output of one source */
+void
+build_outputs(const cached_file_t *cf, const case_t *cs, const char *corpus,
+    const char *linker, output_t *outs)
+{
+    asm_options_t opts = cs->opts;
+    segment_t *segs;
+    statement_table_t *stmts = NULL;
+    symindex_t index;
+    diag_list_t diags;
+
+    /* Little endian images in every format, symbols, lines, listing and
+        diagnostics */
+    diag_list_init(&diags, 0);
+    if (assemble(cf->data, cf->len, &opts, &segs, &stmts, &index, &diags,
+        devnull) == 0)
+    {
+        segment_image(&segs[SEG_DATA], &outs[OUT_DATA]);
+        segment_image(&segs[SEG_TEXT], &outs[OUT_TEXT]);
+        outs[OUT_SYM].data = symfile_build(&index, &outs[OUT_SYM].len);
+        emitted_outputs(segs, stmts, opts.endian, outs);
+        outs[OUT_ELF].data = elf_build(segs, 0, opts.endian,
+            &outs[OUT_ELF].len);
+        outs[OUT_LINES].data = linetab_build(stmts, &segs[SEG_TEXT],
+            &outs[OUT_LINES].len);
+        symindex_destroy(&index);
+        segments_free(segs);
+    }
+    if (stmts) statement_table_destroy(stmts);
+    FILE *f = open_memstream((char**)&outs[OUT_DIAG].data,
+        &outs[OUT_DIAG].len);
+    diag_print(&diags, f);
+    fclose(f);
+    diag_list_destroy(&diags);
+
+    /* Big endian image */
+    opts.endian = ENDIAN_BIG;
+    if (assemble(cf->data, cf->len, &opts, &segs, NULL, NULL, NULL,
+        devnull) == 0)
+    {
+        segment_image(&segs[SEG_DATA], &outs[OUT_EB_DATA]);
+        segment_image(&segs[SEG_TEXT], &outs[OUT_EB_TEXT]);
+        segments_free(segs);
+    }
+
+    /* Relocatable object */
+    opts.endian = ENDIAN_LITTLE;
+    opts.relocatable = 1;
+    if (assemble(cf->data, cf->len, &opts, &segs, NULL, NULL, NULL,
+        devnull) == 0)
+    {
+        outs[OUT_OBJ].data = object_build(segs, opts.endian,
+            &outs[OUT_OBJ].len);
+        outs[OUT_ELF_OBJ].data = elf_build(segs, 1, opts.endian,
+            &outs[OUT_ELF_OBJ].len);
+        segments_free(segs);
+    }
+
+    /* Linked with another source */
+    if (cs->link && outs[OUT_OBJ].data)
+        link_outputs(linker, corpus, cs->link, &outs[OUT_OBJ],
+            opts.cache, outs);
+}
+
+/* Word at the start of .data of a source, or -1 when it does not assemble */
+long
+first_word(filecache_t *cache, const char *src) {
+    cached_file_t *cf = filecache_get(cache, src);
+    asm_options_t opts = { 0 };
+    opts.filename = src;
+    opts.cache = cache;
+    segment_t *segs;
+    if (!cf || assemble(cf->data, cf->len, &opts, &segs, NULL, NULL, NULL,
+        devnull) < 0)
+    {
+        return -1;
+    }
+    long w = segs[SEG_DATA].size >= 4
+        ? (long)segment_word(&segs[SEG_DATA], 0, ENDIAN_LITTLE) : -1;
+    segments_free(segs);
+    return w;
+}
+
+/* --watch: an include that is missing, then created, then changed, each
+    wakes the watcher and the next run sees it. The writer repeats its
+    save until killed, so one made before the watches exist is not lost */
+int
+check_watch(void) {
+    char dir[] = "/tmp/golden.XXXXXX";
+    if (!mkdtemp(dir)) {
+        fprintf(stderr, "Error creating %s: %s\n", dir, strerror(errno));
+        return 1;
+    }
+    char *src = path_join(dir, "watch", ".asm");
+    char *inc = path_join(dir, "watch", ".inc");
+    write_file(src, ".data\n.include \"watch.inc\"\n");
+
+    filecache_t cache;
+    filecache_init(&cache);
+    watcher_t w;
+    int bad = watcher_init(&w) < 0 || first_word(&cache, src) != -1;
+
+    const char *saves[2] = { ".word 1\n", ".word 2\n" };
+    for (int i = 0; i < 2 && !bad; i++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            /* Not outliving a harness stopped by the timeout */
+            for (long t = 0; t < WATCH_TIMEOUT_S * 1000000L;
+                t += WATCH_REWRITE_US)
+            {
+                write_file(inc, saves[i]);
+                usleep(WATCH_REWRITE_US);
+            }
+            _exit(0);
+        }
+        alarm(WATCH_TIMEOUT_S);
+        bad = pid < 0 || watcher_wait(&w, &cache, 20) < 0;
+        alarm(0);
+        if (pid > 0) {
+            kill(pid, SIGKILL);
+            waitpid(pid, NULL, 0);
+        }
+        if (!bad && first_word(&cache, src) != i + 1) bad = 1;
+    }
+
+    watcher_destroy(&w);
+    filecache_destroy(&cache);
+    remove(inc);
+    remove(src);
+    rmdir(dir);
+    free(inc);
+    free(src);
+
+    printf("%-16s %s\n", "--watch", bad ? "FAIL" : "ok");
+    return bad;
+}
+
+/* Best time of assembling a source, microseconds */
+double
+time_source(const cached_file_t *cf, const asm_options_t *opts) {
+    double best = 0, total = 0;
+    for (int run = 0; run < TIME_MAX_RUNS
+        && (run < TIME_MIN_RUNS || total < TIME_MIN_NS); run++)
+    {
+        struct timespec t0, t1;
+        segment_t *segs;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        int r = assemble(cf->data, cf->len, opts, &segs, NULL, NULL, NULL,
+            devnull);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        if (r == 0) segments_free(segs);
+
+        double ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+        total += ns;
+        if (run == 0 || ns < best) best = ns;
+    }
+    return best / 1e3;
+}
+
+/* Time of a source in a baseline CSV, or -1 */
+double
+baseline_time(const char *csv, const char *name) {
+    if (!csv) return -1;
+    size_t nl = strlen(name);
+    for (const char *p = csv; p && *p; p = strchr(p, '\n')) {
+        if (*p == '\n') p++;
+        if (strncmp(p, name, nl) != 0 || p[nl] != ',') continue;
+
+        /* Last field */
+        const char *last = p;
+        for (const char *q = p; *q && *q != '\n'; q++)
+            if (*q == ',') last = q + 1;
+        return strtod(last, NULL);
+    }
+    return -1;
+}
+
+static int
+name_cmp(const void *a, const void *b) {
+    return strcmp(*(char *const*)a, *(char *const*)b);
+}
+
+int
+main(int argc, char **argv) {
+    const char *corpus = NULL, *golden = NULL, *timesfn = NULL;
+    const char *basefn = NULL, *linker = NULL;
+    double tolerance = 10;
+    int update = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--generate-labels") == 0 && i + 1 < argc) {
+            generate_labels(strtol(argv[++i], NULL, 0));
+            return 0;
+        } else if (strcmp(argv[i], "--update") == 0) {
+            update = 1;
+        } else if (strcmp(argv[i], "--times") == 0 && i + 1 < argc) {
+            timesfn = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            basefn = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = strtod(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--linker") == 0 && i + 1 < argc) {
+            linker = argv[++i];
+        } else if (argv[i][0] == '-') {
+            usage(*argv);
+            return 1;
+        } else if (!corpus) corpus = argv[i];
+        else if (!golden) golden = argv[i];
+        else {
+            usage(*argv);
+            return 1;
+        }
+    }
+    if (!corpus || !golden) {
+        usage(*argv);
+        return 1;
+    }
+
+    devnull = fopen("/dev/null", "w");
+
+    /* Built next to this program by default */
+    char *ownlinker = NULL;
+    if (!linker) {
+        const char *slash = strrchr(*argv, '/');
+        int dl = slash ? slash - *argv : 1;
+        ownlinker = malloc(dl + strlen("/arfmipsld") + 1);
+        sprintf(ownlinker, "%.*s/arfmipsld", dl, slash ? *argv : ".");
+        linker = ownlinker;
+    }
+
+    size_t baselen;
+    char *baseline = basefn ? (char*)read_file(basefn, &baselen) : NULL;
+    if (basefn && !baseline) {
+        fprintf(stderr, "Error reading %s: %s\n", basefn, strerror(errno));
+        return 1;
+    }
+    if (baseline) baseline[baselen] = '\0';
+
+    FILE *times = timesfn ? fopen(timesfn, "w") : NULL;
+    if (timesfn && !times) {
+        fprintf(stderr, "Error opening %s: %s\n", timesfn, strerror(errno));
+        return 1;
+    }
+    if (times) fprintf(times, "source,bytes,best_us\n");
+
+    /* Sources, in a stable order */
+    DIR *d = opendir(corpus);
+    if (!d) {
+        fprintf(stderr, "Error reading %s: %s\n", corpus, strerror(errno));
+        return 1;
+    }
+    char *names[CASES_MAX];
+    size_t ncases = 0;
+    struct dirent *de;
+    while ((de = readdir(d)) && ncases < CASES_MAX) {
+        size_t l = strlen(de->d_name);
+        if (l > 4 && strcmp(de->d_name + l - 4, ".asm") == 0)
+            names[ncases++] = strndup(de->d_name, l - 4);
+    }
+    closedir(d);
+    qsort(names, ncases, sizeof(char*), name_cmp);
+
+    filecache_t cache;
+    filecache_init(&cache);
+    int failed = 0;
+
+    for (size_t c = 0; c < ncases; c++) {
+        char *src = path_join(corpus, names[c], ".asm");
+        cached_file_t *cf = filecache_get(&cache, src);
+        if (!cf) {
+            fprintf(stderr, "%s: %s\n", src, strerror(errno));
+            failed++;
+            free(src);
+            continue;
+        }
+        case_t cs = { { 0 }, NULL };
+        cs.opts.filename = src;
+        cs.opts.cache = &cache;
+        case_options(cf, &cs);
+
+        output_t outs[OUT_MAX] = { { 0 } };
+        build_outputs(cf, &cs, corpus, linker, outs);
+
+        /* Byte for byte, an empty output matches a missing golden */
+        int bad = 0;
+        for (int o = 0; o < OUT_MAX; o++) {
+            char *gp = path_join(golden, names[c], out_ext[o]);
+            size_t glen = 0;
+            uint8_t *g = read_file(gp, &glen);
+            size_t olen = outs[o].data ? outs[o].len : 0;
+
+            if (update) {
+                if (olen) {
+                    FILE *f = fopen(gp, "wb");
+                    if (!f || fwrite(outs[o].data, 1, olen, f) != olen) {
+                        fprintf(stderr, "Error writing %s\n", gp);
+                        bad = 1;
+                    }
+                    if (f) fclose(f);
+                } else if (g) {
+                    remove(gp);
+                }
+            } else if (olen != glen
+                || (olen && memcmp(outs[o].data, g, olen) != 0))
+            {
+                size_t at = 0;
+                while (at < olen && at < glen && outs[o].data[at] == g[at])
+                    at++;
+                fprintf(stderr, "%s%s: differs from golden at byte %zu "
+                    "(%zu bytes, golden %zu)\n", names[c], out_ext[o], at,
+                    olen, glen);
+                bad = 1;
+            }
+            free(g);
+            free(gp);
+            free(outs[o].data);
+        }
+
+        double us = time_source(cf, &cs.opts);
+        double base = baseline_time(baseline, names[c]);
+        const char *verdict = bad ? "FAIL" : "ok";
+        if (!bad && base > 0 && us > base * (1 + tolerance / 100)
+            && us - base > TIME_NOISE_US)
+        {
+            verdict = "SLOWER";
+            bad = 1;
+        }
+        printf("%-16s %8zu bytes %10.1f us", names[c], cf->len, us);
+        if (base > 0) printf(" (baseline %.1f)", base);
+        printf("  %s\n", verdict);
+        if (times) fprintf(times, "%s,%zu,%.1f\n", names[c], cf->len, us);
+
+        failed += bad;
+        free(cs.link);
+        free(src);
+        free(names[c]);
+    }
+
+    filecache_destroy(&cache);
+    free(ownlinker);
+    if (!update) failed += check_watch();
+    if (times) fclose(times);
+    free(baseline);
+
+    if (update) printf("updated golden files of %zu sources\n", ncases);
+    else printf("%zu sources, %d failed\n", ncases, failed);
+    return failed ? 1 : 0;
+}